@@ -36,7 +36,7 @@ void fill_data(Data2DItem* data_item, double scale = 1.0)
         }
     }
 
-    data_item->setContent(values);
+    data_item->setContent(std::move(values));
 }
 
 } // namespace
@@ -13,6 +13,7 @@
 #include "mvvm/standarditems/colormapviewportitem.h"
 #include "mvvm/standarditems/containeritem.h"
 #include "mvvm/standarditems/data2ditem.h"
+#include <QElapsedTimer>
 #include <cmath>
 
 using namespace ModelView;
@@ -21,8 +22,8 @@ namespace {
 const int nbinsx = 200;
 const int nbinsy = 100;
 
-// fills with data point
-void fill_data(Data2DItem* data_item, double scale = 1.0)
+// generates data points matching axes of data item
+std::vector<double> create_data(const Data2DItem* data_item, double scale)
 {
     const auto xAxis = data_item->xAxis();
     const auto yAxis = data_item->yAxis();
@@ -34,8 +35,19 @@ void fill_data(Data2DItem* data_item, double scale = 1.0)
             values.push_back(z);
         }
     }
+    return values;
+}
+
+// fills with data point
+void fill_data(Data2DItem* data_item, double scale = 1.0)
+{
+    data_item->setContent(create_data(data_item, scale));
+}
 
-    data_item->setContent(values);
+void set_binning(Data2DItem* data_item, int nx, int ny)
+{
+    data_item->setAxes(FixedBinAxisItem::create(nx, -5.0, 5.0),
+                       FixedBinAxisItem::create(ny, 0.0, 5.0));
 }
 } // namespace
 
@@ -54,11 +66,35 @@ void ColorMapModel::updateData(double scale)
     fill_data(data_item, scale);
 }
 
+//! Runs series of full-frame updates of the colormap with given number of bins along each axis.
+//! Returns average time per update in milliseconds. Data frames are prepared in advance, so the
+//! result contains only the time spent in the model and in all attached plot controllers.
+
+double ColorMapModel::benchmarkUpdates(int nbins, int nupdates)
+{
+    auto data_item = dataContainer()->item<Data2DItem>(ContainerItem::T_ITEMS);
+    set_binning(data_item, nbins, nbins);
+
+    // two different buffers, so every update is reported as a change
+    const std::vector<DoubleArray> frames = {DoubleArray(create_data(data_item, 1.0)),
+                                             DoubleArray(create_data(data_item, 1.5))};
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < nupdates; ++i)
+        data_item->setContent(frames[static_cast<size_t>(i) % frames.size()]);
+    const double result = static_cast<double>(timer.nsecsElapsed()) / 1e6 / nupdates;
+
+    set_binning(data_item, nbinsx, nbinsy);
+    fill_data(data_item);
+
+    return result;
+}
+
 void ColorMapModel::addColormap()
 {
     auto data_item = insertItem<Data2DItem>(dataContainer());
-    data_item->setAxes(FixedBinAxisItem::create(nbinsx, -5.0, 5.0),
-                       FixedBinAxisItem::create(nbinsy, 0.0, 5.0));
+    set_binning(data_item, nbinsx, nbinsy);
     fill_data(data_item);
 
     auto viewport_item = insertItem<ColorMapViewportItem>();
@@ -26,6 +26,8 @@ public:
 
     void updateData(double scale);
 
+    double benchmarkUpdates(int nbins, int nupdates);
+
 private:
     ModelView::ContainerItem* dataContainer();
     void populateModel();
@@ -14,11 +14,17 @@
 #include "mvvm/standarditems/colormapviewportitem.h"
 #include <QAction>
 #include <QBoxLayout>
+#include <QMessageBox>
 #include <QToolBar>
 #include <QToolButton>
 
 using namespace ModelView;
 
+namespace {
+const int benchmark_nbins = 2048;
+const int benchmark_nupdates = 20;
+} // namespace
+
 namespace PlotColorMap {
 
 ColorMapWidget::ColorMapWidget(ColorMapModel* model, QWidget* parent)
@@ -69,6 +75,20 @@ void ColorMapWidget::initActions()
     connect(m_resetViewportAction, &QAction::triggered, on_reset);
 
     m_toolBar->addAction(m_resetViewportAction);
+
+    m_benchmarkAction = new QAction("Benchmark", this);
+    m_benchmarkAction->setToolTip(
+        QString("Measures full-frame update of %1x%1 colormap").arg(benchmark_nbins));
+    auto on_benchmark = [this]() {
+        const double msec = m_model->benchmarkUpdates(benchmark_nbins, benchmark_nupdates);
+        QMessageBox::information(this, "Benchmark",
+                                 QString("Full-frame update of %1x%1 colormap: %2 ms")
+                                     .arg(benchmark_nbins)
+                                     .arg(msec, 0, 'f', 2));
+    };
+    connect(m_benchmarkAction, &QAction::triggered, on_benchmark);
+
+    m_toolBar->addAction(m_benchmarkAction);
 }
 
 QBoxLayout* ColorMapWidget::createLeftLayout()
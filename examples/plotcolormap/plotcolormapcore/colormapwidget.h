@@ -42,6 +42,7 @@ private:
 
     QToolBar* m_toolBar{nullptr};
     QAction* m_resetViewportAction{nullptr};
+    QAction* m_benchmarkAction{nullptr};
 
     ColorMapPropertyWidget* m_propertyWidget{nullptr};
     ModelView::ColorMapCanvas* m_colorMapCanvas{nullptr};
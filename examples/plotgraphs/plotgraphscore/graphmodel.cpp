@@ -94,7 +94,8 @@ void GraphModel::randomizeGraphs()
 {
     for (auto item : dataContainer()->items<Data1DItem>(ContainerItem::T_ITEMS)) {
         auto values = item->binValues();
-        std::transform(std::begin(values), std::end(values), std::begin(values),
+        auto& buffer = values.mutableValues();
+        std::transform(std::begin(buffer), std::end(buffer), std::begin(buffer),
                        [](auto x) { return x * ModelView::Utils::RandDouble(0.8, 1.2); });
         item->setValues(values);
     }
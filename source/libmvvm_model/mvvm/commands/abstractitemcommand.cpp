@@ -8,17 +8,22 @@
 // ************************************************************************** //
 
 #include "mvvm/commands/abstractitemcommand.h"
-#include "mvvm/model/modelutils.h"
-#include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
 #include <stdexcept>
 
 using namespace ModelView;
 
+namespace {
+//! Approximate memory occupied by the command object itself.
+const size_t command_overhead = 256;
+} // namespace
+
 struct AbstractItemCommand::AbstractItemCommandImpl {
     enum class Status { initial, after_execute, after_undo };
     bool m_isObsolete{false};
-    std::string m_text;
+    mutable std::string m_text;
+    mutable std::function<std::string()> m_description_generator;
     Status m_status{Status::initial};
     SessionModel* m_model{nullptr};
     AbstractItemCommand* m_self{nullptr};
@@ -76,10 +81,14 @@ bool AbstractItemCommand::isObsolete() const
     return p_impl->m_isObsolete;
 }
 
-//! Returns command description.
+//! Returns command description. Description set by the generator is generated on first request.
 
 std::string AbstractItemCommand::description() const
 {
+    if (p_impl->m_description_generator) {
+        p_impl->m_text = p_impl->m_description_generator();
+        p_impl->m_description_generator = {};
+    }
     return p_impl->m_text;
 }
 
@@ -88,6 +97,29 @@ CommandResult AbstractItemCommand::result() const
     return p_impl->m_result;
 }
 
+//! Returns identifier of the command type for merging. Only commands with the same identifier can
+//! be merged. The value -1 means that the command doesn't support merging.
+
+int AbstractItemCommand::id() const
+{
+    return -1;
+}
+
+//! Attempts to merge the other command, executed right after this one, into this command. Returns
+//! true on success, and the other command can be dropped then.
+
+bool AbstractItemCommand::mergeWith(const AbstractItemCommand*)
+{
+    return false;
+}
+
+//! Returns approximate amount of memory in bytes occupied by the command.
+
+size_t AbstractItemCommand::memorySize() const
+{
+    return command_overhead + p_impl->m_text.size();
+}
+
 //! Sets command obsolete flag.
 
 void AbstractItemCommand::setObsolete(bool flag)
@@ -100,16 +132,34 @@ void AbstractItemCommand::setObsolete(bool flag)
 void AbstractItemCommand::setDescription(const std::string& text)
 {
     p_impl->m_text = text;
+    p_impl->m_description_generator = {};
 }
 
-Path AbstractItemCommand::pathFromItem(SessionItem* item) const
+//! Sets the function to generate command description. It is called only if description is
+//! requested, which saves formatting for commands which are never shown in undo views.
+
+void AbstractItemCommand::setDescriptionGenerator(std::function<std::string()> generator)
 {
-    return Utils::PathFromItem(item);
+    p_impl->m_description_generator = std::move(generator);
 }
 
-SessionItem* AbstractItemCommand::itemFromPath(const Path& path) const
+//! Returns identifier to find given item later. Unlike the path, identifier stays valid when items
+//! are inserted or removed around the item.
+
+identifier_type AbstractItemCommand::identifierFromItem(SessionItem* item) const
+{
+    return item->identifier();
+}
+
+//! Returns item with given identifier, which is looked up in the item pool of the model.
+
+SessionItem* AbstractItemCommand::itemFromIdentifier(const identifier_type& identifier) const
 {
-    return Utils::ItemFromPath(*p_impl->m_model, path);
+    auto result = p_impl->m_model->findItem(identifier);
+    if (!result)
+        throw std::runtime_error("Error in AbstractItemCommand: can't find item with identifier '"
+                                 + identifier + "'.");
+    return result;
 }
 
 SessionModel* AbstractItemCommand::model() const
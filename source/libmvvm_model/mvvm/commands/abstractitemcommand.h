@@ -11,7 +11,9 @@
 #define MVVM_COMMANDS_ABSTRACTITEMCOMMAND_H
 
 #include "mvvm/commands/commandresult.h"
+#include "mvvm/core/types.h"
 #include "mvvm/model_export.h"
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -19,7 +21,6 @@ namespace ModelView {
 
 class SessionItem;
 class SessionModel;
-class Path;
 
 //! Abstract command interface to manipulate SessionItem in model context.
 
@@ -41,11 +42,18 @@ public:
 
     CommandResult result() const;
 
+    virtual int id() const;
+
+    virtual bool mergeWith(const AbstractItemCommand* other);
+
+    virtual size_t memorySize() const;
+
 protected:
     void setObsolete(bool flag);
     void setDescription(const std::string& text);
-    Path pathFromItem(SessionItem* item) const;
-    SessionItem* itemFromPath(const Path& path) const;
+    void setDescriptionGenerator(std::function<std::string()> generator);
+    identifier_type identifierFromItem(SessionItem* item) const;
+    SessionItem* itemFromIdentifier(const identifier_type& identifier) const;
     SessionModel* model() const;
     void setResult(const CommandResult& command_result);
 
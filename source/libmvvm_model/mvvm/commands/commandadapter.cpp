@@ -12,16 +12,23 @@
 
 using namespace ModelView;
 
-CommandAdapter::CommandAdapter(std::shared_ptr<AbstractItemCommand> command)
-    : m_command(std::move(command))
+CommandAdapter::CommandAdapter(std::shared_ptr<AbstractItemCommand> command,
+                               CommandStackContext* context)
+    : m_command(std::move(command)), m_context(context), m_time(std::chrono::steady_clock::now())
 {
+    updateMemorySize();
 }
 
-CommandAdapter::~CommandAdapter() = default;
+CommandAdapter::~CommandAdapter()
+{
+    if (m_context)
+        m_context->memory_usage -= m_memory_size;
+}
 
 void CommandAdapter::undo()
 {
     m_command->undo();
+    updateMemorySize();
 }
 
 void CommandAdapter::redo()
@@ -29,4 +36,58 @@ void CommandAdapter::redo()
     m_command->execute();
     setObsolete(m_command->isObsolete());
     setText(QString::fromStdString(m_command->description()));
+    updateMemorySize();
+}
+
+//! Returns identifier of the command type, or -1 if merging is disabled for the stack.
+
+int CommandAdapter::id() const
+{
+    return m_context && m_context->isMergeEnabled() ? m_command->id() : -1;
+}
+
+//! Merges the command pushed right after this one, if the stack allows it.
+
+bool CommandAdapter::mergeWith(const QUndoCommand* other)
+{
+    auto adapter = dynamic_cast<const CommandAdapter*>(other);
+    if (!adapter || !canMerge(*adapter) || !m_command->mergeWith(adapter->m_command.get()))
+        return false;
+
+    m_time = adapter->m_time;
+    setObsolete(m_command->isObsolete());
+    setText(QString::fromStdString(m_command->description()));
+    updateMemorySize();
+    return true;
+}
+
+//! Returns true if commands can be merged: they are the part of the macro, or they were made
+//! within merge interval, or the memory usage of the stack exceeds the merge threshold.
+
+bool CommandAdapter::canMerge(const CommandAdapter& other) const
+{
+    if (!m_context || !m_context->isMergeEnabled())
+        return false;
+
+    if (m_context->macro_level > 0)
+        return true;
+
+    if (m_context->merge_memory_threshold > 0
+        && m_context->memory_usage > m_context->merge_memory_threshold)
+        return true;
+
+    const auto interval = std::chrono::milliseconds(m_context->merge_interval);
+    return other.m_time - m_time <= interval;
+}
+
+//! Updates contribution of the command to the memory usage of the stack.
+
+void CommandAdapter::updateMemorySize()
+{
+    if (!m_context)
+        return;
+
+    m_context->memory_usage -= m_memory_size;
+    m_memory_size = m_command->memorySize();
+    m_context->memory_usage += m_memory_size;
 }
@@ -12,24 +12,47 @@
 
 #include "mvvm/model_export.h"
 #include <QUndoCommand>
+#include <chrono>
 #include <memory>
 
 namespace ModelView {
 
 class AbstractItemCommand;
 
+//! Settings and state of the undo stack, which are shared with all its commands.
+
+struct MVVM_MODEL_EXPORT CommandStackContext {
+    int merge_interval{0};            //!< commands made within this interval (msec) are merged
+    size_t merge_memory_threshold{0}; //!< above this usage commands are merged regardless of time
+    size_t memory_usage{0};           //!< approximate memory occupied by commands in the stack
+    int macro_level{0};               //!< commands inside the macro are merged regardless of time
+
+    //! Returns true if merging of commands is enabled.
+    bool isMergeEnabled() const { return merge_interval > 0 || merge_memory_threshold > 0; }
+};
+
 //! Adapter to execute our commands within Qt undo/redo framework.
 
 class MVVM_MODEL_EXPORT CommandAdapter : public QUndoCommand {
 public:
-    CommandAdapter(std::shared_ptr<AbstractItemCommand> command);
+    CommandAdapter(std::shared_ptr<AbstractItemCommand> command,
+                   CommandStackContext* context = nullptr);
     ~CommandAdapter() override;
 
     void undo() override;
     void redo() override;
 
+    int id() const override;
+    bool mergeWith(const QUndoCommand* other) override;
+
 private:
+    bool canMerge(const CommandAdapter& other) const;
+    void updateMemorySize();
+
     std::shared_ptr<AbstractItemCommand> m_command;
+    CommandStackContext* m_context{nullptr};
+    std::chrono::steady_clock::time_point m_time; //!< time of the last change made by the command
+    size_t m_memory_size{0};
 };
 
 } // namespace ModelView
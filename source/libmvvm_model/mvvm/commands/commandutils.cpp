@@ -8,9 +8,9 @@
 // ************************************************************************** //
 
 #include "mvvm/commands/commandutils.h"
+#include "mvvm/model/directitemcopystrategy.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/serialization/jsonitembackupstrategy.h"
-#include "mvvm/serialization/jsonitemcopystrategy.h"
 
 std::unique_ptr<ModelView::ItemBackupStrategy>
 ModelView::CreateItemBackupStrategy(const ModelView::SessionModel* model)
@@ -23,5 +23,5 @@ std::unique_ptr<ModelView::ItemCopyStrategy>
 ModelView::CreateItemCopyStrategy(const ModelView::SessionModel* model)
 {
     assert(model);
-    return std::make_unique<JsonItemCopyStrategy>(model->factory());
+    return std::make_unique<DirectItemCopyStrategy>(model->factory());
 }
@@ -9,9 +9,7 @@
 
 #include "mvvm/commands/copyitemcommand.h"
 #include "mvvm/commands/commandutils.h"
-#include "mvvm/interfaces/itembackupstrategy.h"
 #include "mvvm/interfaces/itemcopystrategy.h"
-#include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
@@ -23,8 +21,8 @@ std::string generate_description(const std::string& modelType, const TagRow& tag
 
 struct CopyItemCommand::CopyItemCommandImpl {
     TagRow tagrow;
-    std::unique_ptr<ItemBackupStrategy> backup_strategy;
-    Path item_path;
+    std::unique_ptr<SessionItem> copied_item; //! copy waiting for insertion
+    identifier_type parent_identifier;
     CopyItemCommandImpl(TagRow tagrow) : tagrow(std::move(tagrow)) {}
 };
 
@@ -33,29 +31,31 @@ CopyItemCommand::CopyItemCommand(const SessionItem* item, SessionItem* parent, T
 {
     setResult(nullptr);
 
-    setDescription(generate_description(item->modelType(), p_impl->tagrow));
-    p_impl->backup_strategy = CreateItemBackupStrategy(parent->model());
-    p_impl->item_path = pathFromItem(parent);
+    setDescriptionGenerator([model_type = item->modelType(), tagrow = p_impl->tagrow]() {
+        return generate_description(model_type, tagrow);
+    });
+    p_impl->parent_identifier = identifierFromItem(parent);
 
     auto copy_strategy = CreateItemCopyStrategy(parent->model()); // to modify id's
-    auto item_copy = copy_strategy->createCopy(item);
-
-    p_impl->backup_strategy->saveItem(item_copy.get());
+    p_impl->copied_item = copy_strategy->createCopy(item);
 }
 
 CopyItemCommand::~CopyItemCommand() = default;
 
 void CopyItemCommand::undo_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
-    parent->takeItem(p_impl->tagrow);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    // keeping the copy for later redo, so it comes back with the same identifiers
+    auto item = parent->takeItem(p_impl->tagrow);
+    item->releaseMappers();
+    p_impl->copied_item = std::move(item);
     setResult(nullptr);
 }
 
 void CopyItemCommand::execute_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
-    auto item = parent->insertItem(p_impl->backup_strategy->restoreItem(), p_impl->tagrow);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    auto item = parent->insertItem(std::move(p_impl->copied_item), p_impl->tagrow);
     // FIXME revise behaviour in the case of invalid operation. Catch or not here?
     setResult(item);
     setObsolete(!item); // command is osbolete if insertion failed
@@ -17,7 +17,9 @@ namespace ModelView {
 class SessionItem;
 class TagRow;
 
-//! Command to copy an item.
+//! Command to copy an item. The copy is made once, when the command is created. It is kept by
+//! the command while it is not in the model, and is inserted back on redo with the same
+//! identifiers.
 
 class MVVM_MODEL_EXPORT CopyItemCommand : public AbstractItemCommand {
 public:
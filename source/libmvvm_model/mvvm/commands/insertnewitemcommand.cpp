@@ -8,7 +8,6 @@
 // ************************************************************************** //
 
 #include "mvvm/commands/insertnewitemcommand.h"
-#include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
@@ -21,8 +20,8 @@ std::string generate_description(const std::string& modelType, const TagRow& tag
 struct InsertNewItemCommand::InsertNewItemCommandImpl {
     item_factory_func_t factory_func;
     TagRow tagrow;
-    Path item_path;
-    std::string initial_identifier;
+    identifier_type parent_identifier;
+    std::unique_ptr<SessionItem> undone_item;
     InsertNewItemCommandImpl(item_factory_func_t func, TagRow tagrow)
         : factory_func(std::move(func)), tagrow(std::move(tagrow))
     {
@@ -34,31 +33,30 @@ InsertNewItemCommand::InsertNewItemCommand(item_factory_func_t func, SessionItem
     : AbstractItemCommand(parent), p_impl(std::make_unique<InsertNewItemCommandImpl>(func, tagrow))
 {
     setResult(nullptr);
-    p_impl->item_path = pathFromItem(parent);
+    p_impl->parent_identifier = identifierFromItem(parent);
 }
 
 InsertNewItemCommand::~InsertNewItemCommand() = default;
 
 void InsertNewItemCommand::undo_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
     auto item = parent->takeItem(p_impl->tagrow);
-    // saving identifier for later redo
-    if (p_impl->initial_identifier.empty())
-        p_impl->initial_identifier = item->identifier();
+    // keeping the item for later redo, so it comes back with the same identifiers of all children
+    item->releaseMappers();
+    p_impl->undone_item = std::move(item);
     setResult(nullptr);
 }
 
 void InsertNewItemCommand::execute_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
-    auto child = p_impl->factory_func().release();
-    // here we restore original identifier to get exactly same item on consequitive undo/redo
-    if (!p_impl->initial_identifier.empty())
-        child->setData(QVariant::fromValue(p_impl->initial_identifier), ItemDataRole::IDENTIFIER,
-                       /*direct*/ true);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    auto child = p_impl->undone_item ? p_impl->undone_item.release()
+                                     : p_impl->factory_func().release();
 
-    setDescription(generate_description(child->modelType(), p_impl->tagrow));
+    setDescriptionGenerator([model_type = child->modelType(), tagrow = p_impl->tagrow]() {
+        return generate_description(model_type, tagrow);
+    });
     if (parent->insertItem(child, p_impl->tagrow)) {
         setResult(child);
     }
@@ -19,6 +19,8 @@ class SessionItem;
 class TagRow;
 
 //! Command for unddo/redo to insert new item.
+//! Item taken on undo is kept by the command and is inserted back on redo with the same
+//! identifiers.
 
 class MVVM_MODEL_EXPORT InsertNewItemCommand : public AbstractItemCommand {
 public:
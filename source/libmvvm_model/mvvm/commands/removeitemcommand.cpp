@@ -8,9 +8,6 @@
 // ************************************************************************** //
 
 #include "mvvm/commands/removeitemcommand.h"
-#include "mvvm/commands/commandutils.h"
-#include "mvvm/interfaces/itembackupstrategy.h"
-#include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
@@ -22,8 +19,8 @@ std::string generate_description(const TagRow& tagrow);
 
 struct RemoveItemCommand::RemoveItemCommandImpl {
     TagRow tagrow;
-    std::unique_ptr<ItemBackupStrategy> backup_strategy;
-    Path item_path;
+    std::unique_ptr<SessionItem> removed_item;
+    identifier_type parent_identifier;
     RemoveItemCommandImpl(TagRow tagrow) : tagrow(std::move(tagrow)) {}
 };
 
@@ -33,24 +30,24 @@ RemoveItemCommand::RemoveItemCommand(SessionItem* parent, TagRow tagrow)
 {
     setResult(false);
 
-    setDescription(generate_description(p_impl->tagrow));
-    p_impl->backup_strategy = CreateItemBackupStrategy(parent->model());
-    p_impl->item_path = pathFromItem(parent);
+    setDescriptionGenerator([tagrow = p_impl->tagrow]() { return generate_description(tagrow); });
+    p_impl->parent_identifier = identifierFromItem(parent);
 }
 
 RemoveItemCommand::~RemoveItemCommand() = default;
 
 void RemoveItemCommand::undo_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
-    parent->insertItem(p_impl->backup_strategy->restoreItem(), p_impl->tagrow);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
+    parent->insertItem(std::move(p_impl->removed_item), p_impl->tagrow);
 }
 
 void RemoveItemCommand::execute_command()
 {
-    auto parent = itemFromPath(p_impl->item_path);
+    auto parent = itemFromIdentifier(p_impl->parent_identifier);
     if (auto child = parent->takeItem(p_impl->tagrow); child) {
-        p_impl->backup_strategy->saveItem(child.get());
+        child->releaseMappers();
+        p_impl->removed_item = std::move(child);
         setResult(true);
     } else {
         setResult(false);
@@ -18,6 +18,7 @@ class SessionItem;
 class TagRow;
 
 //! Command for unddo/redo framework to remove item from a model using child's tag and row.
+//! Removed item is kept by the command and is inserted back on undo with the same identifiers.
 
 class MVVM_MODEL_EXPORT RemoveItemCommand : public AbstractItemCommand {
 public:
@@ -9,12 +9,15 @@
 
 #include "mvvm/commands/setvaluecommand.h"
 #include "mvvm/core/variant.h"
-#include "mvvm/model/path.h"
+#include "mvvm/model/customvariants.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/sessionitem.h"
 #include <sstream>
 
 namespace {
+const int set_value_command_id = 1;
 std::string generate_description(const std::string& str, int role);
+size_t payload_size(const ModelView::Variant& variant);
 } // namespace
 
 using namespace ModelView;
@@ -22,7 +25,7 @@ using namespace ModelView;
 struct SetValueCommand::SetValueCommandImpl {
     Variant m_value; //! Value to set as a result of command execution.
     int m_role;
-    Path m_item_path;
+    identifier_type m_item_identifier;
     SetValueCommandImpl(Variant value, int role) : m_value(std::move(value)), m_role(role) {}
 };
 
@@ -34,12 +37,45 @@ SetValueCommand::SetValueCommand(SessionItem* item, Variant value, int role)
 {
     setResult(false);
 
-    setDescription(generate_description(p_impl->m_value.toString().toStdString(), role));
-    p_impl->m_item_path = pathFromItem(item);
+    setDescriptionGenerator([value = p_impl->m_value, role]() {
+        return generate_description(value.toString().toStdString(), role);
+    });
+    p_impl->m_item_identifier = identifierFromItem(item);
 }
 
 SetValueCommand::~SetValueCommand() = default;
 
+int SetValueCommand::id() const
+{
+    return set_value_command_id;
+}
+
+//! Merges the command, which has set the value of the same item and role right after this one.
+//! The command keeps the value which was before both of them, and becomes obsolete if the item has
+//! got this value back.
+
+bool SetValueCommand::mergeWith(const AbstractItemCommand* other)
+{
+    auto command = dynamic_cast<const SetValueCommand*>(other);
+    if (!command || command->p_impl->m_role != p_impl->m_role
+        || command->p_impl->m_item_identifier != p_impl->m_item_identifier)
+        return false;
+
+    auto item = itemFromIdentifier(p_impl->m_item_identifier);
+    auto value = item->data<Variant>(p_impl->m_role);
+    setObsolete(Utils::IsTheSame(value, p_impl->m_value));
+    setDescriptionGenerator([value, role = p_impl->m_role]() {
+        return generate_description(value.toString().toStdString(), role);
+    });
+    return true;
+}
+
+size_t SetValueCommand::memorySize() const
+{
+    return AbstractItemCommand::memorySize() + p_impl->m_item_identifier.size()
+           + payload_size(p_impl->m_value);
+}
+
 void SetValueCommand::undo_command()
 {
     swap_values();
@@ -52,7 +88,7 @@ void SetValueCommand::execute_command()
 
 void SetValueCommand::swap_values()
 {
-    auto item = itemFromPath(p_impl->m_item_path);
+    auto item = itemFromIdentifier(p_impl->m_item_identifier);
     auto old = item->data<Variant>(p_impl->m_role);
     auto result = item->setData(p_impl->m_value, p_impl->m_role, /*direct*/ true);
     setResult(result);
@@ -67,4 +103,19 @@ std::string generate_description(const std::string& str, int role)
     ostr << "Set value: " << str << ", role:" << role;
     return ostr.str();
 }
+
+//! Returns approximate size of the data held by the variant.
+size_t payload_size(const ModelView::Variant& variant)
+{
+    using namespace ModelView;
+    // looking into the variant directly, to not copy its content
+    if (Utils::IsStdStringVariant(variant))
+        return static_cast<const std::string*>(variant.constData())->size();
+    if (Utils::IsDoubleVectorVariant(variant))
+        return static_cast<const std::vector<double>*>(variant.constData())->size()
+               * sizeof(double);
+    if (Utils::IsDoubleArrayVariant(variant))
+        return variant.value<DoubleArray>().size() * sizeof(double);
+    return sizeof(Variant);
+}
 } // namespace
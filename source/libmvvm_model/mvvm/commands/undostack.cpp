@@ -13,6 +13,7 @@
 using namespace ModelView;
 
 struct UndoStack::UndoStackImpl {
+    CommandStackContext m_context; //!< goes first, since commands use it on destruction
     std::unique_ptr<QUndoStack> m_undoStack;
     UndoStackImpl() : m_undoStack(std::make_unique<QUndoStack>()) {}
     QUndoStack* undoStack() { return m_undoStack.get(); }
@@ -23,7 +24,7 @@ UndoStack::UndoStack() : p_impl(std::make_unique<UndoStackImpl>()) {}
 void UndoStack::execute(std::shared_ptr<AbstractItemCommand> command)
 {
     // Wrapping command for Qt. It will be executed by Qt after push.
-    auto adapter = new CommandAdapter(std::move(command));
+    auto adapter = new CommandAdapter(std::move(command), &p_impl->m_context);
     p_impl->undoStack()->push(adapter);
 }
 
@@ -74,6 +75,32 @@ void UndoStack::setUndoLimit(int limit)
     return p_impl->undoStack()->setUndoLimit(limit);
 }
 
+//! Sets time interval in milliseconds, within which consecutive commands of the same kind are
+//! merged into one (i.e. value changes of the same item while dragging a slider). Commands inside
+//! the macro are merged regardless of the interval. Zero interval disables merging.
+
+void UndoStack::setMergeInterval(int msec)
+{
+    p_impl->m_context.merge_interval = msec;
+}
+
+//! Sets approximate memory usage of commands in the stack, above which commands of the same kind
+//! are merged regardless of the merge interval. This only slows down the growth of the stack, it
+//! doesn't bound the memory: commands already in the stack are kept. Use setUndoLimit to bound
+//! the number of commands. Zero disables the threshold.
+
+void UndoStack::setMergeMemoryThreshold(size_t bytes)
+{
+    p_impl->m_context.merge_memory_threshold = bytes;
+}
+
+//! Returns approximate amount of memory in bytes occupied by commands in the stack.
+
+size_t UndoStack::memoryUsage() const
+{
+    return p_impl->m_context.memory_usage;
+}
+
 //! Returns underlying QUndoStack if given object can be casted to UndoStack instance.
 //! This method is used to "convert" current instance to Qt implementation, and use it with other
 //! Qt widgets, if necessary.
@@ -88,9 +115,12 @@ QUndoStack* UndoStack::qtUndoStack(UndoStackInterface* stack_interface)
 void UndoStack::beginMacro(const std::string& name)
 {
     p_impl->undoStack()->beginMacro(QString::fromStdString(name));
+    ++p_impl->m_context.macro_level;
 }
 
 void UndoStack::endMacro()
 {
     p_impl->undoStack()->endMacro();
+    if (p_impl->m_context.macro_level > 0)
+        --p_impl->m_context.macro_level;
 }
@@ -39,6 +39,9 @@ public:
     void redo() override;
     void clear() override;
     void setUndoLimit(int limit) override;
+    void setMergeInterval(int msec) override;
+    void setMergeMemoryThreshold(size_t bytes) override;
+    size_t memoryUsage() const override;
 
     static QUndoStack* qtUndoStack(UndoStackInterface* stack_interface);
 
@@ -0,0 +1,84 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/compactidentifier.h"
+
+using namespace ModelView;
+
+namespace {
+
+const size_t identifier_length = 38;
+const char hex_digits[] = "0123456789abcdef";
+
+//! Returns true if position in the string representation is occupied by dash.
+bool is_dash_position(size_t pos)
+{
+    return pos == 9 || pos == 14 || pos == 19 || pos == 24;
+}
+
+//! Returns value of lowercase hex digit, or -1 if character is not such a digit.
+int hex_value(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    return -1;
+}
+
+} // namespace
+
+//! Converts string identifier to its binary form. Returns empty optional if the string doesn't
+//! represent UUID in braced lowercase form. Conversion is exact, so toString() gives the original
+//! string back.
+
+std::optional<CompactIdentifier> CompactIdentifier::fromString(const identifier_type& id)
+{
+    if (id.size() != identifier_length || id.front() != '{' || id.back() != '}')
+        return {};
+
+    uint64_t parts[2] = {0, 0};
+    int ndigits{0};
+    for (size_t pos = 1; pos + 1 < identifier_length; ++pos) {
+        if (is_dash_position(pos)) {
+            if (id[pos] != '-')
+                return {};
+            continue;
+        }
+        const int value = hex_value(id[pos]);
+        if (value < 0)
+            return {};
+        auto& part = parts[ndigits / 16];
+        part = (part << 4) | static_cast<uint64_t>(value);
+        ++ndigits;
+    }
+
+    return CompactIdentifier(parts[0], parts[1]);
+}
+
+//! Returns identifier in its string form.
+
+identifier_type CompactIdentifier::toString() const
+{
+    identifier_type result(identifier_length, '-');
+    result.front() = '{';
+    result.back() = '}';
+
+    int ndigits{0};
+    for (size_t pos = 1; pos + 1 < identifier_length; ++pos) {
+        if (is_dash_position(pos))
+            continue;
+        const uint64_t part = ndigits < 16 ? m_high : m_low;
+        const int shift = 4 * (15 - ndigits % 16);
+        result[pos] = hex_digits[(part >> shift) & 0xF];
+        ++ndigits;
+    }
+
+    return result;
+}
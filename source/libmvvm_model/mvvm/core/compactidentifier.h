@@ -0,0 +1,60 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_CORE_COMPACTIDENTIFIER_H
+#define MVVM_CORE_COMPACTIDENTIFIER_H
+
+#include "mvvm/core/types.h"
+#include "mvvm/model_export.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ModelView {
+
+//! Binary 128-bit form of the identifier generated by UniqueIdGenerator.
+
+//! Identifiers of SessionItem are UUID strings in braced lowercase form
+//! ("{xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx}"). The compact form is used internally for fast
+//! registration and lookup, while the string form is kept for API and serialization.
+
+class MVVM_MODEL_EXPORT CompactIdentifier {
+public:
+    CompactIdentifier() = default;
+    CompactIdentifier(uint64_t high, uint64_t low) : m_high(high), m_low(low) {}
+
+    static std::optional<CompactIdentifier> fromString(const identifier_type& id);
+
+    identifier_type toString() const;
+
+    uint64_t high() const { return m_high; }
+    uint64_t low() const { return m_low; }
+
+    bool operator==(const CompactIdentifier& other) const
+    {
+        return m_high == other.m_high && m_low == other.m_low;
+    }
+    bool operator!=(const CompactIdentifier& other) const { return !(*this == other); }
+
+    //! Hash function to use CompactIdentifier as a key in hash tables.
+    struct Hash {
+        size_t operator()(const CompactIdentifier& id) const
+        {
+            return static_cast<size_t>(id.m_high ^ (id.m_low * 0xC2B2AE3D27D4EB4Full));
+        }
+    };
+
+private:
+    uint64_t m_high{0};
+    uint64_t m_low{0};
+};
+
+} // namespace ModelView
+
+#endif // MVVM_CORE_COMPACTIDENTIFIER_H
@@ -8,11 +8,51 @@
 // ************************************************************************** //
 
 #include "mvvm/core/uniqueidgenerator.h"
-#include <QUuid>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <thread>
 
 using namespace ModelView;
 
+namespace {
+
+//! Returns random engine of the current thread. Engine is seeded once per thread from the system
+//! random device, mixed with time and thread id to stay unique if the device is deterministic.
+std::mt19937_64& engine()
+{
+    thread_local std::mt19937_64 result = []() {
+        std::random_device device;
+        const auto time = static_cast<uint64_t>(
+            std::chrono::high_resolution_clock::now().time_since_epoch().count());
+        const auto thread = static_cast<uint64_t>(std::hash<std::thread::id>()(
+            std::this_thread::get_id()));
+        std::seed_seq seed{device(), device(), device(), device(),
+                           static_cast<std::random_device::result_type>(time),
+                           static_cast<std::random_device::result_type>(time >> 32),
+                           static_cast<std::random_device::result_type>(thread),
+                           static_cast<std::random_device::result_type>(thread >> 32)};
+        return std::mt19937_64(seed);
+    }();
+    return result;
+}
+
+} // namespace
+
+//! Returns new identifier in the string form, compatible with UUID version 4.
+
 identifier_type UniqueIdGenerator::generate()
 {
-    return QUuid::createUuid().toString().toStdString();
+    return generateCompact().toString();
+}
+
+//! Returns new identifier in the binary form. Random bits come from thread-local pseudo-random
+//! engine, version and variant bits are set as in UUID version 4.
+
+CompactIdentifier UniqueIdGenerator::generateCompact()
+{
+    auto& random = engine();
+    const uint64_t high = (random() & 0xFFFFFFFFFFFF0FFFull) | 0x0000000000004000ull;
+    const uint64_t low = (random() & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;
+    return CompactIdentifier(high, low);
 }
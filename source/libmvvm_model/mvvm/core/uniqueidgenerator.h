@@ -10,6 +10,7 @@
 #ifndef MVVM_CORE_UNIQUEIDGENERATOR_H
 #define MVVM_CORE_UNIQUEIDGENERATOR_H
 
+#include "mvvm/core/compactidentifier.h"
 #include "mvvm/core/types.h"
 #include "mvvm/model_export.h"
 
@@ -22,9 +23,15 @@ namespace ModelView {
 //! generated during a dynamic session. For the moment though, we rely on zero-probability of
 //! such event.
 
+//! Identifiers are generated by thread-local pseudo-random engine seeded once from the system
+//! random device. This is much cheaper than QUuid::createUuid(), while the result keeps the form
+//! of UUID version 4.
+
 class MVVM_MODEL_EXPORT UniqueIdGenerator {
 public:
     static identifier_type generate();
+
+    static CompactIdentifier generateCompact();
 };
 
 } // namespace ModelView
@@ -8,7 +8,9 @@
 // ************************************************************************** //
 
 #include "mvvm/factories/modeldocumentfactory.h"
+#include "mvvm/serialization/binarydocument.h"
 #include "mvvm/serialization/jsondocument.h"
+#include <stdexcept>
 
 namespace ModelView {
 
@@ -17,4 +19,21 @@ std::unique_ptr<ModelDocumentInterface> CreateJsonDocument(const std::vector<Ses
     return std::make_unique<JsonDocument>(models);
 }
 
+std::unique_ptr<ModelDocumentInterface>
+CreateBinaryDocument(const std::vector<SessionModel*>& models)
+{
+    return std::make_unique<BinaryDocument>(models);
+}
+
+std::unique_ptr<ModelDocumentInterface> CreateModelDocument(const std::vector<SessionModel*>& models,
+                                                            ModelDocumentFormat format)
+{
+    if (format == ModelDocumentFormat::JSON)
+        return CreateJsonDocument(models);
+    else if (format == ModelDocumentFormat::BINARY)
+        return CreateBinaryDocument(models);
+    else
+        throw std::runtime_error("Error in CreateModelDocument: unknown document format");
+}
+
 } // namespace ModelView
@@ -22,6 +22,14 @@ class SessionModel;
 MVVM_MODEL_EXPORT std::unique_ptr<ModelDocumentInterface>
 CreateJsonDocument(const std::vector<SessionModel*>& models);
 
+//! Creates BinaryDocument to save and load models.
+MVVM_MODEL_EXPORT std::unique_ptr<ModelDocumentInterface>
+CreateBinaryDocument(const std::vector<SessionModel*>& models);
+
+//! Creates document of given format to save and load models.
+MVVM_MODEL_EXPORT std::unique_ptr<ModelDocumentInterface>
+CreateModelDocument(const std::vector<SessionModel*>& models, ModelDocumentFormat format);
+
 } // namespace ModelView
 
 #endif // MVVM_FACTORIES_MODELDOCUMENTFACTORY_H
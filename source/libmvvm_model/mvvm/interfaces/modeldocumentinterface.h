@@ -15,6 +15,9 @@
 
 namespace ModelView {
 
+//! Supported formats of model documents on disk.
+enum class ModelDocumentFormat { JSON, BINARY };
+
 //! Pure virtual interface to save and restore session models to/from disk.
 
 class MVVM_MODEL_EXPORT ModelDocumentInterface {
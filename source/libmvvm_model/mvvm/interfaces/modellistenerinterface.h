@@ -28,6 +28,11 @@ public:
     //! (SessionItem* parent, tagrow), where 'tagrow' denotes inserted child position.
     virtual void setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t client) = 0;
 
+    //! Sets callback to be notified on insertion of the range of items. The callback will be
+    //! called with (SessionItem* parent, tag, first, count), where 'first' and 'count' denote
+    //! the row of the first inserted child and the number of children inserted.
+    virtual void setOnItemsInserted(Callbacks::item_str_int_int_t f, Callbacks::slot_t client) = 0;
+
     //! Sets callback to be notified on item remove. The callback will be called with
     //! (SessionItem* parent, tagrow), where 'tagrow' denotes child position before the removal.
     virtual void setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client) = 0;
@@ -37,6 +42,16 @@ public:
     //! removed.
     virtual void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t client) = 0;
 
+    //! Sets callback to be notified on removal of the range of items. The callback will be called
+    //! with (SessionItem* parent, tag, first, count), where 'first' and 'count' denote the row of
+    //! the first removed child before the removal and the number of children removed.
+    virtual void setOnItemsRemoved(Callbacks::item_str_int_int_t f, Callbacks::slot_t client) = 0;
+
+    //! Sets callback to be notified when the range of items is about to be removed. The callback
+    //! will be called with (SessionItem* parent, tag, first, count).
+    virtual void setOnAboutToRemoveItems(Callbacks::item_str_int_int_t f,
+                                         Callbacks::slot_t client) = 0;
+
     //! Sets the callback for notifications on model destruction.
     virtual void setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client) = 0;
 
@@ -46,6 +61,10 @@ public:
     //! Sets the callback to be notified right after the root item recreation.
     virtual void setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client) = 0;
 
+    //! Sets the callback to be notified after all notifications of the model transaction have
+    //! been delivered.
+    virtual void setOnTransactionCommitted(Callbacks::model_t f, Callbacks::slot_t client) = 0;
+
     //! Removes given client from all subscriptions.
     virtual void unsubscribe(Callbacks::slot_t client) = 0;
 };
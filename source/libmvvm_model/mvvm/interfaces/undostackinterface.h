@@ -42,6 +42,17 @@ public:
     virtual void clear() = 0;
     virtual void setUndoLimit(int limit) = 0;
 
+    //! Sets the interval (msec) within which commands of the same kind are merged. Merging is not
+    //! supported by default.
+    virtual void setMergeInterval(int) {}
+
+    //! Sets the memory usage of commands (bytes), above which commands of the same kind are merged
+    //! regardless of the interval. Merging is not supported by default.
+    virtual void setMergeMemoryThreshold(size_t) {}
+
+    //! Returns approximate memory usage of commands in bytes, or zero if it is not tracked.
+    virtual size_t memoryUsage() const { return 0; }
+
     virtual void beginMacro(const std::string& name) = 0;
     virtual void endMacro() = 0;
 };
@@ -10,6 +10,7 @@
 #include "mvvm/model/comparators.h"
 #include "mvvm/model/comboproperty.h"
 #include "mvvm/model/customvariants.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/externalproperty.h"
 #include "mvvm/utils/reallimits.h"
 #include <QMetaType>
@@ -23,6 +24,7 @@ void Comparators::registerComparators()
     if (!m_is_registered) {
         QMetaType::registerComparators<std::string>();
         QMetaType::registerComparators<std::vector<double>>();
+        QMetaType::registerComparators<DoubleArray>();
         QMetaType::registerComparators<ComboProperty>();
         QMetaType::registerComparators<ExternalProperty>();
         QMetaType::registerComparators<RealLimits>();
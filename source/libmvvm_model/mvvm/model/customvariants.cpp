@@ -9,13 +9,10 @@
 
 #include "mvvm/model/customvariants.h"
 #include "mvvm/model/comboproperty.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/externalproperty.h"
 #include "mvvm/model/variant_constants.h"
 
-namespace {
-const QString qstring_name = "QString";
-}
-
 using namespace ModelView;
 
 std::string Utils::VariantName(const Variant& variant)
@@ -49,6 +46,10 @@ bool Utils::IsTheSame(const Variant& var1, const Variant& var2)
     if (VariantType(var1) != VariantType(var2))
         return false;
 
+    // arrays are compared by identity of their buffers to avoid element-wise comparison
+    if (IsDoubleArrayVariant(var1))
+        return var1.value<DoubleArray>().isSharedWith(var2.value<DoubleArray>());
+
     // variants of same type are compared by value
     return var1 == var2;
 }
@@ -59,7 +60,7 @@ Variant Utils::toQtVariant(const Variant& custom)
         return custom;
 
     // converts variant based on std::string to variant based on QString
-    if (custom.typeName() == Constants::string_type_name) {
+    if (custom.userType() == qMetaTypeId<std::string>()) {
         return Variant(QString::fromStdString(custom.value<std::string>()));
     }
     else if (IsDoubleVectorVariant(custom)) {
@@ -67,6 +68,10 @@ Variant Utils::toQtVariant(const Variant& custom)
             QString("vector of %1 elements").arg(custom.value<std::vector<double>>().size());
         return Variant(str);
     }
+    else if (IsDoubleArrayVariant(custom)) {
+        QString str = QString("vector of %1 elements").arg(custom.value<DoubleArray>().size());
+        return Variant(str);
+    }
 
     // in other cases returns unchanged variant
     return custom;
@@ -78,7 +83,7 @@ Variant Utils::toCustomVariant(const Variant& standard)
         return standard;
 
     // converts variant based on std::string to variant based on QString
-    if (standard.typeName() == qstring_name)
+    if (standard.userType() == QMetaType::QString)
         return Variant::fromValue(standard.toString().toStdString());
 
     // in other cases returns unchanged variant
@@ -102,17 +107,22 @@ bool Utils::IsDoubleVariant(const Variant& variant)
 
 bool Utils::IsComboVariant(const Variant& variant)
 {
-    return variant.canConvert<ComboProperty>();
+    return variant.userType() == qMetaTypeId<ComboProperty>();
 }
 
 bool Utils::IsStdStringVariant(const Variant& variant)
 {
-    return variant.canConvert<std::string>();
+    return variant.userType() == qMetaTypeId<std::string>();
 }
 
 bool Utils::IsDoubleVectorVariant(const Variant& variant)
 {
-    return variant.typeName() == Constants::vector_double_type_name;
+    return variant.userType() == qMetaTypeId<std::vector<double>>();
+}
+
+bool Utils::IsDoubleArrayVariant(const Variant& variant)
+{
+    return variant.userType() == qMetaTypeId<DoubleArray>();
 }
 
 bool Utils::IsColorVariant(const Variant& variant)
@@ -122,10 +132,10 @@ bool Utils::IsColorVariant(const Variant& variant)
 
 bool Utils::IsExtPropertyVariant(const Variant& variant)
 {
-    return variant.canConvert<ExternalProperty>();
+    return variant.userType() == qMetaTypeId<ExternalProperty>();
 }
 
 bool Utils::IsRealLimitsVariant(const Variant& variant)
 {
-    return variant.canConvert<RealLimits>();
+    return variant.userType() == qMetaTypeId<RealLimits>();
 }
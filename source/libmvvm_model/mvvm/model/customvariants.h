@@ -58,6 +58,9 @@ MVVM_MODEL_EXPORT bool IsStdStringVariant(const Variant& variant);
 //! Returns true in the case of variant based on std::vector<double>.
 MVVM_MODEL_EXPORT bool IsDoubleVectorVariant(const Variant& variant);
 
+//! Returns true in the case of variant based on DoubleArray.
+MVVM_MODEL_EXPORT bool IsDoubleArrayVariant(const Variant& variant);
+
 //! Returns true in the case of QColor based variant.
 MVVM_MODEL_EXPORT bool IsColorVariant(const Variant& variant);
 
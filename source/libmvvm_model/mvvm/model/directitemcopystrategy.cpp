@@ -0,0 +1,69 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/directitemcopystrategy.h"
+#include "mvvm/core/uniqueidgenerator.h"
+#include "mvvm/interfaces/itemfactoryinterface.h"
+#include "mvvm/model/identifierloadingscope.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/sessionitemtags.h"
+#include "mvvm/model/taginfo.h"
+#include <stdexcept>
+
+using namespace ModelView;
+
+DirectItemCopyStrategy::DirectItemCopyStrategy(const ItemFactoryInterface* item_factory,
+                                               ConverterMode mode)
+    : m_factory(item_factory), m_mode(mode)
+{
+    if (m_mode != ConverterMode::copy && m_mode != ConverterMode::clone)
+        throw std::runtime_error("Error in DirectItemCopyStrategy: unsupported converter mode");
+}
+
+DirectItemCopyStrategy::~DirectItemCopyStrategy() = default;
+
+//! Creates item of the same type using the factory, and replaces its data and tags with the copy
+//! of the original ones. Children are copied recursively.
+
+std::unique_ptr<SessionItem> DirectItemCopyStrategy::createCopy(const SessionItem* item) const
+{
+    // identifier of the copy is set below
+    IdentifierLoadingScope scope;
+    auto result = m_factory->createItem(item->modelType());
+
+    // identifier goes first in the data, as it does in the original
+    auto data = std::make_unique<SessionItemData>();
+    auto identifier = isRegenerateIdWhenBackFromJson(m_mode) ? UniqueIdGenerator::generate()
+                                                             : item->identifier();
+    data->setData(Variant::fromValue(identifier), ItemDataRole::IDENTIFIER);
+    for (const auto& x : *item->itemData())
+        if (x.m_role != ItemDataRole::IDENTIFIER)
+            data->setData(x.m_data, x.m_role);
+
+    auto tags = std::make_unique<SessionItemTags>();
+    tags->setDefaultTag(item->itemTags()->defaultTag());
+    for (auto container : *item->itemTags())
+        tags->registerTag(container->tagInfo());
+
+    int index(0);
+    for (auto container : *item->itemTags()) {
+        auto& target = tags->at(index++);
+        for (auto child : *container) {
+            auto child_copy = createCopy(child);
+            if (!target.insertItem(child_copy.get(), target.itemCount()))
+                throw std::runtime_error("Error in DirectItemCopyStrategy: can't insert item copy");
+            child_copy.release()->setParent(result.get());
+        }
+    }
+
+    result->setDataAndTags(std::move(data), std::move(tags));
+    return result;
+}
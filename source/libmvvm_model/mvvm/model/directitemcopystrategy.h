@@ -0,0 +1,41 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_DIRECTITEMCOPYSTRATEGY_H
+#define MVVM_MODEL_DIRECTITEMCOPYSTRATEGY_H
+
+#include "mvvm/interfaces/itemcopystrategy.h"
+#include "mvvm/serialization/jsonitem_types.h"
+#include <memory>
+
+namespace ModelView {
+
+class SessionItem;
+class ItemFactoryInterface;
+
+//! Provides deep copy of SessionItem by cloning its data and tags directly, without intermediate
+//! JSON. Data values are shared with the original, as long as their types are implicitly shared.
+//! Item identifiers are regenerated in ConverterMode::copy, and preserved in ConverterMode::clone.
+
+class MVVM_MODEL_EXPORT DirectItemCopyStrategy : public ItemCopyStrategy {
+public:
+    DirectItemCopyStrategy(const ItemFactoryInterface* item_factory,
+                           ConverterMode mode = ConverterMode::copy);
+    ~DirectItemCopyStrategy() override;
+
+    std::unique_ptr<SessionItem> createCopy(const SessionItem* item) const override;
+
+private:
+    const ItemFactoryInterface* m_factory{nullptr};
+    ConverterMode m_mode;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_DIRECTITEMCOPYSTRATEGY_H
@@ -0,0 +1,188 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/doublearray.h"
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Buffer of the array. Lazy buffer gets its values from the loader on first access.
+
+struct DoubleArray::Storage {
+    std::vector<double> m_values;
+    loader_t m_loader;
+    size_t m_size{0};
+    std::once_flag m_load_flag;
+    std::atomic<bool> m_loaded{true};
+    std::mutex m_loader_mutex; //!< guards the loader, which is released after loading
+
+    Storage() = default;
+    Storage(std::vector<double> values) : m_values(std::move(values)), m_size(m_values.size()) {}
+    Storage(size_t size, loader_t loader)
+        : m_loader(std::move(loader)), m_size(size), m_loaded(false)
+    {
+    }
+
+    std::vector<double>& values()
+    {
+        if (!m_loaded)
+            std::call_once(m_load_flag, [this]() { load(); });
+        return m_values;
+    }
+
+    void load()
+    {
+        auto values = loader()();
+        if (values.size() != m_size)
+            throw std::runtime_error("Error in DoubleArray: loaded size doesn't match.");
+        m_values = std::move(values);
+        m_loaded = true;
+        std::lock_guard<std::mutex> lock(m_loader_mutex);
+        m_loader = {};
+    }
+
+    //! Returns the loader, or empty function if values were loaded already.
+    loader_t loader()
+    {
+        std::lock_guard<std::mutex> lock(m_loader_mutex);
+        return m_loader;
+    }
+};
+
+DoubleArray::DoubleArray()
+{
+    // buffer shared by all default constructed arrays
+    static const auto empty_buffer = std::make_shared<Storage>();
+    m_storage = empty_buffer;
+}
+
+DoubleArray::DoubleArray(std::vector<double> values)
+    : m_storage(std::make_shared<Storage>(std::move(values)))
+{
+}
+
+DoubleArray::DoubleArray(std::shared_ptr<Storage> storage) : m_storage(std::move(storage)) {}
+
+//! Creates array of given size, which will get its content from the loader on first access.
+
+DoubleArray DoubleArray::createLazy(size_t size, loader_t loader)
+{
+    if (!loader)
+        throw std::runtime_error("Error in DoubleArray: loader is not initialized.");
+    return DoubleArray(std::make_shared<Storage>(size, std::move(loader)));
+}
+
+//! Returns true if the content is in memory. Always true for arrays created not lazily.
+
+bool DoubleArray::isLoaded() const
+{
+    return m_storage->m_loaded;
+}
+
+//! Returns copy of the values. Lazy array gets them from the loader and stays not loaded, so
+//! the values don't stay in memory after the copy is gone.
+
+std::vector<double> DoubleArray::copyValues() const
+{
+    if (!m_storage->m_loaded) {
+        if (auto loader = m_storage->loader(); loader) {
+            auto result = loader();
+            if (result.size() != m_storage->m_size)
+                throw std::runtime_error("Error in DoubleArray: loaded size doesn't match.");
+            return result;
+        }
+    }
+    return m_storage->values();
+}
+
+const std::vector<double>& DoubleArray::values() const
+{
+    return m_storage->values();
+}
+
+DoubleArray::operator const std::vector<double>&() const
+{
+    return m_storage->values();
+}
+
+//! Returns buffer for modification. Buffer gets detached, if it is shared with other arrays.
+
+std::vector<double>& DoubleArray::mutableValues()
+{
+    if (m_storage.use_count() > 1)
+        m_storage = std::make_shared<Storage>(m_storage->values());
+    return m_storage->values();
+}
+
+size_t DoubleArray::size() const
+{
+    return m_storage->m_loaded ? m_storage->m_values.size() : m_storage->m_size;
+}
+
+bool DoubleArray::empty() const
+{
+    return size() == 0;
+}
+
+const double* DoubleArray::data() const
+{
+    return m_storage->values().data();
+}
+
+double DoubleArray::operator[](size_t index) const
+{
+    return m_storage->values()[index];
+}
+
+DoubleArray::const_iterator DoubleArray::begin() const
+{
+    return m_storage->values().cbegin();
+}
+
+DoubleArray::const_iterator DoubleArray::end() const
+{
+    return m_storage->values().cend();
+}
+
+//! Returns true if both arrays refer to the same buffer.
+
+bool DoubleArray::isSharedWith(const DoubleArray& other) const
+{
+    return m_storage == other.m_storage;
+}
+
+bool DoubleArray::operator==(const DoubleArray& other) const
+{
+    if (isSharedWith(other))
+        return true;
+    // sizes are known without loading lazy arrays
+    return size() == other.size() && values() == other.values();
+}
+
+bool DoubleArray::operator!=(const DoubleArray& other) const
+{
+    return !(*this == other);
+}
+
+bool DoubleArray::operator<(const DoubleArray& other) const
+{
+    return !isSharedWith(other) && values() < other.values();
+}
+
+bool ModelView::operator==(const DoubleArray& lhs, const std::vector<double>& rhs)
+{
+    return lhs.size() == rhs.size() && lhs.values() == rhs;
+}
+
+bool ModelView::operator==(const std::vector<double>& lhs, const DoubleArray& rhs)
+{
+    return rhs == lhs;
+}
@@ -0,0 +1,79 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_DOUBLEARRAY_H
+#define MVVM_MODEL_DOUBLEARRAY_H
+
+#include "mvvm/core/variant.h"
+#include "mvvm/model_export.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ModelView {
+
+//! Implicitly shared array of doubles to store large numeric data (histograms, detector images)
+//! in variants.
+
+//! Copies of DoubleArray share the same buffer, so passing it through QVariant, undo commands
+//! and getters doesn't copy the data. The buffer is detached on first write access, if it is
+//! shared with someone else (copy-on-write).
+
+//! Array can be created lazily from the loader function, which will be called on first access to
+//! the content. Size of lazy array is known without loading.
+
+class MVVM_MODEL_EXPORT DoubleArray {
+public:
+    using value_type = double;
+    using const_iterator = std::vector<double>::const_iterator;
+    using iterator = const_iterator;
+    using loader_t = std::function<std::vector<double>()>;
+
+    DoubleArray();
+    explicit DoubleArray(std::vector<double> values);
+
+    static DoubleArray createLazy(size_t size, loader_t loader);
+
+    bool isLoaded() const;
+
+    std::vector<double> copyValues() const;
+
+    const std::vector<double>& values() const;
+    operator const std::vector<double>&() const;
+
+    std::vector<double>& mutableValues();
+
+    size_t size() const;
+    bool empty() const;
+    const double* data() const;
+    double operator[](size_t index) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    bool isSharedWith(const DoubleArray& other) const;
+
+    bool operator==(const DoubleArray& other) const;
+    bool operator!=(const DoubleArray& other) const;
+    bool operator<(const DoubleArray& other) const;
+
+private:
+    struct Storage;
+    explicit DoubleArray(std::shared_ptr<Storage> storage);
+    std::shared_ptr<Storage> m_storage;
+};
+
+MVVM_MODEL_EXPORT bool operator==(const DoubleArray& lhs, const std::vector<double>& rhs);
+MVVM_MODEL_EXPORT bool operator==(const std::vector<double>& lhs, const DoubleArray& rhs);
+
+} // namespace ModelView
+
+Q_DECLARE_METATYPE(ModelView::DoubleArray)
+
+#endif // MVVM_MODEL_DOUBLEARRAY_H
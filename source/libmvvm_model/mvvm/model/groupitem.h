@@ -20,7 +20,7 @@ namespace ModelView {
 
 class MVVM_MODEL_EXPORT GroupItem : public SessionItem {
 public:
-    static inline const std::string T_GROUP_ITEMS = "T_GROUP_ITEMS";
+    static inline const TagName T_GROUP_ITEMS = "T_GROUP_ITEMS";
 
     ~GroupItem() override;
 
@@ -0,0 +1,52 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/identifierloadingscope.h"
+#include "mvvm/core/uniqueidgenerator.h"
+#include "mvvm/model/itemutils.h"
+#include "mvvm/model/sessionitem.h"
+
+using namespace ModelView;
+
+namespace {
+//! Number of loading scopes alive on the current thread.
+thread_local int scope_depth{0};
+} // namespace
+
+IdentifierLoadingScope::IdentifierLoadingScope() : m_outermost(scope_depth == 0)
+{
+    ++scope_depth;
+}
+
+IdentifierLoadingScope::~IdentifierLoadingScope()
+{
+    --scope_depth;
+}
+
+//! Returns true if items are being loaded on the calling thread.
+
+bool IdentifierLoadingScope::isActive()
+{
+    return scope_depth > 0;
+}
+
+//! Generates identifiers for the given item and its descendants, which didn't get them from the
+//! loader (e.g. properties missing on disk). Only the outermost scope does the walk, so nested
+//! loaders don't traverse the same items again.
+
+void IdentifierLoadingScope::assignMissing(SessionItem& item) const
+{
+    if (!m_outermost)
+        return;
+
+    Utils::iterate(&item, [](SessionItem* x) {
+        if (!x->hasData(ItemDataRole::IDENTIFIER))
+            x->setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER, /*direct*/ true);
+    });
+}
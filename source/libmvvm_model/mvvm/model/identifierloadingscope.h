@@ -0,0 +1,39 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_IDENTIFIERLOADINGSCOPE_H
+#define MVVM_MODEL_IDENTIFIERLOADINGSCOPE_H
+
+#include "mvvm/model_export.h"
+
+namespace ModelView {
+
+class SessionItem;
+
+//! Marks the loading of items on the calling thread. SessionItem's constructed while the scope is
+//! alive get no identifier, since it is restored by the loader. Scopes can be nested.
+
+class MVVM_MODEL_EXPORT IdentifierLoadingScope {
+public:
+    IdentifierLoadingScope();
+    ~IdentifierLoadingScope();
+    IdentifierLoadingScope(const IdentifierLoadingScope&) = delete;
+    IdentifierLoadingScope& operator=(const IdentifierLoadingScope&) = delete;
+
+    static bool isActive();
+
+    void assignMissing(SessionItem& item) const;
+
+private:
+    bool m_outermost{false};
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_IDENTIFIERLOADINGSCOPE_H
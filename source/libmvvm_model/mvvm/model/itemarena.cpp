@@ -0,0 +1,244 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/itemarena.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <vector>
+
+using namespace ModelView;
+
+namespace {
+
+//! Header preceding every block of the arena. Keeps block's arena and size class.
+struct alignas(16) BlockHeader {
+    ItemArena* arena{nullptr};
+    size_t size_class{0};
+};
+
+const size_t granularity = sizeof(BlockHeader);
+const size_t max_size_class = 64; // blocks up to 1 KiB including the header
+
+thread_local ItemArena* current_arena = nullptr;
+
+//! Returns size class for the block of given size including the header.
+size_t size_class_for(size_t size)
+{
+    return (size + sizeof(BlockHeader) + granularity - 1) / granularity;
+}
+
+BlockHeader* header_of(const void* ptr)
+{
+    return static_cast<BlockHeader*>(const_cast<void*>(ptr)) - 1;
+}
+
+//! Chunks of all arenas. Tells blocks of arenas from heap blocks, which go without the header.
+//! Lookup is skipped altogether while no arena has chunks.
+
+class ChunkRegistry {
+public:
+    static ChunkRegistry& instance()
+    {
+        // never destroyed, since arenas might outlive static objects
+        static auto registry = new ChunkRegistry;
+        return *registry;
+    }
+
+    void add(const char* chunk, size_t size)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_chunks.emplace(chunk, size);
+        m_count.store(m_chunks.size(), std::memory_order_release);
+    }
+
+    void remove(const char* chunk)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_chunks.erase(chunk);
+        m_count.store(m_chunks.size(), std::memory_order_release);
+    }
+
+    //! Returns true if given pointer lies within one of the chunks.
+    bool contains(const void* ptr) const
+    {
+        if (m_count.load(std::memory_order_acquire) == 0)
+            return false;
+
+        auto address = static_cast<const char*>(ptr);
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_chunks.upper_bound(address);
+        if (it == m_chunks.begin())
+            return false;
+        --it;
+        return std::less<const char*>()(address, it->first + it->second);
+    }
+
+private:
+    std::map<const char*, size_t, std::less<const char*>> m_chunks; //!< chunk and its size
+    std::atomic<size_t> m_count{0};
+    mutable std::shared_mutex m_mutex;
+};
+
+} // namespace
+
+struct ItemArena::ItemArenaImpl {
+    struct FreeBlock {
+        FreeBlock* next{nullptr};
+    };
+
+    size_t m_chunk_size{0};
+    std::vector<std::unique_ptr<char[]>> m_chunks;
+    char* m_position{nullptr};
+    size_t m_available{0};
+    std::array<FreeBlock*, max_size_class + 1> m_free_blocks{};
+    size_t m_block_count{0};
+    std::shared_ptr<ItemArena> m_self; // keeps arena alive while it has blocks in use
+    mutable std::mutex m_mutex;
+
+    ItemArenaImpl(size_t chunk_size) : m_chunk_size(chunk_size) {}
+
+    ~ItemArenaImpl()
+    {
+        for (const auto& chunk : m_chunks)
+            ChunkRegistry::instance().remove(chunk.get());
+    }
+
+    void* take_block(size_t size_class)
+    {
+        if (auto block = m_free_blocks[size_class]) {
+            m_free_blocks[size_class] = block->next;
+            return block;
+        }
+
+        const size_t size = size_class * granularity;
+        if (m_available < size) {
+            // the rest of the current chunk is abandoned
+            m_chunks.emplace_back(new char[m_chunk_size]);
+            ChunkRegistry::instance().add(m_chunks.back().get(), m_chunk_size);
+            m_position = m_chunks.back().get();
+            m_available = m_chunk_size;
+        }
+        auto result = m_position;
+        m_position += size;
+        m_available -= size;
+        return result;
+    }
+
+    void return_block(void* block, size_t size_class)
+    {
+        auto free_block = new (block) FreeBlock;
+        free_block->next = m_free_blocks[size_class];
+        m_free_blocks[size_class] = free_block;
+    }
+};
+
+ItemArena::ItemArena(size_t chunk_size)
+    : p_impl(std::make_unique<ItemArenaImpl>(
+        std::max(chunk_size, max_size_class * granularity)))
+{
+}
+
+//! Destroys the arena and frees all its chunks at once. Arena owned by shared_ptr can't be
+//! destroyed before the last block is released; other arenas must outlive their blocks.
+
+ItemArena::~ItemArena() = default;
+
+//! Returns number of blocks in use.
+
+size_t ItemArena::blockCount() const
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    return p_impl->m_block_count;
+}
+
+//! Returns number of bytes reserved by the arena.
+
+size_t ItemArena::reservedSize() const
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    return p_impl->m_chunks.size() * p_impl->m_chunk_size;
+}
+
+//! Allocates block of given size from the current arena. If there is no current arena, or the
+//! block is too large, allocates it from the heap as is.
+
+void* ItemArena::allocate(size_t size)
+{
+    const size_t size_class = size_class_for(size);
+    auto arena = current_arena;
+    if (!arena || size_class > max_size_class)
+        return ::operator new(size);
+
+    auto header = new (arena->allocate_block(size_class)) BlockHeader;
+    header->arena = arena;
+    header->size_class = size_class;
+    return header + 1;
+}
+
+//! Releases block obtained from allocate() either to its arena or to the heap.
+
+void ItemArena::deallocate(void* ptr) noexcept
+{
+    if (!ChunkRegistry::instance().contains(ptr)) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    auto header = header_of(ptr);
+    header->arena->deallocate_block(header, header->size_class);
+}
+
+//! Returns arena which is current for the calling thread.
+
+ItemArena* ItemArena::current()
+{
+    return current_arena;
+}
+
+//! Returns arena of the block obtained from allocate(), or nullptr for heap blocks.
+
+ItemArena* ItemArena::owner(const void* ptr)
+{
+    return ChunkRegistry::instance().contains(ptr) ? header_of(ptr)->arena : nullptr;
+}
+
+void* ItemArena::allocate_block(size_t size_class)
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    auto result = p_impl->take_block(size_class);
+    if (p_impl->m_block_count++ == 0)
+        p_impl->m_self = weak_from_this().lock();
+    return result;
+}
+
+void ItemArena::deallocate_block(void* block, size_t size_class) noexcept
+{
+    // declared before the lock to destroy the arena, if necessary, after the mutex is unlocked
+    std::shared_ptr<ItemArena> self;
+
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    p_impl->return_block(block, size_class);
+    if (--p_impl->m_block_count == 0)
+        self = std::move(p_impl->m_self);
+}
+
+ItemArena::Scope::Scope(ItemArena* arena) : m_previous(current_arena)
+{
+    current_arena = arena;
+}
+
+ItemArena::Scope::~Scope()
+{
+    current_arena = m_previous;
+}
@@ -0,0 +1,72 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_ITEMARENA_H
+#define MVVM_MODEL_ITEMARENA_H
+
+#include "mvvm/model_export.h"
+#include <cstddef>
+#include <memory>
+
+namespace ModelView {
+
+//! Arena for SessionItem and its internal blocks (implementation, data, tags, containers).
+
+//! Blocks are carved from large chunks and recycled through free lists of fixed size classes.
+//! Blocks are taken from the arena, which is current for the calling thread (see Scope),
+//! otherwise from the heap as is, with no overhead. Blocks of the arena remember their origin, so
+//! they can be released from any thread and at any time. Arena owned by shared_ptr stays alive
+//! until its last block is released, all chunks are freed at once after that.
+
+class MVVM_MODEL_EXPORT ItemArena : public std::enable_shared_from_this<ItemArena> {
+public:
+    explicit ItemArena(size_t chunk_size = default_chunk_size);
+    ~ItemArena();
+    ItemArena(const ItemArena&) = delete;
+    ItemArena& operator=(const ItemArena&) = delete;
+
+    static constexpr size_t default_chunk_size = 256 * 1024;
+
+    size_t blockCount() const;
+
+    size_t reservedSize() const;
+
+    static void* allocate(size_t size);
+
+    static void deallocate(void* ptr) noexcept;
+
+    static ItemArena* current();
+
+    static ItemArena* owner(const void* ptr);
+
+    //! Makes given arena current for the calling thread during the lifetime of the scope.
+    //! Nullptr arena means allocation from the heap.
+
+    class MVVM_MODEL_EXPORT Scope {
+    public:
+        explicit Scope(ItemArena* arena);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ItemArena* m_previous{nullptr};
+    };
+
+private:
+    void* allocate_block(size_t size_class);
+    void deallocate_block(void* block, size_t size_class) noexcept;
+
+    struct ItemArenaImpl;
+    std::unique_ptr<ItemArenaImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_ITEMARENA_H
@@ -9,24 +9,53 @@
 
 #include "mvvm/model/itemmanager.h"
 #include "mvvm/factories/itemcataloguefactory.h"
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/itemfactory.h"
 #include "mvvm/model/itempool.h"
 #include "mvvm/model/sessionitem.h"
 
+using namespace ModelView;
+
 namespace {
 std::unique_ptr<ModelView::ItemFactory> DefaultItemFactory()
 {
     return std::make_unique<ModelView::ItemFactory>(ModelView::CreateStandardItemCatalogue());
 }
-} // namespace
 
-using namespace ModelView;
+//! Decorates item factory to create items in the given arena.
+
+class ArenaItemFactory : public ItemFactoryInterface {
+public:
+    ArenaItemFactory(ItemFactoryInterface* factory, ItemArena* arena)
+        : m_factory(factory), m_arena(arena)
+    {
+    }
+
+    void registerItem(const std::string& modelType, item_factory_func_t func,
+                      const std::string& label) override
+    {
+        m_factory->registerItem(modelType, std::move(func), label);
+    }
+
+    std::unique_ptr<SessionItem> createItem(const model_type& modelType) const override
+    {
+        ItemArena::Scope scope(m_arena);
+        return m_factory->createItem(modelType);
+    }
+
+private:
+    ItemFactoryInterface* m_factory{nullptr};
+    ItemArena* m_arena{nullptr};
+};
+
+} // namespace
 
 ItemManager::ItemManager() : m_item_factory(DefaultItemFactory()) {}
 
 void ItemManager::setItemFactory(std::unique_ptr<ItemFactoryInterface> factory)
 {
     m_item_factory = std::move(factory);
+    update_arena_factory();
 }
 
 void ItemManager::setItemPool(std::shared_ptr<ItemPool> pool)
@@ -34,15 +63,25 @@ void ItemManager::setItemPool(std::shared_ptr<ItemPool> pool)
     m_item_pool = std::move(pool);
 }
 
+//! Sets arena for all items created by the manager and its factory. Nullptr arena means creation
+//! of new items on the heap. Items created before stay where they are.
+
+void ItemManager::setItemArena(std::shared_ptr<ItemArena> arena)
+{
+    m_item_arena = std::move(arena);
+    update_arena_factory();
+}
+
 ItemManager::~ItemManager() = default;
 
 std::unique_ptr<SessionItem> ItemManager::createItem(const model_type& modelType) const
 {
-    return m_item_factory->createItem(modelType);
+    return factory()->createItem(modelType);
 }
 
 std::unique_ptr<SessionItem> ItemManager::createRootItem() const
 {
+    ItemArena::Scope scope(itemArena());
     return std::make_unique<SessionItem>();
 }
 
@@ -66,6 +105,11 @@ ItemPool* ItemManager::itemPool()
     return m_item_pool.get();
 }
 
+ItemArena* ItemManager::itemArena() const
+{
+    return m_item_arena.get();
+}
+
 void ItemManager::registerInPool(SessionItem* item)
 {
     if (m_item_pool)
@@ -78,12 +122,21 @@ void ItemManager::unregisterFromPool(SessionItem* item)
         m_item_pool->unregister_item(item);
 }
 
+//! Returns item factory. When item arena is set, the factory creates items in the arena.
+
 const ItemFactoryInterface* ItemManager::factory() const
 {
-    return m_item_factory.get();
+    return m_arena_factory ? m_arena_factory.get() : m_item_factory.get();
 }
 
 ItemFactoryInterface* ItemManager::factory()
 {
     return const_cast<ItemFactoryInterface*>(static_cast<const ItemManager*>(this)->factory());
 }
+
+void ItemManager::update_arena_factory()
+{
+    m_arena_factory = m_item_arena ? std::make_unique<ArenaItemFactory>(m_item_factory.get(),
+                                                                        m_item_arena.get())
+                                   : nullptr;
+}
@@ -19,6 +19,7 @@ namespace ModelView {
 class SessionItem;
 class ItemPool;
 class ItemFactoryInterface;
+class ItemArena;
 
 //! Manages item creation/registration for SessionModel.
 
@@ -29,6 +30,7 @@ public:
 
     void setItemFactory(std::unique_ptr<ItemFactoryInterface> factory);
     void setItemPool(std::shared_ptr<ItemPool> pool);
+    void setItemArena(std::shared_ptr<ItemArena> arena);
 
     std::unique_ptr<SessionItem> createItem(const model_type& modelType = {}) const;
 
@@ -41,6 +43,8 @@ public:
     const ItemPool* itemPool() const;
     ItemPool* itemPool();
 
+    ItemArena* itemArena() const;
+
     void registerInPool(SessionItem* item);
     void unregisterFromPool(SessionItem* item);
 
@@ -49,8 +53,12 @@ public:
     ItemFactoryInterface* factory();
 
 private:
+    void update_arena_factory();
+
     std::shared_ptr<ItemPool> m_item_pool;
     std::unique_ptr<ItemFactoryInterface> m_item_factory;
+    std::shared_ptr<ItemArena> m_item_arena;
+    std::unique_ptr<ItemFactoryInterface> m_arena_factory;
 };
 
 } // namespace ModelView
@@ -8,58 +8,106 @@
 // ************************************************************************** //
 
 #include "mvvm/model/itempool.h"
+#include "mvvm/core/compactidentifier.h"
 #include "mvvm/core/uniqueidgenerator.h"
+#include "mvvm/utils/openhashmap.h"
 #include <stdexcept>
+#include <unordered_map>
 
 using namespace ModelView;
 
+struct ItemPool::ItemPoolImpl {
+    //! items registered with identifiers generated by UniqueIdGenerator
+    OpenHashMap<CompactIdentifier, SessionItem*, CompactIdentifier::Hash> m_key_to_item;
+    OpenHashMap<const SessionItem*, CompactIdentifier> m_item_to_key;
+
+    //! items registered with user defined keys of arbitrary form
+    std::unordered_map<identifier_type, SessionItem*> m_custom_key_to_item;
+    std::unordered_map<const SessionItem*, identifier_type> m_item_to_custom_key;
+
+    bool is_registered(const SessionItem* item) const
+    {
+        return m_item_to_key.contains(item)
+               || m_item_to_custom_key.find(item) != m_item_to_custom_key.end();
+    }
+
+    bool is_existing_key(const identifier_type& key) const
+    {
+        if (auto id = CompactIdentifier::fromString(key); id)
+            return m_key_to_item.contains(*id);
+        return m_custom_key_to_item.find(key) != m_custom_key_to_item.end();
+    }
+
+    void insert(SessionItem* item, const identifier_type& key)
+    {
+        if (auto id = CompactIdentifier::fromString(key); id) {
+            m_key_to_item.insert(*id, item);
+            m_item_to_key.insert(item, *id);
+        }
+        else {
+            m_custom_key_to_item.insert(std::make_pair(key, item));
+            m_item_to_custom_key.insert(std::make_pair(item, key));
+        }
+    }
+};
+
+ItemPool::ItemPool() : p_impl(std::make_unique<ItemPoolImpl>()) {}
+
+ItemPool::~ItemPool() = default;
+
 size_t ItemPool::size() const
 {
-    if (m_key_to_item.size() != m_item_to_key.size())
+    if (p_impl->m_key_to_item.size() != p_impl->m_item_to_key.size()
+        || p_impl->m_custom_key_to_item.size() != p_impl->m_item_to_custom_key.size())
         throw std::runtime_error("Error in ItemPool: array size mismatch");
-    return m_key_to_item.size();
+    return p_impl->m_key_to_item.size() + p_impl->m_custom_key_to_item.size();
 }
 
 identifier_type ItemPool::register_item(SessionItem* item, identifier_type key)
 
 {
-    if (m_item_to_key.find(item) != m_item_to_key.end())
+    if (p_impl->is_registered(item))
         throw std::runtime_error("ItemPool::register_item() -> Attempt to register already "
                                  "registered item.");
 
     if (key.empty()) {
         key = UniqueIdGenerator::generate();
-        while (m_key_to_item.find(key) != m_key_to_item.end())
+        while (p_impl->is_existing_key(key))
             key = UniqueIdGenerator::generate(); // preventing improbable duplicates
     }
     else {
-        if (m_key_to_item.find(key) != m_key_to_item.end())
+        if (p_impl->is_existing_key(key))
             throw std::runtime_error(" ItemPool::register_item() -> Attempt to reuse existing key");
     }
 
-    m_key_to_item.insert(std::make_pair(key, item));
-    m_item_to_key.insert(std::make_pair(item, key));
+    p_impl->insert(item, key);
 
     return key;
 }
 
 void ItemPool::unregister_item(SessionItem* item)
 {
-    auto it = m_item_to_key.find(item);
-    if (it == m_item_to_key.end())
+    if (auto id = p_impl->m_item_to_key.find(item); id) {
+        p_impl->m_key_to_item.erase(*id);
+        p_impl->m_item_to_key.erase(item);
+        return;
+    }
+
+    auto it = p_impl->m_item_to_custom_key.find(item);
+    if (it == p_impl->m_item_to_custom_key.end())
         throw std::runtime_error("ItemPool::deregister_item() -> Attempt to deregister "
                                  "non existing item.");
-    auto key = it->second;
-    m_item_to_key.erase(it);
-
-    auto it2 = m_key_to_item.find(key);
-    m_key_to_item.erase(it2);
+    p_impl->m_custom_key_to_item.erase(it->second);
+    p_impl->m_item_to_custom_key.erase(it);
 }
 
 identifier_type ItemPool::key_for_item(const SessionItem* item) const
 {
-    const auto it = m_item_to_key.find(item);
-    if (it != m_item_to_key.end())
+    if (auto id = p_impl->m_item_to_key.find(item); id)
+        return id->toString();
+
+    const auto it = p_impl->m_item_to_custom_key.find(item);
+    if (it != p_impl->m_item_to_custom_key.end())
         return it->second;
 
     return {};
@@ -67,8 +115,13 @@ identifier_type ItemPool::key_for_item(const SessionItem* item) const
 
 SessionItem* ItemPool::item_for_key(const identifier_type& key) const
 {
-    auto it = m_key_to_item.find(key);
-    if (it != m_key_to_item.end())
+    if (auto id = CompactIdentifier::fromString(key); id) {
+        auto item = p_impl->m_key_to_item.find(*id);
+        return item ? *item : nullptr;
+    }
+
+    auto it = p_impl->m_custom_key_to_item.find(key);
+    if (it != p_impl->m_custom_key_to_item.end())
         return it->second;
 
     return nullptr;
@@ -12,7 +12,7 @@
 
 #include "mvvm/core/types.h"
 #include "mvvm/model_export.h"
-#include <map>
+#include <memory>
 
 namespace ModelView {
 
@@ -21,9 +21,14 @@ class SessionItem;
 //! Provides registration of SessionItem pointers and their unique identifiers
 //! in global memory pool.
 
+//! Identifiers in the form generated by UniqueIdGenerator are stored in binary form in
+//! open-addressing hash tables. Any other string can still be used as a key, such keys are kept
+//! in a separate table as they are.
+
 class MVVM_MODEL_EXPORT ItemPool {
 public:
-    ItemPool() = default;
+    ItemPool();
+    ~ItemPool();
     ItemPool(const ItemPool&) = delete;
     ItemPool(ItemPool&&) = delete;
     ItemPool& operator=(const ItemPool&) = delete;
@@ -39,8 +44,8 @@ public:
     SessionItem* item_for_key(const identifier_type& key) const;
 
 private:
-    std::map<identifier_type, SessionItem*> m_key_to_item;
-    std::map<const SessionItem*, identifier_type> m_item_to_key;
+    struct ItemPoolImpl;
+    std::unique_ptr<ItemPoolImpl> p_impl;
 };
 
 } // namespace ModelView
@@ -78,12 +78,12 @@ int Utils::IndexOfChild(const SessionItem* parent, const SessionItem* child)
     return Utils::IndexOfItem(parent->children(), child);
 }
 
-bool Utils::HasTag(const SessionItem& item, const std::string& tag)
+bool Utils::HasTag(const SessionItem& item, const TagName& tag)
 {
     return item.itemTags()->isTag(tag);
 }
 
-bool Utils::IsSinglePropertyTag(const SessionItem& item, const std::string& tag)
+bool Utils::IsSinglePropertyTag(const SessionItem& item, const TagName& tag)
 {
     return item.itemTags()->isSinglePropertyTag(tag);
 }
@@ -108,18 +108,20 @@ std::vector<std::string> Utils::RegisteredUniversalTags(const SessionItem& item)
 std::vector<SessionItem*> Utils::TopLevelItems(const SessionItem& item)
 {
     std::vector<SessionItem*> result;
-    for (auto child : item.children())
-        if (child->isVisible() && !IsSinglePropertyTag(item, item.tagRowOfItem(child).tag))
+    item.itemTags()->forEachItem([&result](auto child, const auto& container, int) {
+        if (child->isVisible() && !container.tagInfo().isSinglePropertyTag())
             result.push_back(child);
+    });
     return result;
 }
 
 std::vector<SessionItem*> Utils::SinglePropertyItems(const SessionItem& item)
 {
     std::vector<SessionItem*> result;
-    for (auto child : item.children())
-        if (child->isVisible() && IsSinglePropertyTag(item, item.tagRowOfItem(child).tag))
+    item.itemTags()->forEachItem([&result](auto child, const auto& container, int) {
+        if (child->isVisible() && container.tagInfo().isSinglePropertyTag())
             result.push_back(child);
+    });
     return result;
 }
 
@@ -10,6 +10,7 @@
 #ifndef MVVM_MODEL_ITEMUTILS_H
 #define MVVM_MODEL_ITEMUTILS_H
 
+#include "mvvm/model/tagname.h"
 #include "mvvm/model_export.h"
 #include <functional>
 #include <string>
@@ -42,10 +43,10 @@ MVVM_MODEL_EXPORT SessionItem* ChildAt(const SessionItem* parent, int index);
 MVVM_MODEL_EXPORT int IndexOfChild(const SessionItem* parent, const SessionItem* child);
 
 //! Returns true if given item has registered tag.
-MVVM_MODEL_EXPORT bool HasTag(const SessionItem& item, const std::string& tag);
+MVVM_MODEL_EXPORT bool HasTag(const SessionItem& item, const TagName& tag);
 
 //! Returns true if given item has registered `tag`, and it belongs to single property.
-MVVM_MODEL_EXPORT bool IsSinglePropertyTag(const SessionItem& item, const std::string& tag);
+MVVM_MODEL_EXPORT bool IsSinglePropertyTag(const SessionItem& item, const TagName& tag);
 
 //! Returns vector of strings containing all registered tags of the given item.
 MVVM_MODEL_EXPORT std::vector<std::string> RegisteredTags(const SessionItem& item);
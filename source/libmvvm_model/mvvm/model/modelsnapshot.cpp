@@ -0,0 +1,47 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modelsnapshot.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/snapshotitem.h"
+
+using namespace ModelView;
+
+ModelSnapshot::ModelSnapshot(const SessionModel& model)
+    : m_modelType(model.modelType()), m_root(model.rootItem()->snapshot())
+{
+}
+
+std::string ModelSnapshot::modelType() const
+{
+    return m_modelType;
+}
+
+//! Returns snapshot of the root item, or nullptr for default constructed snapshot.
+
+const SnapshotItem* ModelSnapshot::rootItem() const
+{
+    return m_root.get();
+}
+
+//! Returns snapshot of the item with given identifier, or nullptr if there is no such item.
+//! Lookup walks through the tree.
+
+const SnapshotItem* ModelSnapshot::findItem(const identifier_type& identifier) const
+{
+    return m_root ? m_root->findItem(identifier) : nullptr;
+}
+
+//! Returns true if both snapshots refer to the same state of the model.
+
+bool ModelSnapshot::isSharedWith(const ModelSnapshot& other) const
+{
+    return m_root && m_root == other.m_root;
+}
@@ -0,0 +1,53 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_MODELSNAPSHOT_H
+#define MVVM_MODEL_MODELSNAPSHOT_H
+
+#include "mvvm/core/types.h"
+#include "mvvm/model_export.h"
+#include <memory>
+#include <string>
+
+namespace ModelView {
+
+class SessionModel;
+class SnapshotItem;
+
+//! Read-only state of SessionModel at the moment of construction.
+
+//! Snapshot is taken in the thread owning the model. Parts of the tree, which didn't change since
+//! the previous snapshot, are shared with it, as long as it is alive. Each changed item rebuilds
+//! the snapshots of itself and its ancestors, copying their data and their lists of children, so
+//! the cost is O(changed items x depth x fan-out). The first snapshot, or the one taken after all
+//! previous snapshots were released, copies the whole model. Snapshot is cheap to copy, and can be
+//! passed to worker threads for saving, export or comparison, while the model is being edited.
+//! Changes made during ModelTransaction are visible to the snapshot right away.
+
+class MVVM_MODEL_EXPORT ModelSnapshot {
+public:
+    ModelSnapshot() = default;
+    explicit ModelSnapshot(const SessionModel& model);
+
+    std::string modelType() const;
+
+    const SnapshotItem* rootItem() const;
+
+    const SnapshotItem* findItem(const identifier_type& identifier) const;
+
+    bool isSharedWith(const ModelSnapshot& other) const;
+
+private:
+    std::string m_modelType;
+    std::shared_ptr<const SnapshotItem> m_root;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_MODELSNAPSHOT_H
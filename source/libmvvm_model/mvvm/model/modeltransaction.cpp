@@ -0,0 +1,59 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modeltransaction.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/signals/modelmapper.h"
+#include <exception>
+#include <stdexcept>
+
+using namespace ModelView;
+
+ModelTransaction::ModelTransaction(SessionModel* model)
+    : m_model(model), m_uncaught_exceptions(std::uncaught_exceptions())
+{
+    if (!m_model)
+        throw std::runtime_error("Error in ModelTransaction: model is not initialized.");
+    m_model->mapper()->beginTransaction();
+}
+
+ModelTransaction::~ModelTransaction()
+{
+    if (m_committed)
+        return;
+    m_committed = true;
+
+    if (std::uncaught_exceptions() > m_uncaught_exceptions) {
+        m_model->mapper()->abortTransaction();
+        return;
+    }
+
+    try {
+        m_model->mapper()->commitTransaction();
+    } catch (...) {
+        // destructor can't report listener's exception, see commit()
+    }
+}
+
+//! Commits the transaction. Recorded notifications are delivered, if this is the outermost
+//! transaction. Repeated calls do nothing. Exceptions thrown by listeners are passed to the
+//! caller, recorded notifications, which weren't delivered yet, are discarded then.
+
+void ModelTransaction::commit()
+{
+    if (m_committed)
+        return;
+    m_committed = true;
+    m_model->mapper()->commitTransaction();
+}
+
+bool ModelTransaction::isCommitted() const
+{
+    return m_committed;
+}
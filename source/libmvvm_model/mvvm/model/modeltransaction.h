@@ -0,0 +1,51 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_MODELTRANSACTION_H
+#define MVVM_MODEL_MODELTRANSACTION_H
+
+#include "mvvm/model_export.h"
+
+namespace ModelView {
+
+class SessionModel;
+
+//! Groups changes of SessionModel to deliver their notifications at once.
+
+//! While the transaction is alive, notifications on data change and item insertion are recorded
+//! instead of being emitted. On commit they are delivered in compacted form: repeated changes of
+//! the same item's role are reported once, adjacent insertions into the same tag are reported as a
+//! single range (see ModelMapper::setOnItemsInserted). Removal of items and model reset deliver
+//! recorded notifications first and are reported immediately. Transactions can be nested, the
+//! outermost one delivers notifications. The transaction commits on destruction and must not
+//! outlive the model. Destructor never throws: exceptions of listeners are reported by explicit
+//! commit() only. If the transaction is left because of the exception, recorded notifications are
+//! delivered, but the commit isn't reported.
+
+class MVVM_MODEL_EXPORT ModelTransaction {
+public:
+    explicit ModelTransaction(SessionModel* model);
+    ~ModelTransaction();
+
+    ModelTransaction(const ModelTransaction& other) = delete;
+    ModelTransaction& operator=(const ModelTransaction& other) = delete;
+
+    void commit();
+
+    bool isCommitted() const;
+
+private:
+    SessionModel* m_model{nullptr};
+    bool m_committed{false};
+    int m_uncaught_exceptions{0}; //!< number of exceptions in flight at construction
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_MODELTRANSACTION_H
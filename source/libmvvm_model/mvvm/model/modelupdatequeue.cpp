@@ -0,0 +1,232 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modelupdatequeue.h"
+#include "mvvm/model/customvariants.h"
+#include "mvvm/model/doublearray.h"
+#include "mvvm/model/modeltransaction.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace {
+
+//! Single change of the model, waiting in the queue.
+
+struct Update {
+    enum class Type { SET_DATA, INSERT_ITEM };
+    Type type{Type::SET_DATA};
+    identifier_type identifier; //! item to change, or parent of the item to insert
+    Variant value;
+    int role{ItemDataRole::DATA};
+    model_type modelType;
+    TagRow tagrow;
+};
+
+} // namespace
+
+struct ModelUpdateQueue::ModelUpdateQueueImpl {
+    using key_t = std::pair<identifier_type, int>;
+
+    SessionModel* m_model{nullptr};
+    mutable std::mutex m_mutex;
+    std::deque<Update> m_updates;
+    uint64_t m_front_index{0}; //! sequential number of the update at the front of the queue
+    std::map<key_t, uint64_t> m_pending_data; //! sequential numbers of pending data changes
+    uint64_t m_insert_barrier{0}; //! sequential number following the last pending insertion
+    callback_t m_on_pending;
+
+    ModelUpdateQueueImpl(SessionModel* model) : m_model(model) {}
+
+    //! Appends update to the queue, or replaces the value of the pending change of the same
+    //! item's role, if no insertion was requested after it. Notifies the callback, if the queue
+    //! was empty.
+
+    void enqueue(Update update)
+    {
+        callback_t callback;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (update.type == Update::Type::SET_DATA) {
+                key_t key{update.identifier, update.role};
+                auto it = m_pending_data.find(key);
+                if (it != m_pending_data.end() && it->second >= m_insert_barrier) {
+                    m_updates[it->second - m_front_index].value = std::move(update.value);
+                    return;
+                }
+                m_pending_data[key] = m_front_index + m_updates.size();
+            } else {
+                m_insert_barrier = m_front_index + m_updates.size() + 1;
+            }
+            if (m_updates.empty())
+                callback = m_on_pending;
+            m_updates.push_back(std::move(update));
+        }
+        if (callback)
+            callback();
+    }
+
+    //! Removes up to 'max_count' updates from the front of the queue and returns them.
+
+    std::vector<Update> take(size_t max_count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const size_t count = std::min(max_count, m_updates.size());
+        std::vector<Update> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            auto& update = m_updates.front();
+            if (update.type == Update::Type::SET_DATA) {
+                // the change can be followed by the newer one, queued after an insertion
+                auto it = m_pending_data.find({update.identifier, update.role});
+                if (it != m_pending_data.end() && it->second == m_front_index + i)
+                    m_pending_data.erase(it);
+            }
+            result.push_back(std::move(update));
+            m_updates.pop_front();
+        }
+        m_front_index += count;
+        return result;
+    }
+
+    //! Applies update to the model. Returns true if the model was changed. Invalid update, which
+    //! the model rejects with an exception (e.g. the value of wrong type), is discarded.
+
+    bool apply(const Update& update)
+    {
+        try {
+            return apply_update(update);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    bool apply_update(const Update& update)
+    {
+        if (update.type == Update::Type::SET_DATA) {
+            auto item = m_model->findItem(update.identifier);
+            return item ? m_model->setData(item, update.value, update.role) : false;
+        }
+
+        auto parent = m_model->findItem(update.identifier);
+        return parent ? m_model->insertNewItem(update.modelType, parent, update.tagrow) != nullptr
+                      : false;
+    }
+};
+
+ModelUpdateQueue::ModelUpdateQueue(SessionModel* model)
+    : p_impl(std::make_unique<ModelUpdateQueueImpl>(model))
+{
+    if (!model)
+        throw std::runtime_error("Error in ModelUpdateQueue: model is not initialized.");
+}
+
+ModelUpdateQueue::~ModelUpdateQueue() = default;
+
+//! Requests the change of data of the item with given identifier.
+
+void ModelUpdateQueue::setData(const identifier_type& identifier, const Variant& value, int role)
+{
+    Update update;
+    update.identifier = identifier;
+    update.value = value;
+    update.role = role;
+    p_impl->enqueue(std::move(update));
+}
+
+//! Requests the change of data of the item with given identifier to the array of values.
+//! The array is constructed in the calling thread, so the thread owning the model doesn't
+//! copy it. To set values of Data1DItem or Data2DItem, use the identifier of their values property.
+
+void ModelUpdateQueue::setArray(const identifier_type& identifier, std::vector<double> values,
+                                int role)
+{
+    setData(identifier, Variant::fromValue(DoubleArray(std::move(values))), role);
+}
+
+//! Requests the insertion of the new item of given type into the parent with given identifier.
+
+void ModelUpdateQueue::insertItem(const model_type& modelType,
+                                  const identifier_type& parent_identifier, const TagRow& tagrow)
+{
+    Update update;
+    update.type = Update::Type::INSERT_ITEM;
+    update.identifier = parent_identifier;
+    update.modelType = modelType;
+    update.tagrow = tagrow;
+    p_impl->enqueue(std::move(update));
+}
+
+//! Sets the callback to be called, when the first update enters the empty queue. The callback is
+//! called from the thread which requested the update, and is intended to schedule processing of
+//! the queue in the thread owning the model (e.g. via queued Qt connection).
+
+void ModelUpdateQueue::setOnUpdatesPending(callback_t callback)
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    p_impl->m_on_pending = std::move(callback);
+}
+
+//! Returns number of updates waiting in the queue.
+
+size_t ModelUpdateQueue::size() const
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    return p_impl->m_updates.size();
+}
+
+bool ModelUpdateQueue::empty() const
+{
+    return size() == 0;
+}
+
+//! Discards all updates waiting in the queue.
+
+void ModelUpdateQueue::clear()
+{
+    std::lock_guard<std::mutex> lock(p_impl->m_mutex);
+    p_impl->m_front_index += p_impl->m_updates.size();
+    p_impl->m_updates.clear();
+    p_impl->m_pending_data.clear();
+}
+
+//! Applies up to 'max_count' updates in the order of their request. Notifications of the model
+//! are delivered once for the whole batch (see ModelTransaction). Invalid updates, which the model
+//! rejects with an exception, are discarded and don't prevent the rest of the batch from being
+//! applied. Returns number of updates which changed the model. Must be called from the thread
+//! owning the model.
+
+size_t ModelUpdateQueue::process(size_t max_count)
+{
+    auto updates = p_impl->take(max_count);
+    if (updates.empty())
+        return 0;
+
+    size_t result{0};
+    ModelTransaction transaction(p_impl->m_model);
+    for (const auto& update : updates)
+        if (p_impl->apply(update))
+            ++result;
+    return result;
+}
+
+//! Applies all updates waiting in the queue.
+
+size_t ModelUpdateQueue::processAll()
+{
+    return process(std::numeric_limits<size_t>::max());
+}
@@ -0,0 +1,80 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_MODELUPDATEQUEUE_H
+#define MVVM_MODEL_MODELUPDATEQUEUE_H
+
+#include "mvvm/core/types.h"
+#include "mvvm/core/variant.h"
+#include "mvvm/model/mvvm_types.h"
+#include "mvvm/model/tagrow.h"
+#include "mvvm/model_export.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ModelView {
+
+class SessionModel;
+
+//! Queue of SessionModel changes, requested from worker threads and applied in the thread owning
+//! the model.
+
+//! Worker threads enqueue data changes and item insertions, addressing items by their
+//! identifiers. The thread owning the model (normally, the GUI thread) drains the queue in batches
+//! of bounded size, so the cost of every call stays limited no matter how fast workers produce
+//! updates. Repeated changes of the same item's role, which weren't applied yet, are collapsed:
+//! the pending change gets the new value and keeps its place in the queue. Changes are never
+//! collapsed across an insertion, so the order of data changes relative to insertions is kept.
+//! Changes of items, which don't exist anymore when the queue is drained, and invalid updates,
+//! which the model rejects, are discarded.
+
+class MVVM_MODEL_EXPORT ModelUpdateQueue {
+public:
+    using callback_t = std::function<void()>;
+
+    explicit ModelUpdateQueue(SessionModel* model);
+    ~ModelUpdateQueue();
+
+    ModelUpdateQueue(const ModelUpdateQueue& other) = delete;
+    ModelUpdateQueue& operator=(const ModelUpdateQueue& other) = delete;
+
+    // Methods which can be called from any thread.
+
+    void setData(const identifier_type& identifier, const Variant& value,
+                 int role = ItemDataRole::DATA);
+
+    void setArray(const identifier_type& identifier, std::vector<double> values,
+                  int role = ItemDataRole::DATA);
+
+    void insertItem(const model_type& modelType, const identifier_type& parent_identifier,
+                    const TagRow& tagrow = {});
+
+    void setOnUpdatesPending(callback_t callback);
+
+    size_t size() const;
+
+    bool empty() const;
+
+    void clear();
+
+    // Methods to call from the thread owning the model.
+
+    size_t process(size_t max_count);
+
+    size_t processAll();
+
+private:
+    struct ModelUpdateQueueImpl;
+    std::unique_ptr<ModelUpdateQueueImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_MODELUPDATEQUEUE_H
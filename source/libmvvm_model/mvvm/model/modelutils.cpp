@@ -9,6 +9,7 @@
 
 #include "mvvm/model/modelutils.h"
 #include "mvvm/interfaces/undostackinterface.h"
+#include "mvvm/model/directitemcopystrategy.h"
 #include "mvvm/model/path.h"
 #include <QJsonObject>
 
@@ -46,6 +47,17 @@ void Utils::PopulateEmptyModel(const JsonModelConverterInterface* converter,
     converter->from_json(object, target);
 }
 
+void Utils::PopulateEmptyModel(const SessionModel& source, SessionModel& target,
+                               ConverterMode mode)
+{
+    DirectItemCopyStrategy strategy(target.factory(), mode);
+    auto rebuild_root = [&source, &strategy](auto parent) {
+        for (auto item : source.rootItem()->children())
+            parent->insertItem(strategy.createCopy(item), TagRow::append());
+    };
+    target.clear(rebuild_root);
+}
+
 void Utils::DeleteItemFromModel(SessionItem* item)
 {
     auto model = item->model();
@@ -15,6 +15,7 @@
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/model_export.h"
+#include "mvvm/serialization/jsonitem_types.h"
 #include <memory>
 #include <vector>
 
@@ -72,12 +73,17 @@ MVVM_MODEL_EXPORT SessionItem* ItemFromPath(const SessionModel& moodel, const Pa
 MVVM_MODEL_EXPORT void PopulateEmptyModel(const JsonModelConverterInterface* converter,
                                           const SessionModel& source, SessionModel& target);
 
+//! Populate empty model with deep copies of top level items of source model. Items are copied
+//! directly, without intermediate JSON, with identifiers regenerated or preserved according to
+//! the mode.
+MVVM_MODEL_EXPORT void PopulateEmptyModel(const SessionModel& source, SessionModel& target,
+                                          ConverterMode mode);
+
 //! Creates full deep copy of given model. All item's ID will be generated.
 template <typename T = SessionModel> std::unique_ptr<T> CreateCopy(const T& model)
 {
     auto result = std::make_unique<T>();
-    auto converter = CreateModelCopyConverter();
-    PopulateEmptyModel(converter.get(), model, *result.get());
+    PopulateEmptyModel(model, *result.get(), ConverterMode::copy);
     return result;
 }
 
@@ -85,8 +91,7 @@ template <typename T = SessionModel> std::unique_ptr<T> CreateCopy(const T& mode
 template <typename T = SessionModel> std::unique_ptr<T> CreateClone(const T& model)
 {
     auto result = std::make_unique<T>();
-    auto converter = CreateModelCloneConverter();
-    PopulateEmptyModel(converter.get(), model, *result.get());
+    PopulateEmptyModel(model, *result.get(), ConverterMode::clone);
     return result;
 }
 
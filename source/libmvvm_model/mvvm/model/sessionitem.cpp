@@ -9,9 +9,13 @@
 
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/core/uniqueidgenerator.h"
+#include "mvvm/model/identifierloadingscope.h"
+#include "mvvm/model/itemarena.h"
+#include "mvvm/model/sessionitemcontainer.h"
 #include "mvvm/model/sessionitemdata.h"
 #include "mvvm/model/sessionitemtags.h"
 #include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/snapshotitem.h"
 #include "mvvm/model/taginfo.h"
 #include "mvvm/signals/itemmapper.h"
 #include "mvvm/signals/modelmapper.h"
@@ -36,6 +40,7 @@ struct SessionItem::SessionItemImpl {
     std::unique_ptr<SessionItemData> m_data;
     std::unique_ptr<SessionItemTags> m_tags;
     model_type m_modelType;
+    std::weak_ptr<const SnapshotItem> m_snapshot; //! reset on changes of the item or descendants
 
     SessionItemImpl(SessionItem* this_item)
         : m_self(this_item)
@@ -44,19 +49,38 @@ struct SessionItem::SessionItemImpl {
     {
     }
 
+    static void* operator new(size_t size) { return ItemArena::allocate(size); }
+    static void operator delete(void* ptr) { ItemArena::deallocate(ptr); }
+
     bool do_setData(const Variant& variant, int role)
     {
         bool result = m_data->setData(variant, role);
+        if (result)
+            invalidate_snapshot();
         if (result && m_model)
             m_model->mapper()->callOnDataChange(m_self, role);
         return result;
     }
+
+    //! Drops snapshots of this item and its ancestors, since they don't reflect the change anymore.
+    //! Snapshot of the item is alive only if snapshots of all its descendants are (it holds them),
+    //! so the walk stops at the first ancestor without one.
+    void invalidate_snapshot()
+    {
+        for (auto item = m_self; item && !item->p_impl->m_snapshot.expired();
+             item = item->p_impl->m_parent)
+            item->p_impl->m_snapshot.reset();
+    }
 };
 
+//! Constructs item of given type. Items constructed by loaders (see IdentifierLoadingScope) get
+//! their identifiers from disk, so no throwaway identifier is generated for them.
+
 SessionItem::SessionItem(model_type modelType) : p_impl(std::make_unique<SessionItemImpl>(this))
 {
     p_impl->m_modelType = std::move(modelType);
-    setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER);
+    if (!IdentifierLoadingScope::isActive())
+        setData(UniqueIdGenerator::generate(), ItemDataRole::IDENTIFIER);
     setData(p_impl->m_modelType, ItemDataRole::DISPLAY);
 }
 
@@ -69,6 +93,18 @@ SessionItem::~SessionItem()
         p_impl->m_model->unregisterFromPool(this);
 }
 
+//! Allocates SessionItem in the item arena, which is current for the calling thread, if any.
+
+void* SessionItem::operator new(size_t size)
+{
+    return ItemArena::allocate(size);
+}
+
+void SessionItem::operator delete(void* ptr)
+{
+    ItemArena::deallocate(ptr);
+}
+
 //! Returns item's model type.
 
 model_type SessionItem::modelType() const
@@ -157,21 +193,21 @@ std::vector<SessionItem*> SessionItem::children() const
 
 //! Returns number of items in given tag.
 
-int SessionItem::itemCount(const std::string& tag) const
+int SessionItem::itemCount(const TagName& tag) const
 {
     return p_impl->m_tags->itemCount(tag);
 }
 
 //! Returns item at given row of given tag.
 
-SessionItem* SessionItem::getItem(const std::string& tag, int row) const
+SessionItem* SessionItem::getItem(const TagName& tag, int row) const
 {
     return p_impl->m_tags->getItem({tag, row});
 }
 
 //! Returns all children stored at given tag.
 
-std::vector<SessionItem*> SessionItem::getItems(const std::string& tag) const
+std::vector<SessionItem*> SessionItem::getItems(const TagName& tag) const
 {
     return p_impl->m_tags->getItems(tag);
 }
@@ -196,6 +232,7 @@ const SessionItemTags* SessionItem::itemTags() const
 void SessionItem::registerTag(const TagInfo& tagInfo, bool set_as_default)
 {
     p_impl->m_tags->registerTag(tagInfo, set_as_default);
+    p_impl->invalidate_snapshot();
 }
 
 //! Returns pointer to internal collection of tag-registered items (non-const version).
@@ -234,16 +271,18 @@ SessionItem* SessionItem::insertItem(std::unique_ptr<SessionItem> item, const Ta
     if (!p_impl->m_tags->canInsertItem(item.get(), tagrow))
         throw std::runtime_error("SessionItem::insertItem() -> Can't insert item.");
 
+    // resolving default tag and appending row in advance, to not search for the item afterwards
+    const auto tag = tagrow.tag.empty() ? p_impl->m_tags->defaultTag() : tagrow.tag;
+    const TagRow actual_tagrow{tag, tagrow.row < 0 ? p_impl->m_tags->itemCount(tag) : tagrow.row};
+
     auto result = item.release();
-    p_impl->m_tags->insertItem(result, tagrow);
+    p_impl->m_tags->insertItem(result, actual_tagrow);
     result->setParent(this);
     result->setModel(model());
+    p_impl->invalidate_snapshot();
 
-    if (p_impl->m_model) {
-        // FIXME think of actual_tagrow removal if input tag,row will be always valid
-        auto actual_tagrow = tagRowOfItem(result);
+    if (p_impl->m_model)
         p_impl->m_model->mapper()->callOnItemInserted(this, actual_tagrow);
-    }
 
     return result;
 }
@@ -257,15 +296,18 @@ std::unique_ptr<SessionItem> SessionItem::takeItem(const TagRow& tagrow)
     if (!p_impl->m_tags->canTakeItem(tagrow))
         return {};
 
+    const auto tag = tagrow.tag.empty() ? p_impl->m_tags->defaultTag() : tagrow.tag;
+    const TagRow actual_tagrow{tag, tagrow.row};
+
     if (p_impl->m_model)
-        p_impl->m_model->mapper()->callOnItemAboutToBeRemoved(this, tagrow);
+        p_impl->m_model->mapper()->callOnItemAboutToBeRemoved(this, actual_tagrow);
 
-    auto result = p_impl->m_tags->takeItem(tagrow);
+    auto result = p_impl->m_tags->takeItem(actual_tagrow);
     result->setParent(nullptr);
     result->setModel(nullptr);
-    // FIXME remaining problem is that ItemMapper still looking to the model
+    p_impl->invalidate_snapshot();
     if (p_impl->m_model)
-        p_impl->m_model->mapper()->callOnItemRemoved(this, tagrow);
+        p_impl->m_model->mapper()->callOnItemRemoved(this, actual_tagrow);
 
     return std::unique_ptr<SessionItem>(result);
 }
@@ -367,7 +409,7 @@ bool SessionItem::set_data_internal(const Variant& value, int role, bool direct)
 //! Returns data for given role. Method invented to hide implementaiton details and avoid
 //! placing sessionitemdata.h into 'sessionitem.h' header.
 
-Variant SessionItem::data_internal(int role) const
+const Variant& SessionItem::data_internal(int role) const
 {
     return p_impl->m_data->data(role);
 }
@@ -387,10 +429,27 @@ void SessionItem::setModel(SessionModel* model)
     if (p_impl->m_model)
         p_impl->m_model->registerInPool(this);
 
+    if (p_impl->m_mapper)
+        p_impl->m_mapper->setModel(model);
+
     for (auto child : children())
         child->setModel(model);
 }
 
+//! Notifies subscribers of the item and all its descendants, as if items were destroyed, and
+//! removes mappers. Used by undo framework to keep removed items alive without listeners.
+
+void SessionItem::releaseMappers()
+{
+    if (p_impl->m_mapper) {
+        p_impl->m_mapper->callOnItemDestroy();
+        p_impl->m_mapper.reset();
+    }
+
+    for (auto child : children())
+        child->releaseMappers();
+}
+
 void SessionItem::setAppearanceFlag(int flag, bool value)
 {
     int flags = appearance(*this);
@@ -414,9 +473,43 @@ ItemMapper* SessionItem::mapper()
     return p_impl->m_mapper.get();
 }
 
+//! Returns immutable snapshot of the item and its descendants. Must be called from the thread
+//! owning the item.
+
+//! Item refers to its snapshot weakly, so snapshots don't take memory once released by their
+//! users. While the snapshot is alive, it is reused by the next call, unless the item or its
+//! descendants changed. Snapshot of the changed item is rebuilt together with snapshots of its
+//! ancestors: each copies its data and the list of its children, so the cost is proportional to
+//! the number of changed items times their depth and fan-out.
+
+std::shared_ptr<const SnapshotItem> SessionItem::snapshot() const
+{
+    if (auto cached = p_impl->m_snapshot.lock())
+        return cached;
+
+    // not made by make_shared, so the weak reference doesn't hold memory of the released snapshot
+    std::shared_ptr<SnapshotItem> result(new SnapshotItem);
+    result->m_modelType = p_impl->m_modelType;
+    result->m_data = *p_impl->m_data;
+    result->m_default_tag = p_impl->m_tags->defaultTag();
+    for (auto container : *p_impl->m_tags) {
+        const int count = container->itemCount();
+        result->m_tags.push_back(
+            {container->tagInfo().name(), result->m_children.size(), static_cast<size_t>(count)});
+        for (int row = 0; row < count; ++row)
+            result->m_children.push_back(container->itemAt(row)->snapshot());
+    }
+
+    p_impl->m_snapshot = result;
+    return result;
+}
+
+//! Replaces data and tags of the item. Caller is responsible for the identifier in the new data.
+
 void SessionItem::setDataAndTags(std::unique_ptr<SessionItemData> data,
                                  std::unique_ptr<SessionItemTags> tags)
 {
     p_impl->m_data = std::move(data);
     p_impl->m_tags = std::move(tags);
+    p_impl->invalidate_snapshot();
 }
@@ -26,6 +26,7 @@ class TagInfo;
 class ItemMapper;
 class SessionItemData;
 class SessionItemTags;
+class SnapshotItem;
 
 //! The main object representing an editable/displayable/serializable entity. Serves as a
 //! construction element (node) of SessionModel to represent all the data of GUI application.
@@ -37,6 +38,9 @@ public:
     SessionItem(const SessionItem&) = delete;
     SessionItem& operator=(const SessionItem&) = delete;
 
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
     // basic item properties
 
     model_type modelType() const;
@@ -58,6 +62,8 @@ public:
 
     template <typename T> T data(int role = ItemDataRole::DATA) const;
 
+    template <typename T> const T& dataRef(int role = ItemDataRole::DATA) const;
+
     template <typename T>
     bool setData(const T& value, int role = ItemDataRole::DATA, bool direct = false);
 
@@ -70,14 +76,14 @@ public:
 
     std::vector<SessionItem*> children() const;
 
-    int itemCount(const std::string& tag) const;
+    int itemCount(const TagName& tag) const;
 
-    SessionItem* getItem(const std::string& tag, int row = 0) const;
+    SessionItem* getItem(const TagName& tag, int row = 0) const;
 
-    std::vector<SessionItem*> getItems(const std::string& tag) const;
+    std::vector<SessionItem*> getItems(const TagName& tag) const;
 
-    template <typename T> T* item(const std::string& tag) const;
-    template <typename T = SessionItem> std::vector<T*> items(const std::string& tag) const;
+    template <typename T> T* item(const TagName& tag) const;
+    template <typename T = SessionItem> std::vector<T*> items(const TagName& tag) const;
 
     TagRow tagRowOfItem(const SessionItem* item) const;
 
@@ -112,20 +118,28 @@ public:
     std::string editorType() const;
     SessionItem* setEditorType(const std::string& editor_type);
 
-    template <typename T> T property(const std::string& tag) const;
-    template <typename T> void setProperty(const std::string& tag, const T& value);
-    void setProperty(const std::string& tag, const char* value);
+    template <typename T> T property(const TagName& tag) const;
+    template <typename T> void setProperty(const TagName& tag, const T& value);
+    void setProperty(const TagName& tag, const char* value);
 
     ItemMapper* mapper();
 
+    std::shared_ptr<const SnapshotItem> snapshot() const;
+
 private:
     friend class SessionModel;
     friend class JsonItemConverter;
+    friend class BinaryItemConverter;
+    friend class CopyItemCommand;
+    friend class DirectItemCopyStrategy;
+    friend class InsertNewItemCommand;
+    friend class RemoveItemCommand;
     virtual void activate() {}
     bool set_data_internal(const Variant& value, int role, bool direct);
-    Variant data_internal(int role) const;
+    const Variant& data_internal(int role) const;
     void setParent(SessionItem* parent);
     void setModel(SessionModel* model);
+    void releaseMappers();
     void setAppearanceFlag(int flag, bool value);
 
     void setDataAndTags(std::unique_ptr<SessionItemData> data,
@@ -151,10 +165,22 @@ template <typename T> inline T SessionItem::data(int role) const
     return data_internal(role).value<T>();
 }
 
+//! Returns reference to the data of given type T for given role without copying it.
+//! Reference stays valid until the data is changed. Throws, if there is no data of type T.
+
+template <typename T> inline const T& SessionItem::dataRef(int role) const
+{
+    const Variant& variant = data_internal(role);
+    if (variant.userType() != qMetaTypeId<T>())
+        throw std::runtime_error("Error in SessionItem: no data of requested type for role "
+                                 + std::to_string(role));
+    return *static_cast<const T*>(variant.constData());
+}
+
 //! Returns first item under given tag casted to a specified type.
 //! Returns nullptr, if item doesn't exist. If item exists but can't be casted will throw.
 
-template <typename T> inline T* SessionItem::item(const std::string& tag) const
+template <typename T> inline T* SessionItem::item(const TagName& tag) const
 {
     if (auto item = getItem(tag); item) {
         T* tag_item = dynamic_cast<T*>(item);
@@ -167,7 +193,7 @@ template <typename T> inline T* SessionItem::item(const std::string& tag) const
 
 //! Returns all items under given tag casted to specific type.
 
-template <typename T> std::vector<T*> SessionItem::items(const std::string& tag) const
+template <typename T> std::vector<T*> SessionItem::items(const TagName& tag) const
 {
     std::vector<T*> result;
     for (auto item : getItems(tag))
@@ -187,7 +213,7 @@ template <typename T> inline T* SessionItem::insertItem(const TagRow& tagrow)
 //! Returns data stored in property item.
 //! Property is single item registered under certain tag via CompoundItem::addProperty method.
 
-template <typename T> inline T SessionItem::property(const std::string& tag) const
+template <typename T> inline T SessionItem::property(const TagName& tag) const
 {
     return getItem(tag)->data<T>();
 }
@@ -196,7 +222,7 @@ template <typename T> inline T SessionItem::property(const std::string& tag) con
 //! Property is single item registered under certain tag via CompoundItem::addProperty method, the
 //! value will be assigned to it's data role.
 
-template <typename T> inline void SessionItem::setProperty(const std::string& tag, const T& value)
+template <typename T> inline void SessionItem::setProperty(const TagName& tag, const T& value)
 {
     getItem(tag)->setData(value);
 }
@@ -205,7 +231,7 @@ template <typename T> inline void SessionItem::setProperty(const std::string& ta
 //! Property is single item registered under certain tag via CompoundItem::addProperty method, the
 //! value will be assigned to it's data role.
 
-inline void SessionItem::setProperty(const std::string& tag, const char* value)
+inline void SessionItem::setProperty(const TagName& tag, const char* value)
 {
     setProperty(tag, std::string(value));
 }
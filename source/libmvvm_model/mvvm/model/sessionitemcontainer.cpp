@@ -8,13 +8,14 @@
 // ************************************************************************** //
 
 #include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/utils/containerutils.h"
 
 using namespace ModelView;
 
 SessionItemContainer::SessionItemContainer(ModelView::TagInfo tag_info)
-    : m_tag_info(std::move(tag_info))
+    : m_tag_info(std::move(tag_info)), m_tag_name(m_tag_info.name())
 {
 }
 
@@ -24,6 +25,18 @@ SessionItemContainer::~SessionItemContainer()
         delete item;
 }
 
+//! Allocates SessionItemContainer in the item arena, which is current for the calling thread, if any.
+
+void* SessionItemContainer::operator new(size_t size)
+{
+    return ItemArena::allocate(size);
+}
+
+void SessionItemContainer::operator delete(void* ptr)
+{
+    ItemArena::deallocate(ptr);
+}
+
 bool SessionItemContainer::empty() const
 {
     return m_items.empty();
@@ -82,6 +95,15 @@ bool SessionItemContainer::canTakeItem(int index) const
     return itemAt(index) && !minimum_reached();
 }
 
+//! Returns true if 'count' items starting from given index can be taken.
+
+bool SessionItemContainer::canTakeItems(int index, int count) const
+{
+    const bool valid_range = index >= 0 && count > 0 && index + count <= itemCount();
+    const bool enough_items = m_tag_info.min() == -1 || itemCount() - count >= m_tag_info.min();
+    return valid_range && enough_items;
+}
+
 //! Returns true if given item can be inserted under given index.
 
 bool SessionItemContainer::canInsertItem(const SessionItem* item, int index) const
@@ -113,7 +135,14 @@ std::string SessionItemContainer::name() const
     return m_tag_info.name();
 }
 
-TagInfo SessionItemContainer::tagInfo() const
+//! Returns interned name of the container.
+
+const TagName& SessionItemContainer::tagName() const
+{
+    return m_tag_name;
+}
+
+const TagInfo& SessionItemContainer::tagInfo() const
 {
     return m_tag_info;
 }
@@ -10,6 +10,7 @@
 #ifndef MVVM_MODEL_SESSIONITEMCONTAINER_H
 #define MVVM_MODEL_SESSIONITEMCONTAINER_H
 
+#include "mvvm/model/tagname.h"
 #include "mvvm/model/taginfo.h"
 #include "mvvm/model_export.h"
 #include <vector>
@@ -30,6 +31,9 @@ public:
     SessionItemContainer& operator=(const SessionItemContainer&) = delete;
     ~SessionItemContainer();
 
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
     bool empty() const;
 
     int itemCount() const;
@@ -42,6 +46,8 @@ public:
 
     bool canTakeItem(int index) const;
 
+    bool canTakeItems(int index, int count) const;
+
     bool canInsertItem(const SessionItem* item, int index) const;
 
     int indexOfItem(const SessionItem* item) const;
@@ -50,7 +56,9 @@ public:
 
     std::string name() const;
 
-    TagInfo tagInfo() const;
+    const TagName& tagName() const;
+
+    const TagInfo& tagInfo() const;
 
     const_iterator begin() const;
 
@@ -61,6 +69,7 @@ private:
     bool minimum_reached() const;
     bool is_valid_item(const SessionItem* item) const;
     TagInfo m_tag_info;
+    TagName m_tag_name;
     container_t m_items;
 };
 
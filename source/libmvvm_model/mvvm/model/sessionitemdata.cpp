@@ -9,27 +9,46 @@
 
 #include "mvvm/model/sessionitemdata.h"
 #include "mvvm/model/customvariants.h"
+#include "mvvm/model/itemarena.h"
 #include <algorithm>
 #include <sstream>
 #include <stdexcept>
 
 using namespace ModelView;
 
+//! Allocates SessionItemData in the item arena, which is current for the calling thread, if any.
+
+void* SessionItemData::operator new(size_t size)
+{
+    return ItemArena::allocate(size);
+}
+
+void SessionItemData::operator delete(void* ptr)
+{
+    ItemArena::deallocate(ptr);
+}
+
+SessionItemData::SessionItemData()
+{
+    m_role_index.fill(-1);
+}
+
 std::vector<int> SessionItemData::roles() const
 {
     std::vector<int> result;
+    result.reserve(m_values.size());
     for (const auto& value : m_values)
         result.push_back(value.m_role);
     return result;
 }
 
-Variant SessionItemData::data(int role) const
+//! Returns the data for given role. Returned reference stays valid until the data is changed.
+
+const Variant& SessionItemData::data(int role) const
 {
-    for (const auto& value : m_values) {
-        if (value.m_role == role)
-            return value.m_data;
-    }
-    return Variant();
+    static const Variant invalid_variant;
+    const int index = index_of(role);
+    return index < 0 ? invalid_variant : m_values[index].m_data;
 }
 
 //! Sets the data for given role. Returns true if data was changed.
@@ -39,20 +58,28 @@ bool SessionItemData::setData(const Variant& value, int role)
 {
     assure_validity(value, role);
 
-    for (auto it = m_values.begin(); it != m_values.end(); ++it) {
-        if (it->m_role == role) {
-            if (value.isValid()) {
-                if (Utils::IsTheSame(it->m_data, value))
-                    return false;
-                it->m_data = value;
-            }
-            else {
-                m_values.erase(it);
-            }
-            return true;
-        }
+    const int index = index_of(role);
+    if (index < 0) {
+        if (is_indexed(role))
+            m_role_index[role] = static_cast<int16_t>(m_values.size());
+        m_values.push_back(DataRole(value, role));
+        return true;
     }
-    m_values.push_back(DataRole(value, role));
+
+    auto& existing = m_values[index];
+    if (value.isValid()) {
+        if (Utils::IsTheSame(existing.m_data, value))
+            return false;
+        existing.m_data = value;
+        return true;
+    }
+
+    m_values.erase(m_values.begin() + index);
+    if (is_indexed(role))
+        m_role_index[role] = -1;
+    for (auto& position : m_role_index)
+        if (position > index)
+            --position;
     return true;
 }
 
@@ -70,21 +97,41 @@ SessionItemData::const_iterator SessionItemData::end() const
 
 bool SessionItemData::hasData(int role) const
 {
-    auto has_role = [role](const auto& x) { return x.m_role == role; };
-    return std::find_if(m_values.begin(), m_values.end(), has_role) != m_values.end();
+    return index_of(role) >= 0;
+}
+
+//! Returns true if position of given role is indexed.
+
+bool SessionItemData::is_indexed(int role)
+{
+    return role >= 0 && role < indexed_role_count;
+}
+
+//! Returns position of given role in the container, or -1 if there is no such role.
+
+int SessionItemData::index_of(int role) const
+{
+    if (is_indexed(role))
+        return m_role_index[role];
+
+    for (size_t index = 0; index < m_values.size(); ++index)
+        if (m_values[index].m_role == role)
+            return static_cast<int>(index);
+    return -1;
 }
 
 //! Check if variant is compatible
 
-void SessionItemData::assure_validity(const Variant& variant, int role)
+void SessionItemData::assure_validity(const Variant& variant, int role) const
 {
-    if (variant.typeName() == QStringLiteral("QString"))
+    if (variant.userType() == QMetaType::QString)
         throw std::runtime_error("Attempt to set QString based variant");
 
-    if (!Utils::CompatibleVariantTypes(data(role), variant)) {
+    const auto& existing = data(role);
+    if (!Utils::CompatibleVariantTypes(existing, variant)) {
         std::ostringstream ostr;
         ostr << "SessionItemData::assure_validity() -> Error. Variant types mismatch. "
-             << "Old variant type '" << data(role).typeName() << "' "
+             << "Old variant type '" << existing.typeName() << "' "
              << "new variant type '" << variant.typeName() << "\n";
         throw std::runtime_error(ostr.str());
     }
@@ -11,21 +11,34 @@
 #define MVVM_MODEL_SESSIONITEMDATA_H
 
 #include "mvvm/model/datarole.h"
+#include "mvvm/model/mvvm_types.h"
 #include "mvvm/model_export.h"
+#include "mvvm/utils/smallvector.h"
+#include <array>
+#include <cstdint>
 #include <vector>
 
 namespace ModelView {
 
 //! Handles data roles for SessionItem.
 
+//! Roles are kept in the order of their appearance. Storage for the first few roles is
+//! located inside the object itself. Positions of predefined ItemDataRole's are indexed, so their
+//! lookup doesn't depend on the number of roles.
+
 class MVVM_MODEL_EXPORT SessionItemData {
 public:
-    using container_type = std::vector<DataRole>;
+    using container_type = SmallVector<DataRole, 4>;
     using const_iterator = container_type::const_iterator;
 
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
+    SessionItemData();
+
     std::vector<int> roles() const;
 
-    Variant data(int role) const;
+    const Variant& data(int role) const;
 
     bool setData(const Variant& value, int role);
 
@@ -35,8 +48,13 @@ public:
     bool hasData(int role) const;
 
 private:
-    void assure_validity(const Variant& variant, int role);
+    static constexpr int indexed_role_count = ItemDataRole::EDITORTYPE + 1;
+
+    static bool is_indexed(int role);
+    int index_of(int role) const;
+    void assure_validity(const Variant& variant, int role) const;
     container_type m_values;
+    std::array<int16_t, indexed_role_count> m_role_index; //!< position in m_values or -1
 };
 
 } // namespace ModelView
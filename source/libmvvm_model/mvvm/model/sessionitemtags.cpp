@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include "mvvm/model/sessionitemtags.h"
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/sessionitemcontainer.h"
 #include <stdexcept>
 
@@ -21,40 +22,58 @@ SessionItemTags::~SessionItemTags()
         delete tag;
 }
 
+//! Allocates SessionItemTags in the item arena, which is current for the calling thread, if any.
+
+void* SessionItemTags::operator new(size_t size)
+{
+    return ItemArena::allocate(size);
+}
+
+void SessionItemTags::operator delete(void* ptr)
+{
+    ItemArena::deallocate(ptr);
+}
+
 void SessionItemTags::registerTag(const TagInfo& tagInfo, bool set_as_default)
 {
     if (isTag(tagInfo.name()))
         throw std::runtime_error("SessionItemTags::registerTag() -> Error. Existing name '"
                                  + tagInfo.name() + "'");
 
-    m_containers.push_back(new SessionItemContainer(tagInfo));
+    auto container = new SessionItemContainer(tagInfo);
+    m_containers.push_back(container);
+    if (m_containers.size() > linear_search_limit) {
+        if (m_index.empty())
+            for (auto x : m_containers)
+                m_index.insert(x->tagName().id(), x);
+        else
+            m_index.insert(container->tagName().id(), container);
+    }
+
     if (set_as_default)
-        m_default_tag = tagInfo.name();
+        m_default_tag = container->tagName();
 }
 
 //! Returns true if container with such name exists.
 
-bool SessionItemTags::isTag(const std::string& name) const
+bool SessionItemTags::isTag(const TagName& name) const
 {
-    for (auto tag : m_containers)
-        if (tag->name() == name)
-            return true;
-    return false;
+    return find_container(name) != nullptr;
 }
 
 //! Returns the name of the default tag.
 
-std::string SessionItemTags::defaultTag() const
+TagName SessionItemTags::defaultTag() const
 {
     return m_default_tag;
 }
 
-void SessionItemTags::setDefaultTag(const std::string& name)
+void SessionItemTags::setDefaultTag(const TagName& name)
 {
     m_default_tag = name;
 }
 
-int SessionItemTags::itemCount(const std::string& tag_name) const
+int SessionItemTags::itemCount(const TagName& tag_name) const
 {
     return container(tag_name)->itemCount();
 }
@@ -87,6 +106,13 @@ bool SessionItemTags::canTakeItem(const TagRow& tagrow) const
     return container(tagrow.tag)->canTakeItem(tagrow.row);
 }
 
+//! Returns true if 'count' items starting from given tagrow can be taken.
+
+bool SessionItemTags::canTakeItems(const TagRow& tagrow, int count) const
+{
+    return container(tagrow.tag)->canTakeItems(tagrow.row, count);
+}
+
 //! Removes item at given row and for given tag, returns it to the user.
 
 SessionItem* SessionItemTags::takeItem(const TagRow& tagrow)
@@ -104,7 +130,7 @@ SessionItem* SessionItemTags::getItem(const TagRow& tagrow) const
 //! Returns vector of items in the container with given name.
 //! If tag name is empty, default tag will be used.
 
-std::vector<SessionItem*> SessionItemTags::getItems(const std::string& tag) const
+std::vector<SessionItem*> SessionItemTags::getItems(const TagName& tag) const
 {
     return container(tag)->items();
 }
@@ -112,10 +138,8 @@ std::vector<SessionItem*> SessionItemTags::getItems(const std::string& tag) cons
 std::vector<SessionItem*> SessionItemTags::allitems() const
 {
     std::vector<SessionItem*> result;
-    for (auto cont : m_containers) {
-        auto container_items = cont->items();
-        result.insert(result.end(), container_items.begin(), container_items.end());
-    }
+    for (auto cont : m_containers)
+        result.insert(result.end(), cont->begin(), cont->end());
 
     return result;
 }
@@ -127,12 +151,25 @@ TagRow SessionItemTags::tagRowOfItem(const SessionItem* item) const
     for (auto cont : m_containers) {
         int row = cont->indexOfItem(item);
         if (row != -1)
-            return {cont->name(), row};
+            return {cont->tagName(), row};
     }
 
     return {};
 }
 
+//! Calls visitor for every item in the order of containers, together with the container of the
+//! item and its row there. Visits all items in a single pass, contrary to the sequence of
+//! tagRowOfItem calls, which has to search for every item anew.
+
+void SessionItemTags::forEachItem(const visitor_t& visitor) const
+{
+    for (auto cont : m_containers) {
+        int row{0};
+        for (auto item : *cont)
+            visitor(item, *cont, row++);
+    }
+}
+
 SessionItemTags::const_iterator SessionItemTags::begin() const
 {
     return m_containers.begin();
@@ -145,7 +182,7 @@ SessionItemTags::const_iterator SessionItemTags::end() const
 
 //! Returns true if given tag corresponds to registered single property tag.
 
-bool SessionItemTags::isSinglePropertyTag(const std::string& tag) const
+bool SessionItemTags::isSinglePropertyTag(const TagName& tag) const
 {
     auto cont = find_container(tag);
     return cont ? cont->tagInfo().isSinglePropertyTag() : false;
@@ -166,23 +203,29 @@ SessionItemContainer& SessionItemTags::at(int index)
 //! Returns container corresponding to given tag name. If name is empty,
 //! default tag will be used. Exception is thrown if no such tag exists.
 
-SessionItemContainer* SessionItemTags::container(const std::string& tag_name) const
+SessionItemContainer* SessionItemTags::container(const TagName& tag_name) const
 {
-    std::string tagName = tag_name.empty() ? defaultTag() : tag_name;
-    auto container = find_container(tagName);
+    const TagName& name = tag_name.empty() ? m_default_tag : tag_name;
+    auto container = find_container(name);
     if (!container)
         throw std::runtime_error("SessionItemTags::container() -> Error. No such container '"
-                                 + tagName + "'");
+                                 + name.name() + "'");
 
     return container;
 }
 
-//! Returns container corresponding to given tag name.
+//! Returns container corresponding to given tag name. Tags are compared by their identifiers,
+//! items with many tags use the hash index.
 
-SessionItemContainer* SessionItemTags::find_container(const std::string& tag_name) const
+SessionItemContainer* SessionItemTags::find_container(const TagName& tag_name) const
 {
+    if (!m_index.empty()) {
+        auto result = m_index.find(tag_name.id());
+        return result ? *result : nullptr;
+    }
+
     for (auto cont : m_containers)
-        if (cont->name() == tag_name)
+        if (cont->tagName() == tag_name)
             return cont;
 
     return nullptr;
@@ -12,6 +12,8 @@
 
 #include "mvvm/model/tagrow.h"
 #include "mvvm/model_export.h"
+#include "mvvm/utils/openhashmap.h"
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -27,23 +29,28 @@ class MVVM_MODEL_EXPORT SessionItemTags {
 public:
     using container_t = std::vector<SessionItemContainer*>;
     using const_iterator = container_t::const_iterator;
+    using visitor_t =
+        std::function<void(SessionItem* item, const SessionItemContainer& container, int row)>;
 
     SessionItemTags();
     ~SessionItemTags();
     SessionItemTags(const SessionItemTags&) = delete;
     SessionItemTags& operator=(const SessionItemTags&) = delete;
 
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
     // tag
 
     void registerTag(const TagInfo& tagInfo, bool set_as_default = false);
 
-    bool isTag(const std::string& name) const;
+    bool isTag(const TagName& name) const;
 
-    std::string defaultTag() const;
+    TagName defaultTag() const;
 
-    void setDefaultTag(const std::string& name);
+    void setDefaultTag(const TagName& name);
 
-    int itemCount(const std::string& tag_name) const;
+    int itemCount(const TagName& tag_name) const;
 
     // adding and removal
 
@@ -53,31 +60,39 @@ public:
 
     bool canTakeItem(const TagRow& tagrow) const;
 
+    bool canTakeItems(const TagRow& tagrow, int count) const;
+
     SessionItem* takeItem(const TagRow& tagrow);
 
     // item access
     SessionItem* getItem(const TagRow& tagrow) const;
 
-    std::vector<SessionItem*> getItems(const std::string& tag = {}) const;
+    std::vector<SessionItem*> getItems(const TagName& tag = {}) const;
 
     std::vector<SessionItem*> allitems() const;
 
     TagRow tagRowOfItem(const SessionItem* item) const;
 
+    void forEachItem(const visitor_t& visitor) const;
+
     const_iterator begin() const;
     const_iterator end() const;
 
-    bool isSinglePropertyTag(const std::string& tag) const;
+    bool isSinglePropertyTag(const TagName& tag) const;
 
     int tagsCount() const;
 
     SessionItemContainer& at(int index);
 
 private:
-    SessionItemContainer* container(const std::string& tag_name) const;
-    SessionItemContainer* find_container(const std::string& tag_name) const;
+    //! Number of tags, after which lookup goes through the hash index instead of linear search.
+    static constexpr size_t linear_search_limit = 8;
+
+    SessionItemContainer* container(const TagName& tag_name) const;
+    SessionItemContainer* find_container(const TagName& tag_name) const;
     std::vector<SessionItemContainer*> m_containers;
-    std::string m_default_tag;
+    OpenHashMap<int, SessionItemContainer*> m_index; //!< tag identifier to container
+    TagName m_default_tag;
 };
 
 } // namespace ModelView
@@ -10,16 +10,43 @@
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/commands/commandservice.h"
 #include "mvvm/factories/itemcataloguefactory.h"
+#include "mvvm/model/itemarena.h"
 #include "mvvm/model/itemcatalogue.h"
 #include "mvvm/model/itemfactory.h"
 #include "mvvm/model/itemmanager.h"
 #include "mvvm/model/itempool.h"
+#include "mvvm/model/modeltransaction.h"
+#include "mvvm/model/modelutils.h"
 #include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemtags.h"
 #include "mvvm/model/taginfo.h"
 #include "mvvm/signals/modelmapper.h"
+#include <stdexcept>
 
 using namespace ModelView;
 
+namespace {
+
+//! Groups commands of the model into the undo macro for the time of its life, so the macro is
+//! closed even if one of commands throws.
+
+class MacroScope {
+public:
+    MacroScope(const SessionModel* model, const std::string& name) : m_model(model)
+    {
+        Utils::BeginMacros(m_model, name);
+    }
+    ~MacroScope() { Utils::EndMacros(m_model); }
+
+    MacroScope(const MacroScope& other) = delete;
+    MacroScope& operator=(const MacroScope& other) = delete;
+
+private:
+    const SessionModel* m_model{nullptr};
+};
+
+} // namespace
+
 //! Pimpl class for SessionModel.
 
 struct SessionModel::SessionModelImpl {
@@ -83,6 +110,17 @@ SessionItem* SessionModel::insertNewItem(const model_type& modelType, SessionIte
     return intern_insert(create_func, parent, tagrow);
 }
 
+//! Inserts 'count' new items of given modelType into given parent, starting from given tagrow.
+//! Listeners are notified about insertion of the whole range at once.
+
+std::vector<SessionItem*> SessionModel::insertNewItems(const model_type& modelType,
+                                                       SessionItem* parent, const TagRow& tagrow,
+                                                       int count)
+{
+    auto create_func = [this, modelType]() { return factory()->createItem(modelType); };
+    return intern_insert_items(create_func, parent, tagrow, count);
+}
+
 //! Removes given row from parent.
 
 void SessionModel::removeItem(SessionItem* parent, const TagRow& tagrow)
@@ -90,6 +128,37 @@ void SessionModel::removeItem(SessionItem* parent, const TagRow& tagrow)
     p_impl->m_commands->removeItem(parent, tagrow);
 }
 
+//! Removes 'count' items from parent, starting from given tagrow. Listeners are notified about
+//! removal of the whole range at once. If removal fails halfway, only removed items are reported.
+
+void SessionModel::removeItems(SessionItem* parent, const TagRow& tagrow, int count)
+{
+    if (!parent || parent->model() != this)
+        throw std::runtime_error("SessionModel::removeItems() -> Item doesn't belong to the model");
+
+    if (count <= 0)
+        return;
+
+    if (!parent->itemTags()->canTakeItems(tagrow, count))
+        throw std::runtime_error("SessionModel::removeItems() -> Can't remove items");
+
+    const auto tag = tagrow.tag.empty() ? parent->itemTags()->defaultTag() : tagrow.tag;
+    const int initial_count = parent->itemCount(tag);
+    mapper()->beginRemoveItems(parent, tag, tagrow.row, count);
+    try {
+        MacroScope macro(this, "Remove items");
+        // removing from the end, to not shift remaining items
+        for (int row = tagrow.row + count - 1; row >= tagrow.row; --row)
+            removeItem(parent, {tag, row});
+    } catch (...) {
+        // items were removed from the end, so only the tail of the range is gone
+        const int removed_count = initial_count - parent->itemCount(tag);
+        mapper()->endRemoveItems(tagrow.row + count - removed_count, removed_count);
+        throw;
+    }
+    mapper()->endRemoveItems();
+}
+
 //! Move item from it's current parent to a new parent under given tag and row.
 //! Old and new parents should belong to this model.
 
@@ -162,6 +231,13 @@ SessionItem* SessionModel::findItem(const identifier_type& id)
     return p_impl->m_itemManager->findItem(id);
 }
 
+//! Returns arena where items of this model are allocated, or nullptr if they live on the heap.
+
+ItemArena* SessionModel::itemArena() const
+{
+    return p_impl->m_itemManager->itemArena();
+}
+
 //! Sets brand new catalog of user-defined items. They become available for undo/redo and
 //! serialization. Internally user catalog will be merged with the catalog of standard items.
 
@@ -180,6 +256,18 @@ void SessionModel::setUndoRedoEnabled(bool value)
     p_impl->m_commands->setUndoRedoEnabled(value);
 }
 
+//! Sets per-model item arena either enabled or disabled. By default items are allocated on the
+//! heap. With the arena enabled, new items and their internal blocks are packed in large chunks,
+//! which are released all at once, when the model is cleared or destroyed. Items created before
+//! the call stay where they are.
+
+void SessionModel::setItemArenaEnabled(bool value)
+{
+    if (value == (itemArena() != nullptr))
+        return;
+    p_impl->m_itemManager->setItemArena(value ? std::make_shared<ItemArena>() : nullptr);
+}
+
 //! Removes all items from the model. If callback is provided, use it to rebuild content of root
 //! item (used while restoring the model from serialized content).
 
@@ -188,9 +276,14 @@ void SessionModel::clear(std::function<void(SessionItem*)> callback)
     if (undoStack())
         undoStack()->clear();
     mapper()->callOnModelAboutToBeReset();
+    // new content goes to a fresh arena, the old one dies together with the old content
+    if (itemArena())
+        p_impl->m_itemManager->setItemArena(std::make_shared<ItemArena>());
     p_impl->createRootItem();
-    if (callback)
+    if (callback) {
+        ItemArena::Scope scope(itemArena());
         callback(rootItem());
+    }
     mapper()->callOnModelReset();
 }
 
@@ -214,7 +307,39 @@ void SessionModel::unregisterFromPool(SessionItem* item)
 SessionItem* SessionModel::intern_insert(const item_factory_func_t& func, SessionItem* parent,
                                          const TagRow& tagrow)
 {
-    return p_impl->m_commands->insertNewItem(func, parent, tagrow);
+    if (!itemArena())
+        return p_impl->m_commands->insertNewItem(func, parent, tagrow);
+
+    // arena is looked up on every call, it might be replaced by the time the command is redone
+    auto arena_func = [this, func]() {
+        ItemArena::Scope scope(itemArena());
+        return func();
+    };
+    return p_impl->m_commands->insertNewItem(arena_func, parent, tagrow);
+}
+
+//! Inserts 'count' items created by factory function into given parent. Insertions are grouped in
+//! the transaction and undo macro. Stops on the first item which can't be inserted.
+
+std::vector<SessionItem*> SessionModel::intern_insert_items(const item_factory_func_t& func,
+                                                           SessionItem* parent,
+                                                           const TagRow& tagrow, int count)
+{
+    std::vector<SessionItem*> result;
+    if (count <= 0)
+        return result;
+
+    result.reserve(static_cast<size_t>(count));
+    ModelTransaction transaction(this);
+    MacroScope macro(this, "Insert items");
+    for (int i = 0; i < count; ++i) {
+        const int row = tagrow.row < 0 ? -1 : tagrow.row + i;
+        auto item = intern_insert(func, parent, {tagrow.tag, row});
+        if (!item)
+            break;
+        result.push_back(item);
+    }
+    return result;
 }
 
 void SessionModel::intern_register(const model_type& modelType, const item_factory_func_t& func,
@@ -21,6 +21,7 @@
 namespace ModelView {
 
 class SessionItem;
+class ItemArena;
 class ItemCatalogue;
 class ItemPool;
 class ModelMapper;
@@ -43,8 +44,16 @@ public:
 
     template <typename T> T* insertItem(SessionItem* parent = nullptr, const TagRow& tagrow = {});
 
+    std::vector<SessionItem*> insertNewItems(const model_type& modelType, SessionItem* parent,
+                                             const TagRow& tagrow, int count);
+
+    template <typename T>
+    std::vector<T*> insertItems(SessionItem* parent, const TagRow& tagrow, int count);
+
     void removeItem(SessionItem* parent, const TagRow& tagrow);
 
+    void removeItems(SessionItem* parent, const TagRow& tagrow, int count);
+
     void moveItem(SessionItem* item, SessionItem* new_parent, const TagRow& tagrow);
 
     SessionItem* copyItem(const SessionItem* item, SessionItem* parent, const TagRow& tagrow = {});
@@ -67,6 +76,8 @@ public:
 
     SessionItem* findItem(const identifier_type& id);
 
+    ItemArena* itemArena() const;
+
     template <typename T = SessionItem> std::vector<T*> topItems() const;
 
     template <typename T = SessionItem> T* topItem() const;
@@ -77,6 +88,8 @@ public:
 
     void setUndoRedoEnabled(bool value);
 
+    void setItemArenaEnabled(bool value);
+
     void clear(std::function<void(SessionItem*)> callback = {});
 
     template <typename T> void registerItem(const std::string& label = {});
@@ -87,6 +100,9 @@ private:
     void unregisterFromPool(SessionItem* item);
     SessionItem* intern_insert(const item_factory_func_t& func, SessionItem* parent,
                                const TagRow& tagrow);
+    std::vector<SessionItem*> intern_insert_items(const item_factory_func_t& func,
+                                                  SessionItem* parent, const TagRow& tagrow,
+                                                  int count);
     void intern_register(const model_type& modelType, const item_factory_func_t& func,
                          const std::string& label);
 
@@ -101,6 +117,18 @@ template <typename T> T* SessionModel::insertItem(SessionItem* parent, const Tag
     return static_cast<T*>(intern_insert(ItemFactoryFunction<T>(), parent, tagrow));
 }
 
+//! Inserts 'count' items into given parent, starting from given tagrow. Listeners are notified
+//! about insertion of the whole range at once.
+
+template <typename T>
+std::vector<T*> SessionModel::insertItems(SessionItem* parent, const TagRow& tagrow, int count)
+{
+    std::vector<T*> result;
+    for (auto item : intern_insert_items(ItemFactoryFunction<T>(), parent, tagrow, count))
+        result.push_back(static_cast<T*>(item));
+    return result;
+}
+
 //! Returns top items of the given type.
 //! The top item is an item that is a child of an invisible root item.
 
@@ -0,0 +1,108 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/snapshotitem.h"
+#include <stdexcept>
+
+using namespace ModelView;
+
+model_type SnapshotItem::modelType() const
+{
+    return m_modelType;
+}
+
+identifier_type SnapshotItem::identifier() const
+{
+    return data<std::string>(ItemDataRole::IDENTIFIER);
+}
+
+std::string SnapshotItem::displayName() const
+{
+    return data<std::string>(ItemDataRole::DISPLAY);
+}
+
+bool SnapshotItem::hasData(int role) const
+{
+    return m_data.hasData(role);
+}
+
+const SessionItemData& SnapshotItem::itemData() const
+{
+    return m_data;
+}
+
+int SnapshotItem::childrenCount() const
+{
+    return static_cast<int>(m_children.size());
+}
+
+//! Returns all children in the order of their tags.
+
+std::vector<const SnapshotItem*> SnapshotItem::children() const
+{
+    std::vector<const SnapshotItem*> result;
+    result.reserve(m_children.size());
+    for (const auto& child : m_children)
+        result.push_back(child.get());
+    return result;
+}
+
+//! Returns number of children stored under given tag. If tag name is empty, default tag will be
+//! used.
+
+int SnapshotItem::itemCount(const TagName& tag) const
+{
+    return static_cast<int>(range(tag).count);
+}
+
+//! Returns child stored under given tag and row, or nullptr if there is no such row. If tag name
+//! is empty, default tag will be used.
+
+const SnapshotItem* SnapshotItem::getItem(const TagName& tag, int row) const
+{
+    const auto& tag_range = range(tag);
+    if (row < 0 || static_cast<size_t>(row) >= tag_range.count)
+        return nullptr;
+    return m_children[tag_range.first + static_cast<size_t>(row)].get();
+}
+
+//! Returns all children stored under given tag. If tag name is empty, default tag will be used.
+
+std::vector<const SnapshotItem*> SnapshotItem::getItems(const TagName& tag) const
+{
+    const auto& tag_range = range(tag);
+    std::vector<const SnapshotItem*> result;
+    result.reserve(tag_range.count);
+    for (size_t i = 0; i < tag_range.count; ++i)
+        result.push_back(m_children[tag_range.first + i].get());
+    return result;
+}
+
+//! Returns this item or its descendant with given identifier, or nullptr if there is no such item.
+
+const SnapshotItem* SnapshotItem::findItem(const identifier_type& identifier) const
+{
+    if (this->identifier() == identifier)
+        return this;
+
+    for (const auto& child : m_children)
+        if (auto result = child->findItem(identifier))
+            return result;
+    return nullptr;
+}
+
+const SnapshotItem::TagRange& SnapshotItem::range(const TagName& tag) const
+{
+    const TagName& name = tag.empty() ? m_default_tag : tag;
+    for (const auto& tag_range : m_tags)
+        if (tag_range.tag == name)
+            return tag_range;
+
+    throw std::runtime_error("Error in SnapshotItem: no such tag '" + name.name() + "'");
+}
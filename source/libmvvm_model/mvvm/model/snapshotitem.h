@@ -0,0 +1,100 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_SNAPSHOTITEM_H
+#define MVVM_MODEL_SNAPSHOTITEM_H
+
+#include "mvvm/core/types.h"
+#include "mvvm/core/variant.h"
+#include "mvvm/model/customvariants.h"
+#include "mvvm/model/mvvm_types.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/tagname.h"
+#include "mvvm/model_export.h"
+#include <memory>
+#include <vector>
+
+namespace ModelView {
+
+class SessionItem;
+
+//! Immutable copy of SessionItem's data and children, taken at some moment of time.
+
+//! Snapshot is created by SessionItem::snapshot() and never changes afterwards, so it can be read
+//! from any thread while the item is being edited. Children are shared between snapshots: parts of
+//! the tree, which didn't change since the previous snapshot, are not copied again.
+
+class MVVM_MODEL_EXPORT SnapshotItem {
+public:
+    SnapshotItem(const SnapshotItem&) = delete;
+    SnapshotItem& operator=(const SnapshotItem&) = delete;
+
+    model_type modelType() const;
+
+    identifier_type identifier() const;
+
+    std::string displayName() const;
+
+    bool hasData(int role = ItemDataRole::DATA) const;
+
+    template <typename T> T data(int role = ItemDataRole::DATA) const;
+
+    const SessionItemData& itemData() const;
+
+    int childrenCount() const;
+
+    std::vector<const SnapshotItem*> children() const;
+
+    int itemCount(const TagName& tag) const;
+
+    const SnapshotItem* getItem(const TagName& tag, int row = 0) const;
+
+    std::vector<const SnapshotItem*> getItems(const TagName& tag) const;
+
+    template <typename T> T property(const TagName& tag) const;
+
+    const SnapshotItem* findItem(const identifier_type& identifier) const;
+
+private:
+    friend class SessionItem;
+
+    //! Range of children, stored under the tag.
+    struct TagRange {
+        TagName tag;
+        size_t first{0};
+        size_t count{0};
+    };
+
+    SnapshotItem() = default;
+    const TagRange& range(const TagName& tag) const;
+
+    model_type m_modelType;
+    SessionItemData m_data;
+    TagName m_default_tag;
+    std::vector<TagRange> m_tags;
+    std::vector<std::shared_ptr<const SnapshotItem>> m_children; //! in the order of tags
+};
+
+//! Returns data of given type T for given role.
+
+template <typename T> inline T SnapshotItem::data(int role) const
+{
+    return m_data.data(role).value<T>();
+}
+
+//! Returns data stored in property item.
+
+template <typename T> inline T SnapshotItem::property(const TagName& tag) const
+{
+    return getItem(tag)->data<T>();
+}
+
+} // namespace ModelView
+
+#endif // MVVM_MODEL_SNAPSHOTITEM_H
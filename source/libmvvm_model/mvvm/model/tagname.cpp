@@ -0,0 +1,195 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/tagname.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+using namespace ModelView;
+
+struct TagName::Entry {
+    int id{0};
+    std::string name;
+    size_t hash{0};
+};
+
+namespace {
+
+//! Global table of interned names. Names are never removed, so entries have stable addresses.
+//! Lookup is lock-free: hash tables are only appended under the mutex, and a full table is
+//! replaced by a larger one, while the old one is kept for readers which might still use it.
+
+class SymbolTable {
+public:
+    using Entry = TagName::Entry;
+
+    static SymbolTable& instance()
+    {
+        static SymbolTable table;
+        return table;
+    }
+
+    const Entry* intern(std::string_view name)
+    {
+        const size_t hash = std::hash<std::string_view>()(name);
+        if (auto entry = find(*m_table.load(std::memory_order_acquire), name, hash))
+            return entry;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto table = m_table.load(std::memory_order_relaxed);
+        if (auto entry = find(*table, name, hash))
+            return entry;
+
+        // table is kept at most half full
+        if ((m_entries.size() + 1) * 2 > table->size())
+            table = grow(table->size() * 2);
+        m_entries.push_back({static_cast<int>(m_entries.size()) + 1, std::string(name), hash});
+        insert(*table, &m_entries.back());
+        return &m_entries.back();
+    }
+
+private:
+    using Table = std::vector<std::atomic<const Entry*>>;
+
+    SymbolTable() { grow(initial_capacity); }
+
+    static const Entry* find(const Table& table, std::string_view name, size_t hash)
+    {
+        const size_t mask = table.size() - 1;
+        for (size_t index = hash & mask;; index = (index + 1) & mask) {
+            auto entry = table[index].load(std::memory_order_acquire);
+            if (!entry)
+                return nullptr;
+            if (entry->hash == hash && entry->name == name)
+                return entry;
+        }
+    }
+
+    static void insert(Table& table, const Entry* entry)
+    {
+        const size_t mask = table.size() - 1;
+        size_t index = entry->hash & mask;
+        while (table[index].load(std::memory_order_relaxed))
+            index = (index + 1) & mask;
+        table[index].store(entry, std::memory_order_release);
+    }
+
+    //! Creates new table of given capacity with all existing entries and makes it current.
+    Table* grow(size_t capacity)
+    {
+        m_tables.push_back(std::make_unique<Table>(capacity));
+        auto table = m_tables.back().get();
+        for (const auto& entry : m_entries)
+            insert(*table, &entry);
+        m_table.store(table, std::memory_order_release);
+        return table;
+    }
+
+    static constexpr size_t initial_capacity = 256;
+
+    std::deque<Entry> m_entries;
+    std::vector<std::unique_ptr<Table>> m_tables;
+    std::atomic<Table*> m_table{nullptr};
+    std::mutex m_mutex;
+};
+
+} // namespace
+
+TagName::TagName(const std::string& name)
+    : m_entry(name.empty() ? nullptr : SymbolTable::instance().intern(name))
+{
+}
+
+TagName::TagName(const char* name)
+    : m_entry(name && *name ? SymbolTable::instance().intern(name) : nullptr)
+{
+}
+
+//! Returns unique identifier of the name. Zero corresponds to the empty name.
+
+int TagName::id() const
+{
+    return m_entry ? m_entry->id : 0;
+}
+
+const std::string& TagName::name() const
+{
+    static const std::string empty_name;
+    return m_entry ? m_entry->name : empty_name;
+}
+
+bool ModelView::operator==(const TagName& lhs, const std::string& rhs)
+{
+    return lhs.name() == rhs;
+}
+
+bool ModelView::operator==(const std::string& lhs, const TagName& rhs)
+{
+    return rhs == lhs;
+}
+
+bool ModelView::operator==(const TagName& lhs, const char* rhs)
+{
+    return lhs.name() == rhs;
+}
+
+bool ModelView::operator==(const char* lhs, const TagName& rhs)
+{
+    return rhs == lhs;
+}
+
+bool ModelView::operator!=(const TagName& lhs, const std::string& rhs)
+{
+    return !(lhs == rhs);
+}
+
+bool ModelView::operator!=(const std::string& lhs, const TagName& rhs)
+{
+    return !(rhs == lhs);
+}
+
+bool ModelView::operator!=(const TagName& lhs, const char* rhs)
+{
+    return !(lhs == rhs);
+}
+
+bool ModelView::operator!=(const char* lhs, const TagName& rhs)
+{
+    return !(rhs == lhs);
+}
+
+std::string ModelView::operator+(const std::string& lhs, const TagName& rhs)
+{
+    return lhs + rhs.name();
+}
+
+std::string ModelView::operator+(const TagName& lhs, const std::string& rhs)
+{
+    return lhs.name() + rhs;
+}
+
+std::string ModelView::operator+(const char* lhs, const TagName& rhs)
+{
+    return lhs + rhs.name();
+}
+
+std::string ModelView::operator+(const TagName& lhs, const char* rhs)
+{
+    return lhs.name() + rhs;
+}
+
+std::ostream& ModelView::operator<<(std::ostream& os, const TagName& tag)
+{
+    return os << tag.name();
+}
@@ -0,0 +1,77 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_MODEL_TAGNAME_H
+#define MVVM_MODEL_TAGNAME_H
+
+#include "mvvm/model_export.h"
+#include <functional>
+#include <iosfwd>
+#include <string>
+
+namespace ModelView {
+
+//! Interned name of the tag.
+
+//! All names are registered in the global symbol table, which assigns them unique integer
+//! identifiers. Tag names are compared and hashed as integers. Conversion from the string costs
+//! a lookup in the symbol table, so frequently used tags are better kept in TagName form.
+//! Default constructed TagName corresponds to an empty name.
+
+class MVVM_MODEL_EXPORT TagName {
+public:
+    struct Entry;
+
+    TagName() = default;
+    TagName(const std::string& name);
+    TagName(const char* name);
+
+    int id() const;
+
+    const std::string& name() const;
+
+    bool empty() const { return m_entry == nullptr; }
+
+    operator const std::string&() const { return name(); }
+
+    bool operator==(const TagName& other) const { return m_entry == other.m_entry; }
+    bool operator!=(const TagName& other) const { return m_entry != other.m_entry; }
+
+private:
+    const Entry* m_entry{nullptr};
+};
+
+MVVM_MODEL_EXPORT bool operator==(const TagName& lhs, const std::string& rhs);
+MVVM_MODEL_EXPORT bool operator==(const std::string& lhs, const TagName& rhs);
+MVVM_MODEL_EXPORT bool operator==(const TagName& lhs, const char* rhs);
+MVVM_MODEL_EXPORT bool operator==(const char* lhs, const TagName& rhs);
+MVVM_MODEL_EXPORT bool operator!=(const TagName& lhs, const std::string& rhs);
+MVVM_MODEL_EXPORT bool operator!=(const std::string& lhs, const TagName& rhs);
+MVVM_MODEL_EXPORT bool operator!=(const TagName& lhs, const char* rhs);
+MVVM_MODEL_EXPORT bool operator!=(const char* lhs, const TagName& rhs);
+
+MVVM_MODEL_EXPORT std::string operator+(const std::string& lhs, const TagName& rhs);
+MVVM_MODEL_EXPORT std::string operator+(const TagName& lhs, const std::string& rhs);
+MVVM_MODEL_EXPORT std::string operator+(const char* lhs, const TagName& rhs);
+MVVM_MODEL_EXPORT std::string operator+(const TagName& lhs, const char* rhs);
+
+MVVM_MODEL_EXPORT std::ostream& operator<<(std::ostream& os, const TagName& tag);
+
+} // namespace ModelView
+
+namespace std {
+template <> struct hash<ModelView::TagName> {
+    size_t operator()(const ModelView::TagName& tag) const noexcept
+    {
+        return std::hash<int>()(tag.id());
+    }
+};
+} // namespace std
+
+#endif // MVVM_MODEL_TAGNAME_H
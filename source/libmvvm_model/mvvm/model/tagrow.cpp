@@ -28,7 +28,7 @@ ModelView::TagRow ModelView::TagRow::prev() const
 //! Returns TagRow corresponding to the append to tag_name.
 //! If tag_name =="" the default name will be used in SessionItemTags context.
 
-ModelView::TagRow ModelView::TagRow::append(const std::string& tag_name)
+ModelView::TagRow ModelView::TagRow::append(const TagName& tag_name)
 {
     return {tag_name, -1};
 }
@@ -36,7 +36,7 @@ ModelView::TagRow ModelView::TagRow::append(const std::string& tag_name)
 //! Returns TagRow corresponding to prepending to tag_name.
 //! If tag_name =="" the default name will be used in SessionItemTags context.
 
-ModelView::TagRow ModelView::TagRow::prepend(const std::string& tag_name)
+ModelView::TagRow ModelView::TagRow::prepend(const TagName& tag_name)
 {
     return {tag_name, 0};
 }
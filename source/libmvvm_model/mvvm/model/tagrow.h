@@ -10,6 +10,7 @@
 #ifndef MVVM_MODEL_TAGROW_H
 #define MVVM_MODEL_TAGROW_H
 
+#include "mvvm/model/tagname.h"
 #include "mvvm/model_export.h"
 #include <string>
 
@@ -20,11 +21,12 @@ namespace ModelView {
 
 class MVVM_MODEL_EXPORT TagRow {
 public:
-    std::string tag = {};
+    TagName tag = {};
     int row = -1;
 
     TagRow() {}
 
+    TagRow(const TagName& name, int row = -1) : tag(name), row(row) {}
     TagRow(const std::string& name, int row = -1) : tag(name), row(row) {}
     TagRow(const char* name, int row = -1) : tag(name), row(row) {}
 
@@ -32,9 +34,9 @@ public:
 
     TagRow prev() const;
 
-    static TagRow append(const std::string& tag_name = {});
+    static TagRow append(const TagName& tag_name = {});
 
-    static TagRow prepend(const std::string& tag_name = {});
+    static TagRow prepend(const TagName& tag_name = {});
 
     bool operator==(const TagRow& other) const;
     bool operator!=(const TagRow& other) const;
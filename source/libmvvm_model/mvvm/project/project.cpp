@@ -39,8 +39,9 @@ struct Project::ProjectImpl {
             return false;
 
         for (auto model : models()) {
-            auto document = CreateJsonDocument({model});
-            auto filename = Utils::join(dirname, ProjectUtils::SuggestFileName(*model));
+            auto document = CreateModelDocument({model}, m_context.m_document_format);
+            auto filename = Utils::join(
+                dirname, ProjectUtils::SuggestFileName(*model, m_context.m_document_format));
             std::invoke(method, document, filename);
         }
         m_project_dir = dirname;
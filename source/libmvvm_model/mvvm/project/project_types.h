@@ -10,6 +10,7 @@
 #ifndef MVVM_PROJECT_PROJECT_TYPES_H
 #define MVVM_PROJECT_PROJECT_TYPES_H
 
+#include "mvvm/interfaces/modeldocumentinterface.h"
 #include "mvvm/model_export.h"
 #include <functional>
 #include <string>
@@ -35,6 +36,9 @@ struct MVVM_MODEL_EXPORT ProjectContext {
 
     modified_callback_t m_modified_callback;
     models_callback_t m_models_callback;
+
+    //! Format of model files in the project directory.
+    ModelDocumentFormat m_document_format{ModelDocumentFormat::JSON};
 };
 
 //! Defines the context to interact with the user regarding save/save-as/create-new project
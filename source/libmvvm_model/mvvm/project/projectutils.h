@@ -10,6 +10,7 @@
 #ifndef MVVM_PROJECT_PROJECTUTILS_H
 #define MVVM_PROJECT_PROJECTUTILS_H
 
+#include "mvvm/interfaces/modeldocumentinterface.h"
 #include "mvvm/model_export.h"
 #include <memory>
 #include <string>
@@ -24,7 +25,9 @@ struct ProjectContext;
 
 namespace ProjectUtils {
 
-MVVM_MODEL_EXPORT std::string SuggestFileName(const SessionModel& model);
+MVVM_MODEL_EXPORT std::string
+SuggestFileName(const SessionModel& model,
+                ModelDocumentFormat format = ModelDocumentFormat::JSON);
 
 MVVM_MODEL_EXPORT bool IsPossibleProjectDir(const std::string& project_dir);
 
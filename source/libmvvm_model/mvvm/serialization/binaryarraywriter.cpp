@@ -0,0 +1,117 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/serialization/binaryarraywriter.h"
+#include "mvvm/model/doublearray.h"
+#include <QFile>
+#include <QSaveFile>
+#include <QSysInfo>
+#include <QtEndian>
+#include <stdexcept>
+#include <vector>
+
+using namespace ModelView;
+
+namespace {
+const char sidecar_magic[] = "MVVMDATA";
+const qint64 sidecar_magic_size = 8;
+} // namespace
+
+struct BinaryArrayWriter::BinaryArrayWriterImpl {
+    std::string m_file_name;
+    size_t m_threshold{0};
+    std::unique_ptr<QSaveFile> m_file;
+
+    BinaryArrayWriterImpl(std::string file_name, size_t threshold)
+        : m_file_name(std::move(file_name)), m_threshold(threshold)
+    {
+    }
+
+    //! Opens the file on first write, so no sidecar file appears when there are no large arrays.
+    QSaveFile& file()
+    {
+        if (!m_file) {
+            m_file = std::make_unique<QSaveFile>(QString::fromStdString(m_file_name));
+            if (!m_file->open(QIODevice::WriteOnly))
+                throw std::runtime_error("Error in BinaryArrayWriter: can't save the file '"
+                                         + m_file_name + "'");
+            write_block(sidecar_magic, sidecar_magic_size);
+        }
+        return *m_file;
+    }
+
+    void write_values(const std::vector<double>& values)
+    {
+        const auto nbytes = static_cast<qint64>(values.size() * sizeof(double));
+        if (QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
+            write_block(reinterpret_cast<const char*>(values.data()), nbytes);
+        } else {
+            std::vector<double> buffer(values.size());
+            qToLittleEndian<double>(values.data(), static_cast<qsizetype>(values.size()),
+                                    buffer.data());
+            write_block(reinterpret_cast<const char*>(buffer.data()), nbytes);
+        }
+    }
+
+    void write_block(const char* data, qint64 size)
+    {
+        if (m_file->write(data, size) != size)
+            throw std::runtime_error("Error in BinaryArrayWriter: can't write the file '"
+                                     + m_file_name + "'");
+    }
+};
+
+//! Creates the writer for given file. Arrays with 'threshold' values and more will go to the file,
+//! zero threshold means that no array will be accepted.
+
+BinaryArrayWriter::BinaryArrayWriter(const std::string& file_name, size_t threshold)
+    : p_impl(std::make_unique<BinaryArrayWriterImpl>(file_name, threshold))
+{
+}
+
+BinaryArrayWriter::~BinaryArrayWriter() = default;
+
+//! Returns true if given array is large enough to be stored in a sidecar file.
+
+bool BinaryArrayWriter::isAccepted(const DoubleArray& array) const
+{
+    return p_impl->m_threshold > 0 && array.size() >= p_impl->m_threshold;
+}
+
+//! Writes array to the file and returns its offset in bytes from the beginning of the file.
+//! Lazy array, which wasn't loaded yet, is copied from its source and stays not loaded.
+
+uint64_t BinaryArrayWriter::write(const DoubleArray& array)
+{
+    auto& file = p_impl->file();
+    const auto offset = static_cast<uint64_t>(file.pos());
+
+    if (array.isLoaded())
+        p_impl->write_values(array.values());
+    else
+        p_impl->write_values(array.copyValues());
+
+    return offset;
+}
+
+//! Replaces the file on disk with the written content. If nothing was written, the stale file
+//! left from the previous save is removed.
+
+void BinaryArrayWriter::commit()
+{
+    if (!p_impl->m_file) {
+        QFile::remove(QString::fromStdString(p_impl->m_file_name));
+        return;
+    }
+
+    if (!p_impl->m_file->commit())
+        throw std::runtime_error("Error in BinaryArrayWriter: can't save the file '"
+                                 + p_impl->m_file_name + "'");
+    p_impl->m_file.reset();
+}
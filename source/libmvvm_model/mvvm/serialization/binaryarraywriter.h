@@ -0,0 +1,48 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYARRAYWRITER_H
+#define MVVM_SERIALIZATION_BINARYARRAYWRITER_H
+
+#include "mvvm/model_export.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ModelView {
+
+class DoubleArray;
+
+//! Writes large numeric arrays of BinaryDocument into a sidecar file.
+
+//! Arrays are stored one after another as raw little-endian blocks, so they can be memory-mapped
+//! later by MappedArrayReader. The file is written to a temporary location and replaces the
+//! original one only on commit(). This keeps intact mappings of the previous file alive.
+
+class MVVM_MODEL_EXPORT BinaryArrayWriter {
+public:
+    BinaryArrayWriter(const std::string& file_name, size_t threshold);
+    BinaryArrayWriter(const BinaryArrayWriter&) = delete;
+    BinaryArrayWriter& operator=(const BinaryArrayWriter&) = delete;
+    ~BinaryArrayWriter();
+
+    bool isAccepted(const DoubleArray& array) const;
+
+    uint64_t write(const DoubleArray& array);
+
+    void commit();
+
+private:
+    struct BinaryArrayWriterImpl;
+    std::unique_ptr<BinaryArrayWriterImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYARRAYWRITER_H
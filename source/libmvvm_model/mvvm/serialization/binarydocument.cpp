@@ -0,0 +1,203 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/serialization/binarydocument.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/tagrow.h"
+#include "mvvm/serialization/binaryarraywriter.h"
+#include "mvvm/serialization/binaryitemconverter.h"
+#include "mvvm/serialization/mappedarrayreader.h"
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <sstream>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace {
+const quint32 document_magic = 0x4d56564d; // "MVVM"
+const quint32 document_version = 2;
+
+//! Prepares stream for reading/writing: little-endian with double precision floating points.
+void setup_stream(QDataStream& stream)
+{
+    stream.setVersion(QDataStream::Qt_5_12);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+//! Returns name of the sidecar file with large arrays of given generation. Every save writes
+//! the sidecar file of the new generation, so the document on disk never refers to the file
+//! which is being written, and files mapped by the previous load are never overwritten.
+std::string array_file_name(const std::string& file_name, quint32 generation)
+{
+    return file_name + "." + std::to_string(generation) + ".data";
+}
+
+//! Returns generation of the sidecar file of the document on disk, or zero if there is no valid
+//! document.
+quint32 saved_generation(const std::string& file_name)
+{
+    QFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::ReadOnly))
+        return 0;
+
+    QDataStream stream(&file);
+    setup_stream(stream);
+    quint32 magic{0}, version{0}, generation{0};
+    stream >> magic >> version >> generation;
+    const bool is_valid = stream.status() == QDataStream::Ok && magic == document_magic
+                          && version == document_version;
+    return is_valid ? generation : 0;
+}
+
+//! Removes sidecar files of all generations of the document, except the given one. Files which
+//! can't be removed (e.g. still mapped on Windows) are left for the next save.
+void remove_stale_array_files(const std::string& file_name, quint32 generation)
+{
+    const QFileInfo info(QString::fromStdString(file_name));
+    const QString prefix = info.fileName() + ".";
+    const QString suffix = ".data";
+    QDir dir = info.absoluteDir();
+    for (const auto& entry : dir.entryList({prefix + "*" + suffix}, QDir::Files)) {
+        const auto middle = entry.mid(prefix.size(), entry.size() - prefix.size() - suffix.size());
+        bool is_number{false};
+        const auto value = middle.toUInt(&is_number);
+        if (is_number && value != generation)
+            dir.remove(entry);
+    }
+}
+
+} // namespace
+
+struct BinaryDocument::BinaryDocumentImpl {
+    std::vector<SessionModel*> models;
+    size_t mapping_threshold{0};
+    BinaryDocumentImpl(std::vector<SessionModel*> models, size_t mapping_threshold)
+        : models(std::move(models)), mapping_threshold(mapping_threshold)
+    {
+    }
+
+    void write_model(QDataStream& stream, const SessionModel& model, BinaryArrayWriter& writer)
+    {
+        if (!model.rootItem())
+            throw std::runtime_error("Error in BinaryDocument: model is not initialized.");
+
+        stream << QByteArray::fromStdString(model.modelType());
+
+        BinaryItemConverter converter(model.factory(), &writer);
+        auto children = model.rootItem()->children();
+        stream << static_cast<quint32>(children.size());
+        for (auto item : children)
+            converter.write(stream, *item);
+    }
+
+    void read_model(QDataStream& stream, SessionModel& model, const MappedArrayReader& reader)
+    {
+        QByteArray model_type;
+        stream >> model_type;
+        if (model_type.toStdString() != model.modelType())
+            throw std::runtime_error("Error in BinaryDocument: unexpected model type '"
+                                     + model.modelType() + "', file contains '"
+                                     + model_type.toStdString() + "'");
+
+        quint32 count{0};
+        stream >> count;
+
+        BinaryItemConverter converter(model.factory(), nullptr, &reader);
+        auto rebuild_root = [&stream, &converter, count](auto parent) {
+            for (quint32 i = 0; i < count; ++i)
+                parent->insertItem(converter.read(stream), TagRow::append());
+        };
+        model.clear(rebuild_root);
+    }
+};
+
+BinaryDocument::BinaryDocument(const std::vector<SessionModel*>& models,
+                               size_t mapping_threshold)
+    : p_impl(std::make_unique<BinaryDocumentImpl>(models, mapping_threshold))
+{
+}
+
+//! Saves models on disk. Large arrays go to the sidecar file of the new generation, which the
+//! document refers to. The document is replaced only when everything has been written, and
+//! sidecar files of previous generations are removed after that. So the failure at any step
+//! leaves the previous version of the files intact, and arrays mapped from it stay valid.
+
+void BinaryDocument::save(const std::string& file_name) const
+{
+    const quint32 generation = saved_generation(file_name) + 1;
+    const auto array_file = array_file_name(file_name, generation);
+    BinaryArrayWriter writer(array_file, p_impl->mapping_threshold);
+
+    QSaveFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::WriteOnly))
+        throw std::runtime_error("Error in BinaryDocument: can't save the file '" + file_name
+                                 + "'");
+
+    QDataStream stream(&file);
+    setup_stream(stream);
+
+    stream << document_magic << document_version << generation;
+    stream << static_cast<quint32>(p_impl->models.size());
+    for (auto model : p_impl->models)
+        p_impl->write_model(stream, *model, writer);
+
+    if (stream.status() != QDataStream::Ok)
+        throw std::runtime_error("Error in BinaryDocument: can't write the file '" + file_name
+                                 + "'");
+
+    // sidecar file goes first, so the document never refers to arrays which didn't make it to disk
+    writer.commit();
+    if (!file.commit()) {
+        QFile::remove(QString::fromStdString(array_file));
+        throw std::runtime_error("Error in BinaryDocument: can't write the file '" + file_name
+                                 + "'");
+    }
+
+    remove_stale_array_files(file_name, generation);
+}
+
+//! Loads models from disk. If models have some data already, it will be rewritten.
+
+void BinaryDocument::load(const std::string& file_name)
+{
+    QFile file(QString::fromStdString(file_name));
+    if (!file.open(QIODevice::ReadOnly))
+        throw std::runtime_error("Error in BinaryDocument: can't read the file '" + file_name
+                                 + "'");
+
+    QDataStream stream(&file);
+    setup_stream(stream);
+
+    quint32 magic{0}, version{0}, generation{0}, count{0};
+    stream >> magic >> version >> generation >> count;
+    if (magic != document_magic || version != document_version)
+        throw std::runtime_error("Error in BinaryDocument: file '" + file_name
+                                 + "' is not a binary model document.");
+
+    if (count != p_impl->models.size()) {
+        std::ostringstream ostr;
+        ostr << "Error in BinaryDocument: number of application models " << p_impl->models.size()
+             << " and number of models in file " << count << " doesn't match";
+        throw std::runtime_error(ostr.str());
+    }
+
+    MappedArrayReader reader(array_file_name(file_name, generation));
+    for (auto model : p_impl->models)
+        p_impl->read_model(stream, *model, reader);
+
+    file.close();
+}
+
+BinaryDocument::~BinaryDocument() = default;
@@ -0,0 +1,48 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYDOCUMENT_H
+#define MVVM_SERIALIZATION_BINARYDOCUMENT_H
+
+#include "mvvm/interfaces/modeldocumentinterface.h"
+#include <memory>
+#include <vector>
+
+namespace ModelView {
+
+class SessionModel;
+
+//! Saves and restores list of SessionModel's to/from disk using compact binary format.
+//! Single BinaryDocument corresponds to a single file on disk. Intended for large projects,
+//! JsonDocument remains the format for interchange.
+
+//! Arrays with the number of values above mapping threshold are stored in a sidecar file next to
+//! the document. On load they are memory-mapped and get their content on first access only.
+//! Every save writes the sidecar file under the new name ('<file>.<generation>.data'), which is
+//! referenced by the document, and removes sidecar files of previous saves.
+
+class MVVM_MODEL_EXPORT BinaryDocument : public ModelDocumentInterface {
+public:
+    static constexpr size_t default_mapping_threshold = 65536;
+
+    BinaryDocument(const std::vector<SessionModel*>& models,
+                   size_t mapping_threshold = default_mapping_threshold);
+    ~BinaryDocument() override;
+
+    void save(const std::string& file_name) const override;
+    void load(const std::string& file_name) override;
+
+private:
+    struct BinaryDocumentImpl;
+    std::unique_ptr<BinaryDocumentImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYDOCUMENT_H
@@ -0,0 +1,514 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/serialization/binaryitemconverter.h"
+#include "mvvm/interfaces/itemfactoryinterface.h"
+#include "mvvm/model/comboproperty.h"
+#include "mvvm/model/customvariants.h"
+#include "mvvm/model/doublearray.h"
+#include "mvvm/model/identifierloadingscope.h"
+#include "mvvm/model/externalproperty.h"
+#include "mvvm/model/mvvm_types.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/sessionitemtags.h"
+#include "mvvm/model/taginfo.h"
+#include "mvvm/model/variant_constants.h"
+#include "mvvm/serialization/binaryarraywriter.h"
+#include "mvvm/serialization/compatibilityutils.h"
+#include "mvvm/serialization/jsonutils.h"
+#include "mvvm/serialization/mappedarrayreader.h"
+#include "mvvm/utils/reallimits.h"
+#include <QColor>
+#include <QDataStream>
+#include <QIODevice>
+#include <QSysInfo>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+using namespace ModelView;
+
+namespace {
+
+//! Codes of supported variant types as they are written to the stream.
+enum class VariantCode : quint8 {
+    INVALID = 0,
+    BOOL,
+    INT,
+    STRING,
+    DOUBLE,
+    VECTOR_DOUBLE,
+    DOUBLE_ARRAY,
+    COMBOPROPERTY,
+    QCOLOR,
+    EXTPROPERTY,
+    REALLIMITS,
+    MAPPED_DOUBLE_ARRAY
+};
+
+VariantCode variant_code(const Variant& variant)
+{
+    static const std::map<std::string, VariantCode> codes = {
+        {Constants::invalid_type_name, VariantCode::INVALID},
+        {Constants::bool_type_name, VariantCode::BOOL},
+        {Constants::int_type_name, VariantCode::INT},
+        {Constants::string_type_name, VariantCode::STRING},
+        {Constants::double_type_name, VariantCode::DOUBLE},
+        {Constants::vector_double_type_name, VariantCode::VECTOR_DOUBLE},
+        {Constants::double_array_type_name, VariantCode::DOUBLE_ARRAY},
+        {Constants::comboproperty_type_name, VariantCode::COMBOPROPERTY},
+        {Constants::qcolor_type_name, VariantCode::QCOLOR},
+        {Constants::extproperty_type_name, VariantCode::EXTPROPERTY},
+        {Constants::reallimits_type_name, VariantCode::REALLIMITS}};
+
+    const std::string type_name = Utils::VariantName(variant);
+    auto it = codes.find(type_name);
+    if (it == codes.end())
+        throw std::runtime_error("Error in BinaryItemConverter: unknown variant type '" + type_name
+                                 + "'.");
+    return it->second;
+}
+
+//! Throws if the stream has failed while reading.
+void check_status(const QDataStream& stream)
+{
+    if (stream.status() != QDataStream::Ok)
+        throw std::runtime_error("Error in BinaryItemConverter: corrupted stream.");
+}
+
+void write_string(QDataStream& stream, const std::string& str)
+{
+    stream << QByteArray::fromStdString(str);
+}
+
+std::string read_string(QDataStream& stream)
+{
+    QByteArray result;
+    stream >> result;
+    check_status(stream);
+    return result.toStdString();
+}
+
+//! Maximum size of a raw block passed to QDataStream at once, which takes block size as int.
+const quint64 max_block_size = (std::numeric_limits<int>::max() / sizeof(double)) * sizeof(double);
+
+//! Writes array of doubles as a size followed by a raw little-endian block.
+void write_doubles(QDataStream& stream, const std::vector<double>& values)
+{
+    stream << static_cast<quint64>(values.size());
+    if (QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
+        const auto data = reinterpret_cast<const char*>(values.data());
+        const quint64 nbytes = values.size() * sizeof(double);
+        for (quint64 pos = 0; pos < nbytes; pos += max_block_size) {
+            const auto block_size = static_cast<int>(std::min(max_block_size, nbytes - pos));
+            if (stream.writeRawData(data + pos, block_size) != block_size)
+                throw std::runtime_error("Error in BinaryItemConverter: can't write array.");
+        }
+    } else {
+        for (auto x : values)
+            stream << x;
+    }
+}
+
+std::vector<double> read_doubles(QDataStream& stream)
+{
+    quint64 size{0};
+    stream >> size;
+    check_status(stream);
+
+    const quint64 nbytes = size * sizeof(double);
+    if (size > static_cast<quint64>(stream.device()->bytesAvailable()) / sizeof(double))
+        throw std::runtime_error("Error in BinaryItemConverter: array size exceeds the stream.");
+
+    std::vector<double> result(static_cast<size_t>(size));
+    if (QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
+        auto data = reinterpret_cast<char*>(result.data());
+        for (quint64 pos = 0; pos < nbytes; pos += max_block_size) {
+            const auto block_size = static_cast<int>(std::min(max_block_size, nbytes - pos));
+            if (stream.readRawData(data + pos, block_size) != block_size)
+                throw std::runtime_error("Error in BinaryItemConverter: corrupted array.");
+        }
+    } else {
+        for (auto& x : result)
+            stream >> x;
+    }
+    check_status(stream);
+    return result;
+}
+
+//! Writes type code followed by the variant value to the stream.
+void write_value(QDataStream& stream, const Variant& variant, VariantCode code)
+{
+    stream << static_cast<quint8>(code);
+
+    switch (code) {
+    case VariantCode::INVALID:
+    case VariantCode::MAPPED_DOUBLE_ARRAY:
+        break;
+    case VariantCode::BOOL:
+        stream << variant.value<bool>();
+        break;
+    case VariantCode::INT:
+        stream << static_cast<qint32>(variant.value<int>());
+        break;
+    case VariantCode::STRING:
+        write_string(stream, variant.value<std::string>());
+        break;
+    case VariantCode::DOUBLE:
+        stream << variant.value<double>();
+        break;
+    case VariantCode::VECTOR_DOUBLE:
+        write_doubles(stream, variant.value<std::vector<double>>());
+        break;
+    case VariantCode::DOUBLE_ARRAY: {
+        // lazy array stays not loaded
+        auto array = variant.value<DoubleArray>();
+        if (array.isLoaded())
+            write_doubles(stream, array.values());
+        else
+            write_doubles(stream, array.copyValues());
+        break;
+    }
+    case VariantCode::COMBOPROPERTY: {
+        auto combo = variant.value<ComboProperty>();
+        write_string(stream, combo.stringOfValues());
+        write_string(stream, combo.stringOfSelections());
+        break;
+    }
+    case VariantCode::QCOLOR:
+        stream << variant.value<QColor>();
+        break;
+    case VariantCode::EXTPROPERTY: {
+        auto extprop = variant.value<ExternalProperty>();
+        write_string(stream, extprop.text());
+        stream << extprop.color();
+        write_string(stream, extprop.identifier());
+        break;
+    }
+    case VariantCode::REALLIMITS: {
+        auto limits = variant.value<RealLimits>();
+        write_string(stream, JsonUtils::ToString(limits));
+        stream << limits.lowerLimit() << limits.upperLimit();
+        break;
+    }
+    }
+}
+
+//! Reads variant value of given type code from the stream.
+Variant read_value(QDataStream& stream, VariantCode code)
+{
+    switch (code) {
+    case VariantCode::INVALID:
+        return Variant();
+    case VariantCode::BOOL: {
+        bool value{false};
+        stream >> value;
+        return Variant::fromValue(value);
+    }
+    case VariantCode::INT: {
+        qint32 value{0};
+        stream >> value;
+        return Variant::fromValue(static_cast<int>(value));
+    }
+    case VariantCode::STRING:
+        return Variant::fromValue(read_string(stream));
+    case VariantCode::DOUBLE: {
+        double value{0.0};
+        stream >> value;
+        return Variant::fromValue(value);
+    }
+    case VariantCode::VECTOR_DOUBLE:
+        return Variant::fromValue(read_doubles(stream));
+    case VariantCode::DOUBLE_ARRAY:
+        return Variant::fromValue(DoubleArray(read_doubles(stream)));
+    case VariantCode::COMBOPROPERTY: {
+        ComboProperty combo;
+        combo.setStringOfValues(read_string(stream));
+        combo.setStringOfSelections(read_string(stream));
+        return Variant::fromValue(combo);
+    }
+    case VariantCode::QCOLOR: {
+        QColor color;
+        stream >> color;
+        return Variant::fromValue(color);
+    }
+    case VariantCode::EXTPROPERTY: {
+        const auto text = read_string(stream);
+        QColor color;
+        stream >> color;
+        const auto identifier = read_string(stream);
+        return Variant::fromValue(ExternalProperty(text, color, identifier));
+    }
+    case VariantCode::REALLIMITS: {
+        const auto text = read_string(stream);
+        double min{0.0}, max{0.0};
+        stream >> min >> max;
+        return Variant::fromValue(JsonUtils::CreateLimits(text, min, max));
+    }
+    case VariantCode::MAPPED_DOUBLE_ARRAY:
+        break;
+    }
+
+    throw std::runtime_error("Error in BinaryItemConverter: unknown variant code.");
+}
+
+void write_taginfo(QDataStream& stream, const TagInfo& tag_info)
+{
+    write_string(stream, tag_info.name());
+    stream << static_cast<qint32>(tag_info.min()) << static_cast<qint32>(tag_info.max());
+    const auto model_types = tag_info.modelTypes();
+    stream << static_cast<quint32>(model_types.size());
+    for (const auto& model_type : model_types)
+        write_string(stream, model_type);
+}
+
+TagInfo read_taginfo(QDataStream& stream)
+{
+    const auto name = read_string(stream);
+    qint32 min{0}, max{0};
+    quint32 count{0};
+    stream >> min >> max >> count;
+    check_status(stream);
+    std::vector<std::string> model_types;
+    for (quint32 i = 0; i < count; ++i)
+        model_types.push_back(read_string(stream));
+    return TagInfo(name, min, max, model_types);
+}
+
+//! Returns true if given role should be saved. As in project mode of JsonItemConverter, only
+//! identifier and data go to disk.
+bool is_persistent_role(int role)
+{
+    return role == ItemDataRole::IDENTIFIER || role == ItemDataRole::DATA;
+}
+
+} // namespace
+
+struct BinaryItemConverter::BinaryItemConverterImpl {
+    const ItemFactoryInterface* m_factory{nullptr};
+    BinaryArrayWriter* m_array_writer{nullptr};
+    const MappedArrayReader* m_array_reader{nullptr};
+
+    BinaryItemConverterImpl(const ItemFactoryInterface* factory, BinaryArrayWriter* array_writer,
+                            const MappedArrayReader* array_reader)
+        : m_factory(factory), m_array_writer(array_writer), m_array_reader(array_reader)
+    {
+    }
+
+    //! Writes variant to the stream. Large arrays go to the sidecar file, if writer exists.
+    void write_variant(QDataStream& stream, const Variant& variant)
+    {
+        const auto code = variant_code(variant);
+        if (code == VariantCode::DOUBLE_ARRAY && m_array_writer) {
+            const auto array = variant.value<DoubleArray>();
+            if (m_array_writer->isAccepted(array)) {
+                const auto offset = m_array_writer->write(array);
+                stream << static_cast<quint8>(VariantCode::MAPPED_DOUBLE_ARRAY)
+                       << static_cast<quint64>(offset) << static_cast<quint64>(array.size());
+                return;
+            }
+        }
+        write_value(stream, variant, code);
+    }
+
+    Variant read_variant(QDataStream& stream)
+    {
+        quint8 value{0};
+        stream >> value;
+        check_status(stream);
+
+        const auto code = static_cast<VariantCode>(value);
+        if (code == VariantCode::MAPPED_DOUBLE_ARRAY) {
+            if (!m_array_reader)
+                throw std::runtime_error("Error in BinaryItemConverter: no array file to read "
+                                         "mapped array from.");
+            quint64 offset{0}, size{0};
+            stream >> offset >> size;
+            check_status(stream);
+            return Variant::fromValue(m_array_reader->array(offset, size));
+        }
+        return read_value(stream, code);
+    }
+
+    void write_data(QDataStream& stream, const SessionItemData& item_data)
+    {
+        quint32 count{0};
+        for (const auto& x : item_data)
+            if (is_persistent_role(x.m_role))
+                ++count;
+
+        stream << count;
+        for (const auto& x : item_data) {
+            if (is_persistent_role(x.m_role)) {
+                stream << static_cast<qint32>(x.m_role);
+                write_variant(stream, x.m_data);
+            }
+        }
+    }
+
+    void read_data(QDataStream& stream, SessionItemData& item_data)
+    {
+        quint32 count{0};
+        stream >> count;
+        check_status(stream);
+        for (quint32 i = 0; i < count; ++i) {
+            qint32 role{0};
+            stream >> role;
+            check_status(stream);
+            auto variant = read_variant(stream);
+            if (is_persistent_role(role))
+                item_data.setData(variant, role);
+        }
+    }
+
+    void write_tags(QDataStream& stream, const SessionItemTags& item_tags)
+    {
+        write_string(stream, item_tags.defaultTag());
+        stream << static_cast<quint32>(item_tags.tagsCount());
+        for (auto container : item_tags) {
+            write_taginfo(stream, container->tagInfo());
+            stream << static_cast<quint32>(container->itemCount());
+            for (auto item : *container)
+                write_item(stream, *item);
+        }
+    }
+
+    //! Populates tags from the stream. If tags are empty, containers are created from the stream.
+    //! Otherwise, as in project mode of JsonItemConverter, existing containers are populated
+    //! and items created by the item constructor are updated in place.
+    void read_tags(QDataStream& stream, SessionItemTags& item_tags)
+    {
+        const auto default_tag = read_string(stream);
+        quint32 tags_count{0};
+        stream >> tags_count;
+        check_status(stream);
+
+        const bool create_containers = item_tags.tagsCount() == 0;
+        if (create_containers)
+            item_tags.setDefaultTag(default_tag);
+        else if (static_cast<int>(tags_count) != item_tags.tagsCount())
+            throw std::runtime_error("Error in BinaryItemConverter: mismatch in number of tags.");
+        else if (default_tag != item_tags.defaultTag())
+            throw std::runtime_error("Error in BinaryItemConverter: default tag mismatch.");
+
+        for (quint32 index = 0; index < tags_count; ++index) {
+            const auto tag_info = read_taginfo(stream);
+            if (create_containers)
+                item_tags.registerTag(tag_info);
+
+            auto& container = item_tags.at(static_cast<int>(index));
+            if (tag_info.name() != container.name())
+                throw std::runtime_error("Error in BinaryItemConverter: tag '" + tag_info.name()
+                                         + "' doesn't match container '" + container.name()
+                                         + "'.");
+            read_container(stream, container, tag_info);
+        }
+    }
+
+    //! Populates container from the stream. Items of property and group tags are updated in place,
+    //! items of universal tags are created anew.
+    void read_container(QDataStream& stream, SessionItemContainer& container,
+                        const TagInfo& tag_info)
+    {
+        quint32 items_count{0};
+        stream >> items_count;
+        check_status(stream);
+
+        if (!container.empty()
+            && (Compatibility::IsCompatibleSinglePropertyTag(container, tag_info)
+                || Compatibility::IsCompatibleGroupTag(container, tag_info))) {
+            if (static_cast<int>(items_count) != container.itemCount())
+                throw std::runtime_error("Error in BinaryItemConverter: size of tag '"
+                                         + container.name() + "' is different.");
+            for (int i = 0; i < container.itemCount(); ++i)
+                update_item(stream, *container.itemAt(i));
+            return;
+        }
+
+        if (!container.empty() && !Compatibility::IsCompatibleUniversalTag(container, tag_info))
+            throw std::runtime_error("Error in BinaryItemConverter: can't populate tag '"
+                                     + container.name() + "'.");
+
+        for (quint32 i = 0; i < items_count; ++i) {
+            auto child = read_item(stream);
+            if (!container.insertItem(child.get(), container.itemCount()))
+                throw std::runtime_error("Error in BinaryItemConverter: can't insert item of type '"
+                                         + child->modelType() + "' into tag '" + container.name()
+                                         + "'.");
+            child.release();
+        }
+    }
+
+    void write_item(QDataStream& stream, const SessionItem& item)
+    {
+        write_string(stream, item.modelType());
+        write_data(stream, *item.itemData());
+        write_tags(stream, *item.itemTags());
+    }
+
+    //! Populates data and tags of the item from the stream. Roles which are not saved, i.e. the
+    //! display name, tooltips and limits set by the item constructor, are kept.
+    void populate_item(QDataStream& stream, SessionItem& item)
+    {
+        read_data(stream, *item.itemData());
+        read_tags(stream, *item.itemTags());
+
+        for (auto child : item.children())
+            child->setParent(&item);
+    }
+
+    std::unique_ptr<SessionItem> read_item(QDataStream& stream)
+    {
+        IdentifierLoadingScope scope;
+        auto result = m_factory->createItem(read_string(stream));
+        populate_item(stream, *result);
+        scope.assignMissing(*result);
+        return result;
+    }
+
+    //! Updates existing item from the stream. Stored model type should match the item.
+    void update_item(QDataStream& stream, SessionItem& item)
+    {
+        const auto model_type = read_string(stream);
+        if (model_type != item.modelType())
+            throw std::runtime_error("Error in BinaryItemConverter: item model mismatch, expected '"
+                                     + item.modelType() + "', got '" + model_type + "'.");
+        IdentifierLoadingScope scope;
+        populate_item(stream, item);
+        scope.assignMissing(item);
+    }
+};
+
+BinaryItemConverter::BinaryItemConverter(const ItemFactoryInterface* factory,
+                                         BinaryArrayWriter* array_writer,
+                                         const MappedArrayReader* array_reader)
+    : p_impl(std::make_unique<BinaryItemConverterImpl>(factory, array_writer, array_reader))
+{
+    if (!factory)
+        throw std::runtime_error("Error in BinaryItemConverter: item factory is not initialized.");
+}
+
+BinaryItemConverter::~BinaryItemConverter() = default;
+
+//! Writes item with all its children to the stream.
+
+void BinaryItemConverter::write(QDataStream& stream, const SessionItem& item) const
+{
+    p_impl->write_item(stream, item);
+}
+
+//! Reconstructs item with all its children from the stream.
+
+std::unique_ptr<SessionItem> BinaryItemConverter::read(QDataStream& stream) const
+{
+    return p_impl->read_item(stream);
+}
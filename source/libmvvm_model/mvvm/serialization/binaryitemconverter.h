@@ -0,0 +1,54 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_BINARYITEMCONVERTER_H
+#define MVVM_SERIALIZATION_BINARYITEMCONVERTER_H
+
+#include "mvvm/model_export.h"
+#include <memory>
+
+class QDataStream;
+
+namespace ModelView {
+
+class SessionItem;
+class ItemFactoryInterface;
+class BinaryArrayWriter;
+class MappedArrayReader;
+
+//! Converter between SessionItem and compact binary stream.
+
+//! Mirrors the tree written by JsonItemConverter in project mode (model type, identifier and data
+//! roles, tags with their containers). On reading, items are created by the factory and only saved
+//! roles are overwritten, so runtime roles set by item constructors are kept. Numeric arrays are
+//! stored as raw little-endian blocks. If the array writer is given, large arrays are stored in its
+//! sidecar file instead, and are read back as lazy arrays from the given reader.
+
+class MVVM_MODEL_EXPORT BinaryItemConverter {
+public:
+    BinaryItemConverter(const ItemFactoryInterface* factory,
+                        BinaryArrayWriter* array_writer = nullptr,
+                        const MappedArrayReader* array_reader = nullptr);
+    BinaryItemConverter(const BinaryItemConverter&) = delete;
+    BinaryItemConverter& operator=(const BinaryItemConverter&) = delete;
+
+    ~BinaryItemConverter();
+
+    void write(QDataStream& stream, const SessionItem& item) const;
+
+    std::unique_ptr<SessionItem> read(QDataStream& stream) const;
+
+private:
+    struct BinaryItemConverterImpl;
+    std::unique_ptr<BinaryItemConverterImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_BINARYITEMCONVERTER_H
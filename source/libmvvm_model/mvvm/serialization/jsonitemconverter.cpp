@@ -10,6 +10,7 @@
 #include "mvvm/serialization/jsonitemconverter.h"
 #include "mvvm/core/uniqueidgenerator.h"
 #include "mvvm/interfaces/itemfactoryinterface.h"
+#include "mvvm/model/identifierloadingscope.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionitemdata.h"
 #include "mvvm/model/sessionitemtags.h"
@@ -128,9 +129,11 @@ std::unique_ptr<SessionItem> JsonItemConverter::from_json(const QJsonObject& jso
                                  "can't represent a SessionItem.");
 
     auto modelType = json[JsonItemFormatAssistant::modelKey].toString().toStdString();
+    IdentifierLoadingScope scope;
     auto result = p_impl->factory()->createItem(modelType);
 
     p_impl->populate_item(json, *result);
+    scope.assignMissing(*result);
 
     return result;
 }
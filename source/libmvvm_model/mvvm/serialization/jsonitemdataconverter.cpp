@@ -8,6 +8,8 @@
 // ************************************************************************** //
 
 #include "mvvm/serialization/jsonitemdataconverter.h"
+#include "mvvm/model/customvariants.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/mvvm_types.h"
 #include "mvvm/model/sessionitemdata.h"
 #include "mvvm/serialization/jsonitemformatassistant.h"
@@ -25,6 +27,15 @@ QJsonValue keyValue(const QJsonValue& parent_value, const QString& key)
     const QJsonObject& parent_object = parent_value.toObject();
     return parent_object.value(key);
 }
+
+//! Returns variant converted to the type of existing data, when the type was changed since the
+//! document was saved. Values of arrays, saved as std::vector<double>, go to DoubleArray.
+Variant to_runtime_type(const Variant& persistent, const Variant& runtime)
+{
+    if (Utils::IsDoubleArrayVariant(runtime) && Utils::IsDoubleVectorVariant(persistent))
+        return Variant::fromValue(DoubleArray(persistent.value<std::vector<double>>()));
+    return persistent;
+}
 } // namespace
 
 JsonItemDataConverter::JsonItemDataConverter(accept_strategy_t to_json_accept,
@@ -79,7 +90,7 @@ void JsonItemDataConverter::from_json(const QJsonArray& object, SessionItemData&
     for (auto role : roles) {
         // all roles existing in `persistent` will be taken from there
         if (persistent_data->hasData(role))
-            data.setData(persistent_data->data(role), role);
+            data.setData(to_runtime_type(persistent_data->data(role), data.data(role)), role);
     }
 }
 
@@ -0,0 +1,91 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/serialization/mappedarrayreader.h"
+#include "mvvm/model/doublearray.h"
+#include <QFile>
+#include <QtEndian>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using namespace ModelView;
+
+namespace {
+const char sidecar_magic[] = "MVVMDATA";
+const qint64 sidecar_magic_size = 8;
+
+//! Memory-mapped sidecar file. Shared by all arrays which haven't been loaded yet.
+
+struct MappedFile {
+    QFile m_file;
+    const uchar* m_data{nullptr};
+    qint64 m_size{0};
+
+    MappedFile(const std::string& file_name) : m_file(QString::fromStdString(file_name))
+    {
+        if (!m_file.open(QIODevice::ReadOnly))
+            throw std::runtime_error("Error in MappedArrayReader: can't read the file '"
+                                     + file_name + "'");
+        m_size = m_file.size();
+        if (m_size >= sidecar_magic_size)
+            m_data = m_file.map(0, m_size);
+        if (!m_data)
+            throw std::runtime_error("Error in MappedArrayReader: can't map the file '" + file_name
+                                     + "'");
+        if (std::memcmp(m_data, sidecar_magic, sidecar_magic_size) != 0)
+            throw std::runtime_error("Error in MappedArrayReader: file '" + file_name
+                                     + "' is not an array file.");
+    }
+};
+
+} // namespace
+
+struct MappedArrayReader::MappedArrayReaderImpl {
+    std::string m_file_name;
+    std::shared_ptr<MappedFile> m_mapped_file;
+
+    MappedArrayReaderImpl(std::string file_name) : m_file_name(std::move(file_name)) {}
+
+    //! Maps the file on first request.
+    const std::shared_ptr<MappedFile>& mapped_file()
+    {
+        if (!m_mapped_file)
+            m_mapped_file = std::make_shared<MappedFile>(m_file_name);
+        return m_mapped_file;
+    }
+};
+
+MappedArrayReader::MappedArrayReader(const std::string& file_name)
+    : p_impl(std::make_unique<MappedArrayReaderImpl>(file_name))
+{
+}
+
+MappedArrayReader::~MappedArrayReader() = default;
+
+//! Returns lazy array of given size located at given offset (in bytes) of the file.
+
+DoubleArray MappedArrayReader::array(uint64_t offset, uint64_t size) const
+{
+    auto mapped_file = p_impl->mapped_file();
+
+    const auto file_size = static_cast<uint64_t>(mapped_file->m_size);
+    if (offset < static_cast<uint64_t>(sidecar_magic_size) || offset > file_size
+        || size > (file_size - offset) / sizeof(double))
+        throw std::runtime_error("Error in MappedArrayReader: array is outside of the file '"
+                                 + p_impl->m_file_name + "'");
+
+    auto loader = [mapped_file, offset, size]() {
+        std::vector<double> result(static_cast<size_t>(size));
+        qFromLittleEndian<double>(mapped_file->m_data + offset, static_cast<qsizetype>(size),
+                                  result.data());
+        return result;
+    };
+    return DoubleArray::createLazy(static_cast<size_t>(size), loader);
+}
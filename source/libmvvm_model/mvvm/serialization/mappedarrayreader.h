@@ -0,0 +1,44 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_SERIALIZATION_MAPPEDARRAYREADER_H
+#define MVVM_SERIALIZATION_MAPPEDARRAYREADER_H
+
+#include "mvvm/model_export.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ModelView {
+
+class DoubleArray;
+
+//! Provides lazily loaded arrays from the sidecar file written by BinaryArrayWriter.
+
+//! The file is memory-mapped on first request. Returned arrays copy their content from the
+//! mapping on first access only, so arrays which are never looked at cost neither load time nor
+//! memory. The mapping stays alive while there are arrays which haven't been loaded yet.
+
+class MVVM_MODEL_EXPORT MappedArrayReader {
+public:
+    explicit MappedArrayReader(const std::string& file_name);
+    MappedArrayReader(const MappedArrayReader&) = delete;
+    MappedArrayReader& operator=(const MappedArrayReader&) = delete;
+    ~MappedArrayReader();
+
+    DoubleArray array(uint64_t offset, uint64_t size) const;
+
+private:
+    struct MappedArrayReaderImpl;
+    std::unique_ptr<MappedArrayReaderImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_SERIALIZATION_MAPPEDARRAYREADER_H
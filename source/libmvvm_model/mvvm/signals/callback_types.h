@@ -25,6 +25,7 @@ using item_t = std::function<void(SessionItem*)>;
 using item_int_t = std::function<void(SessionItem*, int)>;
 using item_str_t = std::function<void(SessionItem*, std::string)>;
 using item_tagrow_t = std::function<void(SessionItem*, TagRow)>;
+using item_str_int_int_t = std::function<void(SessionItem*, std::string, int, int)>;
 using model_t = std::function<void(SessionModel*)>;
 } // namespace Callbacks
 
@@ -12,9 +12,11 @@
 
 #include "mvvm/model_export.h"
 #include "mvvm/signals/callback_types.h"
+#include "mvvm/utils/openhashmap.h"
 #include <algorithm>
+#include <cstdint>
 #include <functional>
-#include <list>
+#include <vector>
 
 namespace ModelView {
 
@@ -23,41 +25,223 @@ class SessionModel;
 
 //! Container to hold callbacks in the context of ModelMapper.
 
+//! Callbacks are stored contiguously in the order of connection, and are called in this order.
+//! Every connection gets a handle, which stays valid until disconnection and never refers
+//! to another connection afterwards. Disconnection by handle, or by client, costs O(1) per
+//! connection: the callback is marked as disconnected, and the storage is compacted when
+//! disconnected callbacks make up the half of it. Callbacks may connect and disconnect during
+//! the notification; callbacks connected during the notification are called from the next one.
+
 template <typename T, typename U> class SignalBase {
 public:
+    //! Handle of the connection.
+    struct Connection {
+        uint32_t index{no_index};
+        uint32_t generation{0};
+    };
+
     SignalBase() = default;
+    SignalBase(const SignalBase& other) = delete;
+    SignalBase& operator=(const SignalBase& other) = delete;
+
+    Connection connect(T callback, U client);
 
-    void connect(T callback, U client);
+    template <typename... Args> void operator()(Args&&... args);
 
-    template <typename... Args> void operator()(Args... args);
+    void disconnect(Connection connection);
 
     void remove_client(U client);
 
+    //! Returns number of connected callbacks.
+    size_t size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
 private:
-    std::list<std::pair<T, U>> m_callbacks;
+    static constexpr uint32_t no_index = static_cast<uint32_t>(-1);
+
+    //! Callback in the order of connection.
+    struct Entry {
+        T callback;
+        uint32_t handle{no_index}; //!< index in m_handles, or no_index for disconnected callback
+    };
+
+    //! Connection data addressed by the handle. Connections of the same client are linked into
+    //! the list, so they can be removed without search.
+    struct Handle {
+        uint32_t position{no_index}; //!< index in m_entries, or no_index for free handle
+        uint32_t generation{0};
+        U client{};
+        uint32_t prev{no_index};
+        uint32_t next{no_index};
+    };
+
+    Entry& entry(uint32_t position);
+    void release(uint32_t handle);
+    void compact();
+
+    std::vector<Entry> m_entries;
+    std::vector<Entry> m_connected_on_emission; //!< to not move callbacks while they are running
+    std::vector<Handle> m_handles;
+    std::vector<uint32_t> m_free_handles;
+    std::vector<uint32_t> m_released_on_emission; //!< positions of callbacks to destroy after it
+    OpenHashMap<U, uint32_t> m_clients; //!< the most recent connection of every client
+    size_t m_size{0};
+    int m_emission_depth{0};
 };
 
-template <typename T, typename U> void SignalBase<T, U>::connect(T callback, U client)
+template <typename T, typename U>
+typename SignalBase<T, U>::Connection SignalBase<T, U>::connect(T callback, U client)
 {
-    m_callbacks.push_back(std::make_pair(callback, client));
+    uint32_t handle;
+    if (m_free_handles.empty()) {
+        handle = static_cast<uint32_t>(m_handles.size());
+        m_handles.emplace_back();
+    } else {
+        handle = m_free_handles.back();
+        m_free_handles.pop_back();
+    }
+
+    auto& data = m_handles[handle];
+    data.position = static_cast<uint32_t>(m_entries.size() + m_connected_on_emission.size());
+    data.client = client;
+    data.prev = no_index;
+    data.next = no_index;
+    if (auto head = m_clients.find(client)) {
+        data.next = *head;
+        m_handles[*head].prev = handle;
+        *head = handle;
+    } else {
+        m_clients.insert(client, handle);
+    }
+
+    if (m_emission_depth > 0)
+        m_connected_on_emission.push_back({std::move(callback), handle});
+    else
+        m_entries.push_back({std::move(callback), handle});
+    ++m_size;
+    return {handle, data.generation};
 }
 
 //! Notify clients using given list of arguments.
+
 template <typename T, typename U>
 template <typename... Args>
-void SignalBase<T, U>::operator()(Args... args)
+void SignalBase<T, U>::operator()(Args&&... args)
 {
-    for (const auto& f : m_callbacks) {
-        f.first(args...);
+    struct EmissionGuard {
+        SignalBase& signal;
+        EmissionGuard(SignalBase& signal) : signal(signal) { ++signal.m_emission_depth; }
+        ~EmissionGuard()
+        {
+            if (--signal.m_emission_depth == 0)
+                signal.compact();
+        }
+    } guard(*this);
+
+    const size_t count = m_entries.size();
+    for (size_t i = 0; i < count; ++i) {
+        const auto& entry = m_entries[i];
+        if (entry.handle != no_index)
+            entry.callback(args...);
     }
 }
 
+//! Disconnects callback with given handle. Handles of already disconnected callbacks are ignored.
+
+template <typename T, typename U> void SignalBase<T, U>::disconnect(Connection connection)
+{
+    if (connection.index >= m_handles.size())
+        return;
+
+    const auto& data = m_handles[connection.index];
+    if (data.position == no_index || data.generation != connection.generation)
+        return;
+
+    if (data.prev != no_index)
+        m_handles[data.prev].next = data.next;
+    else if (data.next != no_index)
+        *m_clients.find(data.client) = data.next;
+    else
+        m_clients.erase(data.client);
+    if (data.next != no_index)
+        m_handles[data.next].prev = data.prev;
+
+    release(connection.index);
+    compact();
+}
+
 //! Remove client from the list to call back.
 
 template <typename T, typename U> void SignalBase<T, U>::remove_client(U client)
 {
-    m_callbacks.remove_if(
-        [client](const std::pair<T, U>& x) -> bool { return (x.second == client ? true : false); });
+    auto head = m_clients.find(client);
+    if (!head)
+        return;
+
+    for (uint32_t handle = *head; handle != no_index;) {
+        const uint32_t next = m_handles[handle].next;
+        release(handle);
+        handle = next;
+    }
+    m_clients.erase(client);
+    compact();
+}
+
+//! Marks callback of the given connection as disconnected, and makes the handle free. Callback
+//! itself is destroyed right away, unless notification is in progress.
+
+template <typename T, typename U> void SignalBase<T, U>::release(uint32_t handle)
+{
+    auto& data = m_handles[handle];
+    auto& disconnected = entry(data.position);
+    disconnected.handle = no_index;
+    if (m_emission_depth == 0)
+        disconnected.callback = T();
+    else
+        m_released_on_emission.push_back(data.position);
+    data.position = no_index;
+    ++data.generation;
+    m_free_handles.push_back(handle);
+    --m_size;
+}
+
+template <typename T, typename U>
+typename SignalBase<T, U>::Entry& SignalBase<T, U>::entry(uint32_t position)
+{
+    return position < m_entries.size() ? m_entries[position]
+                                       : m_connected_on_emission[position - m_entries.size()];
+}
+
+//! Appends callbacks connected during the notification, destroys callbacks disconnected during
+//! it, and removes disconnected callbacks, when they make up the half of the storage. Storage is
+//! kept intact during the notification, since one of callbacks is running.
+
+template <typename T, typename U> void SignalBase<T, U>::compact()
+{
+    if (m_emission_depth > 0)
+        return;
+
+    if (!m_connected_on_emission.empty()) {
+        for (auto& x : m_connected_on_emission)
+            m_entries.push_back(std::move(x));
+        m_connected_on_emission.clear();
+    }
+
+    if (!m_released_on_emission.empty()) {
+        for (auto position : m_released_on_emission)
+            m_entries[position].callback = T();
+        m_released_on_emission.clear();
+    }
+
+    if (m_size * 2 > m_entries.size())
+        return;
+
+    auto is_disconnected = [](const Entry& entry) { return entry.handle == no_index; };
+    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), is_disconnected),
+                    m_entries.end());
+    for (size_t i = 0; i < m_entries.size(); ++i)
+        m_handles[m_entries[i].handle].position = static_cast<uint32_t>(i);
 }
 
 //! Callback container for specific client type.
@@ -11,20 +11,20 @@
 #define MVVM_SIGNALS_ITEMMAPPER_H
 
 #include "mvvm/interfaces/itemlistenerinterface.h"
-#include "mvvm/signals/modellistener.h"
 #include <memory>
 
 namespace ModelView {
 
 class SessionItem;
+class SessionModel;
 
 //! Provides notifications on various changes for a specific item.
-//! ItemMapper listens signals coming from the model (i.e. via ModelMapper) and processes only whose
-//! signals which are related to the given item. Notifies all interested subscribers about things
-//! going with the item and its relatives.
+//! ItemMapper is registered in the ModelMapper of the item's model, which forwards to it only
+//! signals related to the given item: changes of the item itself, of its properties and of
+//! properties of its children. Notifies all interested subscribers about things going with the
+//! item and its relatives.
 
-class MVVM_MODEL_EXPORT ItemMapper : public ItemListenerInterface,
-                                     private ModelListener<SessionModel> {
+class MVVM_MODEL_EXPORT ItemMapper : public ItemListenerInterface {
 public:
     ItemMapper(SessionItem* item);
     ~ItemMapper();
@@ -43,7 +43,16 @@ public:
 
 private:
     friend class SessionItem;
+    friend class ModelMapper;
     void callOnItemDestroy();
+    void setModel(SessionModel* model);
+
+    void callOnDataChange(SessionItem* item, int role);
+    void callOnPropertyChange(SessionItem* item, const std::string& property_name);
+    void callOnChildPropertyChange(SessionItem* item, const std::string& property_name);
+    void callOnItemInserted(SessionItem* parent, const TagRow& tagrow);
+    void callOnItemRemoved(SessionItem* parent, const TagRow& tagrow);
+    void callOnAboutToRemoveItem(SessionItem* parent, const TagRow& tagrow);
 
     struct ItemMapperImpl;
     std::unique_ptr<ItemMapperImpl> p_impl;
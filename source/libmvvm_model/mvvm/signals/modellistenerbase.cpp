@@ -42,6 +42,14 @@ void ModelListenerBase::setOnItemInserted(ModelView::Callbacks::item_tagrow_t f,
     m_model->mapper()->setOnItemInserted(f, this);
 }
 
+//! Sets callback to be notified on insertion of the range of items. The callback will be called
+//! with (SessionItem* parent, tag, first, count).
+
+void ModelListenerBase::setOnItemsInserted(Callbacks::item_str_int_int_t f, Callbacks::slot_t)
+{
+    m_model->mapper()->setOnItemsInserted(f, this);
+}
+
 //! Sets callback to be notified on item remove. The callback will be called with
 //! (SessionItem* parent, tagrow), where 'tagrow' denotes child position before the removal.
 
@@ -59,6 +67,23 @@ void ModelListenerBase::setOnAboutToRemoveItem(ModelView::Callbacks::item_tagrow
     m_model->mapper()->setOnAboutToRemoveItem(f, this);
 }
 
+//! Sets callback to be notified on removal of the range of items. The callback will be called
+//! with (SessionItem* parent, tag, first, count).
+
+void ModelListenerBase::setOnItemsRemoved(Callbacks::item_str_int_int_t f, Callbacks::slot_t)
+{
+    m_model->mapper()->setOnItemsRemoved(f, this);
+}
+
+//! Sets callback to be notified when the range of items is about to be removed. The callback will
+//! be called with (SessionItem* parent, tag, first, count).
+
+void ModelListenerBase::setOnAboutToRemoveItems(Callbacks::item_str_int_int_t f,
+                                                Callbacks::slot_t)
+{
+    m_model->mapper()->setOnAboutToRemoveItems(f, this);
+}
+
 //! Sets the callback for notifications on model destruction.
 
 void ModelListenerBase::setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t)
@@ -80,6 +105,14 @@ void ModelListenerBase::setOnModelReset(ModelView::Callbacks::model_t f, Callbac
     m_model->mapper()->setOnModelReset(f, this);
 }
 
+//! Sets the callback to be notified after all notifications of the model transaction have been
+//! delivered.
+
+void ModelListenerBase::setOnTransactionCommitted(Callbacks::model_t f, Callbacks::slot_t)
+{
+    m_model->mapper()->setOnTransactionCommitted(f, this);
+}
+
 void ModelListenerBase::unsubscribe(Callbacks::slot_t)
 {
     if (m_model)
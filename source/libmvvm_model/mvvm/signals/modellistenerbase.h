@@ -29,11 +29,17 @@ public:
 
     void setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client = {}) override;
     void setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t client = {}) override;
+    void setOnItemsInserted(Callbacks::item_str_int_int_t f,
+                            Callbacks::slot_t client = {}) override;
     void setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client = {}) override;
     void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t client = {}) override;
+    void setOnItemsRemoved(Callbacks::item_str_int_int_t f, Callbacks::slot_t client = {}) override;
+    void setOnAboutToRemoveItems(Callbacks::item_str_int_int_t f,
+                                 Callbacks::slot_t client = {}) override;
     void setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
     void setOnModelAboutToBeReset(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
     void setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
+    void setOnTransactionCommitted(Callbacks::model_t f, Callbacks::slot_t client = {}) override;
 
     void unsubscribe(Callbacks::slot_t client = {}) override;
 
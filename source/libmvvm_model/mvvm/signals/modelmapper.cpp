@@ -8,33 +8,219 @@
 // ************************************************************************** //
 
 #include "mvvm/signals/modelmapper.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
 #include "mvvm/signals/callbackcontainer.h"
+#include "mvvm/signals/itemmapper.h"
+#include "mvvm/utils/openhashmap.h"
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <vector>
 
 using namespace ModelView;
 
 struct ModelMapper::ModelMapperImpl {
+    //! Notification recorded during the transaction, either data change or insertion of the range.
+    struct PendingNotification {
+        SessionItem* item{nullptr}; //!< changed item, or parent of inserted items
+        int role{0};
+        TagName tag;
+        int first{0};
+        int count{0}; //!< zero for data change notification
+    };
+
     Signal<Callbacks::item_int_t> m_on_data_change;
     Signal<Callbacks::item_tagrow_t> m_on_item_inserted;
+    Signal<Callbacks::item_str_int_int_t> m_on_items_inserted;
     Signal<Callbacks::item_tagrow_t> m_on_item_removed;
+    Signal<Callbacks::item_str_int_int_t> m_on_items_removed;
     Signal<Callbacks::item_tagrow_t> m_on_item_about_removed;
+    Signal<Callbacks::item_str_int_int_t> m_on_items_about_removed;
     Signal<Callbacks::model_t> m_on_model_destroyed;
     Signal<Callbacks::model_t> m_on_model_about_reset;
     Signal<Callbacks::model_t> m_on_model_reset;
+    Signal<Callbacks::model_t> m_on_transaction_committed;
 
     bool m_active{true};
     SessionModel* m_model{nullptr};
 
+    int m_transaction_level{0};
+    std::vector<PendingNotification> m_pending;
+    std::set<std::pair<SessionItem*, int>> m_pending_data_changes;
+    //! Indices in m_pending of the pending insertions, grouped by parent and tag id, in the order
+    //! of their rows.
+    std::map<std::pair<SessionItem*, int>, std::vector<size_t>> m_pending_insertions;
+
+    //! Range of items being removed by the bulk removal, notifications on removal of single items
+    //! are suppressed while it is in progress.
+    struct RemovalRange {
+        SessionItem* parent{nullptr};
+        TagName tag;
+        int first{0};
+        int count{0};
+    };
+    std::optional<RemovalRange> m_removal;
+
+    //! Item mappers, indexed by their items. Notifications are forwarded only to mappers of items
+    //! they concern, so their cost doesn't depend on the number of mappers.
+    OpenHashMap<SessionItem*, ItemMapper*> m_item_mappers;
+
     ModelMapperImpl(SessionModel* model) : m_model(model){};
 
     void unsubscribe(Callbacks::slot_t client)
     {
         m_on_data_change.remove_client(client);
         m_on_item_inserted.remove_client(client);
+        m_on_items_inserted.remove_client(client);
         m_on_item_removed.remove_client(client);
+        m_on_items_removed.remove_client(client);
         m_on_item_about_removed.remove_client(client);
+        m_on_items_about_removed.remove_client(client);
         m_on_model_destroyed.remove_client(client);
         m_on_model_about_reset.remove_client(client);
         m_on_model_reset.remove_client(client);
+        m_on_transaction_committed.remove_client(client);
+    }
+
+    //! Returns mapper of the given item, if it was created.
+    ItemMapper* item_mapper(SessionItem* item) const
+    {
+        if (!item)
+            return nullptr;
+        auto mapper = m_item_mappers.find(item);
+        return mapper ? *mapper : nullptr;
+    }
+
+    //! Returns mapper of the given item to notify about data changes. The root item's mapper
+    //! is notified only about insertion and removal of its children.
+    ItemMapper* data_mapper(SessionItem* item) const
+    {
+        return item == m_model->rootItem() ? nullptr : item_mapper(item);
+    }
+
+    //! Notifies data change listeners of the model, mapper of the item itself, mapper of its
+    //! parent (property change) and mapper of its grandparent (child property change). Relatives
+    //! and the property name are found before any callback, which might delete the item.
+    void notify_data_change(SessionItem* item, int role)
+    {
+        auto parent = item->parent();
+        auto grandparent = parent ? parent->parent() : nullptr;
+        std::string property_name;
+        if (data_mapper(parent) || data_mapper(grandparent))
+            property_name = parent->tagRowOfItem(item).tag;
+
+        m_on_data_change(item, role);
+
+        if (auto mapper = data_mapper(item))
+            mapper->callOnDataChange(item, role);
+        if (auto mapper = data_mapper(parent))
+            mapper->callOnPropertyChange(parent, property_name);
+        if (auto mapper = data_mapper(grandparent))
+            mapper->callOnChildPropertyChange(parent, property_name);
+    }
+
+    //! Records data change. Repeated changes of the same item's role are reported once.
+    void record_data_change(SessionItem* item, int role)
+    {
+        if (m_pending_data_changes.insert({item, role}).second)
+            m_pending.push_back({item, role, {}, 0, 0});
+    }
+
+    //! Records insertion. Pending ranges of the same parent and tag are kept in rows numbered after
+    //! all recorded insertions. Insertion inside or adjacent to the range extends it, ranges which
+    //! follow the inserted row are shifted. The new range is delivered before the ranges which
+    //! follow it, so listeners can insert rows range by range.
+    void record_insertion(SessionItem* parent, const TagRow& tagrow)
+    {
+        auto& ranges = m_pending_insertions[{parent, tagrow.tag.id()}];
+        const int row = tagrow.row;
+        size_t position = ranges.size(); // place of the new range among ranges of the tag
+        bool extended{false};
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            auto& range = m_pending[ranges[i]];
+            if (!extended && row >= range.first && row <= range.first + range.count) {
+                ++range.count;
+                extended = true;
+            } else if (range.first >= row) {
+                ++range.first;
+                position = std::min(position, i);
+            }
+        }
+        if (extended)
+            return;
+
+        if (position == ranges.size()) {
+            ranges.push_back(m_pending.size());
+            m_pending.push_back({parent, 0, tagrow.tag, row, 1});
+            return;
+        }
+
+        // rare case of insertion before the pending range, which is not adjacent to it
+        const size_t index = ranges[position];
+        m_pending.insert(m_pending.begin() + static_cast<std::ptrdiff_t>(index),
+                         {parent, 0, tagrow.tag, row, 1});
+        for (auto& x : m_pending_insertions)
+            for (auto& pending_index : x.second)
+                if (pending_index >= index)
+                    ++pending_index;
+        ranges.insert(ranges.begin() + static_cast<std::ptrdiff_t>(position), index);
+    }
+
+    void notify_inserted(SessionItem* parent, const TagName& tag, int first, int count)
+    {
+        for (int row = first; row < first + count; ++row) {
+            m_on_item_inserted(parent, TagRow{tag, row});
+            if (auto mapper = item_mapper(parent))
+                mapper->callOnItemInserted(parent, TagRow{tag, row});
+        }
+        m_on_items_inserted(parent, tag, first, count);
+    }
+
+    void notify_about_to_remove(SessionItem* parent, const TagName& tag, int first, int count)
+    {
+        flush();
+        for (int row = first; row < first + count; ++row) {
+            m_on_item_about_removed(parent, TagRow{tag, row});
+            if (auto mapper = item_mapper(parent))
+                mapper->callOnAboutToRemoveItem(parent, TagRow{tag, row});
+        }
+        m_on_items_about_removed(parent, tag, first, count);
+    }
+
+    void notify_removed(SessionItem* parent, const TagName& tag, int first, int count)
+    {
+        for (int row = first; row < first + count; ++row) {
+            m_on_item_removed(parent, TagRow{tag, row});
+            if (auto mapper = item_mapper(parent))
+                mapper->callOnItemRemoved(parent, TagRow{tag, row});
+        }
+        m_on_items_removed(parent, tag, first, count);
+    }
+
+    //! Delivers all recorded notifications. Notifications caused by callbacks themselves are
+    //! recorded too, and delivered on the next pass.
+    void flush()
+    {
+        while (!m_pending.empty()) {
+            auto pending = std::move(m_pending);
+            clear_pending();
+            for (const auto& x : pending) {
+                if (x.count > 0)
+                    notify_inserted(x.item, x.tag, x.first, x.count);
+                else
+                    notify_data_change(x.item, x.role);
+            }
+        }
+    }
+
+    void clear_pending()
+    {
+        m_pending.clear();
+        m_pending_data_changes.clear();
+        m_pending_insertions.clear();
     }
 };
 
@@ -58,6 +244,17 @@ void ModelMapper::setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_
     p_impl->m_on_item_inserted.connect(std::move(f), client);
 }
 
+//! Sets callback to be notified on insertion of the range of items. The callback will be called
+//! with (SessionItem* parent, tag, first, count), where 'first' and 'count' denote the row of the
+//! first inserted child and the number of children inserted. Outside of transaction every
+//! insertion is reported as the range of one item, adjacent insertions made during the
+//! transaction are reported as a single range.
+
+void ModelMapper::setOnItemsInserted(Callbacks::item_str_int_int_t f, Callbacks::slot_t client)
+{
+    p_impl->m_on_items_inserted.connect(std::move(f), client);
+}
+
 //! Sets callback to be notified on item remove. The callback will be called with
 //! (SessionItem* parent, tagrow), where 'tagrow' denotes child position before the removal.
 
@@ -74,6 +271,25 @@ void ModelMapper::setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::
     p_impl->m_on_item_about_removed.connect(std::move(f), client);
 }
 
+//! Sets callback to be notified on removal of the range of items. The callback will be called
+//! with (SessionItem* parent, tag, first, count), where 'first' and 'count' denote the row of the
+//! first removed child before the removal and the number of children removed. Removal of a single
+//! item is reported as the range of one item.
+
+void ModelMapper::setOnItemsRemoved(Callbacks::item_str_int_int_t f, Callbacks::slot_t client)
+{
+    p_impl->m_on_items_removed.connect(std::move(f), client);
+}
+
+//! Sets callback to be notified when the range of items is about to be removed. The callback will
+//! be called with (SessionItem* parent, tag, first, count).
+
+void ModelMapper::setOnAboutToRemoveItems(Callbacks::item_str_int_int_t f,
+                                          Callbacks::slot_t client)
+{
+    p_impl->m_on_items_about_removed.connect(std::move(f), client);
+}
+
 //! Sets the callback for notifications on model destruction.
 
 void ModelMapper::setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client)
@@ -95,6 +311,14 @@ void ModelMapper::setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client
     p_impl->m_on_model_reset.connect(std::move(f), client);
 }
 
+//! Sets the callback to be notified after all notifications of the model transaction have been
+//! delivered.
+
+void ModelMapper::setOnTransactionCommitted(Callbacks::model_t f, Callbacks::slot_t client)
+{
+    p_impl->m_on_transaction_committed.connect(std::move(f), client);
+}
+
 //! Sets activity flag to given value. Will disable all callbacks if false.
 
 void ModelMapper::setActive(bool value)
@@ -102,6 +326,14 @@ void ModelMapper::setActive(bool value)
     p_impl->m_active = value;
 }
 
+//! Returns true if the model transaction is in progress. Remains true while notifications recorded
+//! during the transaction are being delivered.
+
+bool ModelMapper::isInTransaction() const
+{
+    return p_impl->m_transaction_level > 0;
+}
+
 //! Removes given client from all subscriptions.
 
 void ModelMapper::unsubscribe(Callbacks::slot_t client)
@@ -109,41 +341,61 @@ void ModelMapper::unsubscribe(Callbacks::slot_t client)
     p_impl->unsubscribe(client);
 }
 
-//! Notifies all callbacks subscribed to "item data is changed" event.
+//! Notifies all callbacks subscribed to "item data is changed" event. During the transaction the
+//! notification is postponed till the commit.
 
 void ModelMapper::callOnDataChange(SessionItem* item, int role)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_data_change(item, role);
+    if (!p_impl->m_active)
+        return;
+
+    if (isInTransaction())
+        p_impl->record_data_change(item, role);
+    else
+        p_impl->notify_data_change(item, role);
 }
 
-//! Notifies all callbacks subscribed to "item data is changed" event.
+//! Notifies all callbacks subscribed to "item is inserted" event. During the transaction the
+//! notification is postponed till the commit.
 
 void ModelMapper::callOnItemInserted(SessionItem* parent, const TagRow& tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_inserted(parent, tagrow);
+    if (!p_impl->m_active)
+        return;
+
+    if (isInTransaction())
+        p_impl->record_insertion(parent, tagrow);
+    else
+        p_impl->notify_inserted(parent, tagrow.tag, tagrow.row, 1);
 }
 
+//! Notifies all callbacks subscribed to "item is removed" event. Single items removed as a part of
+//! bulk removal are not reported, since the whole range is reported by endRemoveItems().
+
 void ModelMapper::callOnItemRemoved(SessionItem* parent, const TagRow& tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_removed(parent, tagrow);
+    if (p_impl->m_active && !p_impl->m_removal)
+        p_impl->notify_removed(parent, tagrow.tag, tagrow.row, 1);
 }
 
+//! Notifies all callbacks subscribed to "item is about to be removed" event. Notifications
+//! postponed by the transaction are delivered first, while the item still exists.
+
 void ModelMapper::callOnItemAboutToBeRemoved(SessionItem* parent, const TagRow& tagrow)
 {
-    if (p_impl->m_active)
-        p_impl->m_on_item_about_removed(parent, tagrow);
+    if (p_impl->m_active && !p_impl->m_removal)
+        p_impl->notify_about_to_remove(parent, tagrow.tag, tagrow.row, 1);
 }
 
 void ModelMapper::callOnModelDestroyed()
 {
+    p_impl->clear_pending();
     p_impl->m_on_model_destroyed(p_impl->m_model);
 }
 
 void ModelMapper::callOnModelAboutToBeReset()
 {
+    p_impl->flush();
     p_impl->m_on_model_about_reset(p_impl->m_model);
 }
 
@@ -151,3 +403,113 @@ void ModelMapper::callOnModelReset()
 {
     p_impl->m_on_model_reset(p_impl->m_model);
 }
+
+//! Starts the transaction. Transactions can be nested, notifications are delivered when the
+//! outermost transaction is committed.
+
+void ModelMapper::beginTransaction()
+{
+    ++p_impl->m_transaction_level;
+}
+
+//! Commits the transaction. Delivers all notifications recorded, if it was the outermost one.
+
+void ModelMapper::commitTransaction()
+{
+    if (p_impl->m_transaction_level == 0)
+        throw std::runtime_error("Error in ModelMapper: no transaction to commit.");
+
+    if (p_impl->m_transaction_level > 1) {
+        --p_impl->m_transaction_level;
+        return;
+    }
+
+    try {
+        p_impl->flush();
+    } catch (...) {
+        p_impl->clear_pending();
+        p_impl->m_transaction_level = 0;
+        throw;
+    }
+    p_impl->m_transaction_level = 0;
+    p_impl->m_on_transaction_committed(p_impl->m_model);
+}
+
+//! Finishes the transaction, which is left because of the exception. Recorded notifications are
+//! delivered, if it was the outermost one, so listeners stay consistent with the model, but the
+//! commit isn't reported. Exceptions thrown by listeners are suppressed.
+
+void ModelMapper::abortTransaction() noexcept
+{
+    if (p_impl->m_transaction_level == 0)
+        return;
+
+    if (p_impl->m_transaction_level > 1) {
+        --p_impl->m_transaction_level;
+        return;
+    }
+
+    try {
+        p_impl->flush();
+    } catch (...) {
+        p_impl->clear_pending();
+    }
+    p_impl->m_transaction_level = 0;
+}
+
+//! Starts bulk removal of the range of items. Listeners are notified that the whole range is about
+//! to be removed, notifications on removal of single items are suppressed till endRemoveItems().
+
+void ModelMapper::beginRemoveItems(SessionItem* parent, const TagName& tag, int first,
+                                   int count)
+{
+    if (p_impl->m_removal)
+        throw std::runtime_error("Error in ModelMapper: bulk removal is already in progress.");
+
+    if (p_impl->m_active)
+        p_impl->notify_about_to_remove(parent, tag, first, count);
+    p_impl->m_removal = ModelMapperImpl::RemovalRange{parent, tag, first, count};
+}
+
+//! Finishes bulk removal. Listeners are notified that the whole range has been removed.
+
+void ModelMapper::endRemoveItems()
+{
+    if (!p_impl->m_removal)
+        throw std::runtime_error("Error in ModelMapper: no bulk removal in progress.");
+
+    endRemoveItems(p_impl->m_removal->first, p_impl->m_removal->count);
+}
+
+//! Finishes bulk removal, which succeeded only partially. Listeners are notified about the
+//! removal of the given part of the range. Nothing is reported if no items have been removed.
+
+void ModelMapper::endRemoveItems(int first, int count)
+{
+    if (!p_impl->m_removal)
+        throw std::runtime_error("Error in ModelMapper: no bulk removal in progress.");
+
+    auto removal = *p_impl->m_removal;
+    p_impl->m_removal.reset();
+    if (first < removal.first || count < 0 || first + count > removal.first + removal.count)
+        throw std::runtime_error("Error in ModelMapper: removed items are outside of the range.");
+
+    if (p_impl->m_active && count > 0)
+        p_impl->notify_removed(removal.parent, removal.tag, first, count);
+}
+
+//! Registers mapper of the given item. It will be notified about changes of the item, its
+//! properties and properties of its children.
+
+void ModelMapper::registerItemMapper(SessionItem* item, ItemMapper* mapper)
+{
+    if (!p_impl->m_item_mappers.insert(item, mapper))
+        throw std::runtime_error("Error in ModelMapper: item mapper is already registered.");
+}
+
+void ModelMapper::unregisterItemMapper(SessionItem* item, ItemMapper* mapper)
+{
+    auto registered = p_impl->m_item_mappers.find(item);
+    if (registered && *registered == mapper)
+        p_impl->m_item_mappers.erase(item);
+}
@@ -15,6 +15,7 @@
 
 namespace ModelView {
 
+class ItemMapper;
 class SessionItem;
 class SessionModel;
 
@@ -31,19 +32,28 @@ public:
 
     void setOnDataChange(Callbacks::item_int_t f, Callbacks::slot_t client) override;
     void setOnItemInserted(Callbacks::item_tagrow_t f, Callbacks::slot_t client) override;
+    void setOnItemsInserted(Callbacks::item_str_int_int_t f, Callbacks::slot_t client) override;
     void setOnItemRemoved(Callbacks::item_tagrow_t f, Callbacks::slot_t client) override;
     void setOnAboutToRemoveItem(Callbacks::item_tagrow_t f, Callbacks::slot_t client) override;
+    void setOnItemsRemoved(Callbacks::item_str_int_int_t f, Callbacks::slot_t client) override;
+    void setOnAboutToRemoveItems(Callbacks::item_str_int_int_t f,
+                                 Callbacks::slot_t client) override;
     void setOnModelDestroyed(Callbacks::model_t f, Callbacks::slot_t client) override;
     void setOnModelAboutToBeReset(Callbacks::model_t f, Callbacks::slot_t client) override;
     void setOnModelReset(Callbacks::model_t f, Callbacks::slot_t client) override;
+    void setOnTransactionCommitted(Callbacks::model_t f, Callbacks::slot_t client) override;
 
     void setActive(bool value);
 
+    bool isInTransaction() const;
+
     void unsubscribe(Callbacks::slot_t client) override;
 
 private:
     friend class SessionModel;
     friend class SessionItem;
+    friend class ModelTransaction;
+    friend class ItemMapper;
 
     void callOnDataChange(SessionItem* item, int role);
     void callOnItemInserted(SessionItem* parent, const TagRow& tagrow);
@@ -53,6 +63,17 @@ private:
     void callOnModelAboutToBeReset();
     void callOnModelReset();
 
+    void beginTransaction();
+    void commitTransaction();
+    void abortTransaction() noexcept;
+
+    void beginRemoveItems(SessionItem* parent, const TagName& tag, int first, int count);
+    void endRemoveItems();
+    void endRemoveItems(int first, int count);
+
+    void registerItemMapper(SessionItem* item, ItemMapper* mapper);
+    void unregisterItemMapper(SessionItem* item, ItemMapper* mapper);
+
     struct ModelMapperImpl;
     std::unique_ptr<ModelMapperImpl> p_impl;
 };
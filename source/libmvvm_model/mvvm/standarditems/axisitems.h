@@ -23,8 +23,8 @@ namespace ModelView {
 
 class MVVM_MODEL_EXPORT BasicAxisItem : public CompoundItem {
 public:
-    static inline const std::string P_MIN = "P_MIN";
-    static inline const std::string P_MAX = "P_MAX";
+    static inline const TagName P_MIN = "P_MIN";
+    static inline const TagName P_MAX = "P_MAX";
 
     explicit BasicAxisItem(const std::string& model_type);
 
@@ -37,8 +37,8 @@ protected:
 
 class MVVM_MODEL_EXPORT ViewportAxisItem : public BasicAxisItem {
 public:
-    static inline const std::string P_TITLE = "P_TITLE";
-    static inline const std::string P_IS_LOG = "P_IS_LOG";
+    static inline const TagName P_TITLE = "P_TITLE";
+    static inline const TagName P_IS_LOG = "P_IS_LOG";
     explicit ViewportAxisItem(const std::string& model_type = Constants::ViewportAxisItemType);
 
     std::pair<double, double> range() const;
@@ -69,7 +69,7 @@ public:
 
 class MVVM_MODEL_EXPORT FixedBinAxisItem : public BinnedAxisItem {
 public:
-    static inline const std::string P_NBINS = "P_NBINS";
+    static inline const TagName P_NBINS = "P_NBINS";
     explicit FixedBinAxisItem(const std::string& model_type = Constants::FixedBinAxisItemType);
 
     void setParameters(int nbins, double xmin, double xmax);
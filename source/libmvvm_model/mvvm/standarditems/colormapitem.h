@@ -22,10 +22,10 @@ class Data2DItem;
 
 class MVVM_MODEL_EXPORT ColorMapItem : public CompoundItem {
 public:
-    static inline const std::string P_LINK = "P_LINK";
-    static inline const std::string P_TITLE = "P_TITLE";
-    static inline const std::string P_GRADIENT = "P_GRADIENT";
-    static inline const std::string P_INTERPOLATION = "P_INTERPOLATION";
+    static inline const TagName P_LINK = "P_LINK";
+    static inline const TagName P_TITLE = "P_TITLE";
+    static inline const TagName P_GRADIENT = "P_GRADIENT";
+    static inline const TagName P_INTERPOLATION = "P_INTERPOLATION";
 
     ColorMapItem();
 
@@ -20,7 +20,7 @@ class Data2DItem;
 
 class MVVM_MODEL_EXPORT ColorMapViewportItem : public ViewportItem {
 public:
-    static inline const std::string P_ZAXIS = "P_ZAXIS";
+    static inline const TagName P_ZAXIS = "P_ZAXIS";
 
     ColorMapViewportItem();
 
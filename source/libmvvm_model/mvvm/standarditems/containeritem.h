@@ -19,7 +19,7 @@ namespace ModelView {
 
 class MVVM_MODEL_EXPORT ContainerItem : public CompoundItem {
 public:
-    static inline const std::string T_ITEMS = "T_ITEMS";
+    static inline const TagName T_ITEMS = "T_ITEMS";
 
     ContainerItem(const std::string& modelType = Constants::ContainerItemType);
 
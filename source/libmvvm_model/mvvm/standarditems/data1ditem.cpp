@@ -24,9 +24,9 @@ size_t total_bin_count(Data1DItem* item)
 Data1DItem::Data1DItem() : CompoundItem(Constants::Data1DItemType)
 {
     // prevent editing in widgets, since there is no corresponding editor
-    addProperty(P_VALUES, std::vector<double>())->setDisplayName("Values")->setEditable(false);
+    addProperty(P_VALUES, DoubleArray())->setDisplayName("Values")->setEditable(false);
 
-    addProperty(P_ERRORS, std::vector<double>())->setDisplayName("Errors")->setEditable(false);
+    addProperty(P_ERRORS, DoubleArray())->setDisplayName("Errors")->setEditable(false);
 
     registerTag(
         TagInfo(T_AXIS, 0, 1, {Constants::FixedBinAxisItemType, Constants::PointwiseAxisItemType}),
@@ -57,7 +57,23 @@ std::vector<double> Data1DItem::binCenters() const
 //! Sets internal data buffer to given data. If size of axis doesn't match the size of the data,
 //! exception will be thrown.
 
-void Data1DItem::setValues(const std::vector<double>& data)
+void Data1DItem::setValues(std::vector<double> data)
+{
+    setValues(DoubleArray(std::move(data)));
+}
+
+//! Sets internal data buffer to given values. Resolves braced lists, including empty one, which
+//! would be ambiguous between other overloads.
+
+void Data1DItem::setValues(std::initializer_list<double> data)
+{
+    setValues(std::vector<double>(data));
+}
+
+//! Sets internal data buffer to given array. The buffer is shared with the given array, no copying
+//! takes place.
+
+void Data1DItem::setValues(const DoubleArray& data)
 {
     if (total_bin_count(this) != data.size())
         throw std::runtime_error("Data1DItem::setValues() -> Data doesn't match size of axis");
@@ -65,16 +81,30 @@ void Data1DItem::setValues(const std::vector<double>& data)
     setProperty(P_VALUES, data);
 }
 
-//! Returns values stored in bins.
+//! Returns values stored in bins. Returned array shares the buffer with the item.
 
-std::vector<double> Data1DItem::binValues() const
+DoubleArray Data1DItem::binValues() const
 {
-    return property<std::vector<double>>(P_VALUES);
+    return property<DoubleArray>(P_VALUES);
 }
 
 //! Sets errors on values in bins.
 
-void Data1DItem::setErrors(const std::vector<double>& errors)
+void Data1DItem::setErrors(std::vector<double> errors)
+{
+    setErrors(DoubleArray(std::move(errors)));
+}
+
+//! Sets errors on values in bins given as braced list.
+
+void Data1DItem::setErrors(std::initializer_list<double> errors)
+{
+    setErrors(std::vector<double>(errors));
+}
+
+//! Sets errors on values in bins. The buffer is shared with the given array.
+
+void Data1DItem::setErrors(const DoubleArray& errors)
 {
     if (total_bin_count(this) != errors.size())
         throw std::runtime_error("Data1DItem::setErrors() -> Data doesn't match size of axis");
@@ -82,9 +112,9 @@ void Data1DItem::setErrors(const std::vector<double>& errors)
     setProperty(P_ERRORS, errors);
 }
 
-//! Returns value errors stored in bins.
+//! Returns value errors stored in bins. Returned array shares the buffer with the item.
 
-std::vector<double> Data1DItem::binErrors() const
+DoubleArray Data1DItem::binErrors() const
 {
-    return property<std::vector<double>>(P_ERRORS);
+    return property<DoubleArray>(P_ERRORS);
 }
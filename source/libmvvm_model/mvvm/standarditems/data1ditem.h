@@ -11,7 +11,9 @@
 #define MVVM_STANDARDITEMS_DATA1DITEM_H
 
 #include "mvvm/model/compounditem.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/sessionmodel.h"
+#include <initializer_list>
 #include <vector>
 
 namespace ModelView {
@@ -22,9 +24,9 @@ namespace ModelView {
 
 class MVVM_MODEL_EXPORT Data1DItem : public CompoundItem {
 public:
-    static inline const std::string P_VALUES = "P_VALUES";
-    static inline const std::string P_ERRORS = "P_ERRORS";
-    static inline const std::string T_AXIS = "T_AXIS";
+    static inline const TagName P_VALUES = "P_VALUES";
+    static inline const TagName P_ERRORS = "P_ERRORS";
+    static inline const TagName T_AXIS = "T_AXIS";
 
     Data1DItem();
 
@@ -32,11 +34,15 @@ public:
 
     std::vector<double> binCenters() const;
 
-    void setValues(const std::vector<double>& data);
-    std::vector<double> binValues() const;
+    void setValues(std::vector<double> data);
+    void setValues(std::initializer_list<double> data);
+    void setValues(const DoubleArray& data);
+    DoubleArray binValues() const;
 
-    void setErrors(const std::vector<double>& errors);
-    std::vector<double> binErrors() const;
+    void setErrors(std::vector<double> errors);
+    void setErrors(std::initializer_list<double> errors);
+    void setErrors(const DoubleArray& errors);
+    DoubleArray binErrors() const;
 
     //! Inserts axis of given type.
     template <typename T, typename... Args> T* setAxis(Args&&... args);
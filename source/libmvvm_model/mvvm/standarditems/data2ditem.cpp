@@ -26,7 +26,7 @@ size_t total_bin_count(Data2DItem* item)
 Data2DItem::Data2DItem() : CompoundItem(Constants::Data2DItemType)
 {
     // prevent editing in widgets, since there is no corresponding editor
-    addProperty(P_VALUES, std::vector<double>())->setDisplayName("Values")->setEditable(false);
+    addProperty(P_VALUES, DoubleArray())->setDisplayName("Values")->setEditable(false);
 
     registerTag(TagInfo(T_XAXIS, 0, 1, {Constants::FixedBinAxisItemType}));
     registerTag(TagInfo(T_YAXIS, 0, 1, {Constants::FixedBinAxisItemType}));
@@ -56,18 +56,37 @@ BinnedAxisItem* Data2DItem::yAxis() const
     return item<BinnedAxisItem>(T_YAXIS);
 }
 
-void Data2DItem::setContent(const std::vector<double>& data)
+//! Sets internal data buffer to given data. If size of axes doesn't match the size of the data,
+//! exception will be thrown.
+
+void Data2DItem::setContent(std::vector<double> data)
+{
+    setContent(DoubleArray(std::move(data)));
+}
+
+//! Sets internal data buffer to given values. Resolves braced lists, including empty one, which
+//! would be ambiguous between other overloads.
+
+void Data2DItem::setContent(std::initializer_list<double> data)
+{
+    setContent(std::vector<double>(data));
+}
+
+//! Sets internal data buffer to given array. The buffer is shared with the given array, no copying
+//! takes place.
+
+void Data2DItem::setContent(const DoubleArray& data)
 {
     if (total_bin_count(this) != data.size())
         throw std::runtime_error("Data1DItem::setContent() -> Data doesn't match size of axis");
     setProperty(P_VALUES, data);
 }
 
-//! Returns 1d buffer representing 2d data.
+//! Returns 1d buffer representing 2d data. Returned array shares the buffer with the item.
 
-std::vector<double> Data2DItem::content() const
+DoubleArray Data2DItem::content() const
 {
-    return property<std::vector<double>>(P_VALUES);
+    return property<DoubleArray>(P_VALUES);
 }
 
 //! Insert axis under given tag. Previous axis will be deleted and data points invalidated.
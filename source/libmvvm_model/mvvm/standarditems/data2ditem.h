@@ -11,6 +11,8 @@
 #define MVVM_STANDARDITEMS_DATA2DITEM_H
 
 #include "mvvm/model/compounditem.h"
+#include "mvvm/model/doublearray.h"
+#include <initializer_list>
 #include <vector>
 
 namespace ModelView {
@@ -23,9 +25,9 @@ class BinnedAxisItem;
 
 class MVVM_MODEL_EXPORT Data2DItem : public CompoundItem {
 public:
-    static inline const std::string P_VALUES = "P_VALUES";
-    static inline const std::string T_XAXIS = "T_XAXIS";
-    static inline const std::string T_YAXIS = "T_YAXIS";
+    static inline const TagName P_VALUES = "P_VALUES";
+    static inline const TagName T_XAXIS = "T_XAXIS";
+    static inline const TagName T_YAXIS = "T_YAXIS";
 
     Data2DItem();
 
@@ -35,9 +37,13 @@ public:
 
     BinnedAxisItem* yAxis() const;
 
-    void setContent(const std::vector<double>& data);
+    void setContent(std::vector<double> data);
 
-    std::vector<double> content() const;
+    void setContent(std::initializer_list<double> data);
+
+    void setContent(const DoubleArray& data);
+
+    DoubleArray content() const;
 
 private:
     void insert_axis(std::unique_ptr<BinnedAxisItem> axis, const std::string& tag);
@@ -56,14 +56,20 @@ std::vector<double> GraphItem::binCenters() const
     return dataItem() ? dataItem()->binCenters() : std::vector<double>();
 }
 
-std::vector<double> GraphItem::binValues() const
+//! Returns values of the linked data item. Values are shared with the data item, not copied.
+
+DoubleArray GraphItem::binValues() const
 {
-    return dataItem() ? dataItem()->binValues() : std::vector<double>();
+    auto data_item = dataItem();
+    return data_item ? data_item->binValues() : DoubleArray();
 }
 
-std::vector<double> GraphItem::binErrors() const
+//! Returns errors of the linked data item. Errors are shared with the data item, not copied.
+
+DoubleArray GraphItem::binErrors() const
 {
-    return dataItem() ? dataItem()->binErrors() : std::vector<double>();
+    auto data_item = dataItem();
+    return data_item ? data_item->binErrors() : DoubleArray();
 }
 
 //! Returns color name in #RRGGBB format.
@@ -11,6 +11,7 @@
 #define MVVM_STANDARDITEMS_GRAPHITEM_H
 
 #include "mvvm/model/compounditem.h"
+#include "mvvm/model/doublearray.h"
 
 namespace ModelView {
 
@@ -23,10 +24,10 @@ class PenItem;
 
 class MVVM_MODEL_EXPORT GraphItem : public CompoundItem {
 public:
-    static inline const std::string P_LINK = "P_LINK";
-    static inline const std::string P_GRAPH_TITLE = "P_GRAPH_TITLE";
-    static inline const std::string P_PEN = "P_PEN";
-    static inline const std::string P_DISPLAYED = "P_DISPLAYED";
+    static inline const TagName P_LINK = "P_LINK";
+    static inline const TagName P_GRAPH_TITLE = "P_GRAPH_TITLE";
+    static inline const TagName P_PEN = "P_PEN";
+    static inline const TagName P_DISPLAYED = "P_DISPLAYED";
 
     GraphItem(const std::string& model_type = Constants::GraphItemType);
 
@@ -38,9 +39,9 @@ public:
 
     std::vector<double> binCenters() const;
 
-    std::vector<double> binValues() const;
+    DoubleArray binValues() const;
 
-    std::vector<double> binErrors() const;
+    DoubleArray binErrors() const;
 
     std::string colorName() const;
     void setNamedColor(const std::string& named_color);
@@ -35,7 +35,7 @@ public:
 
 template <typename T> T* LinkedItem::get() const
 {
-    return model() ? dynamic_cast<T*>(model()->findItem(data<std::string>())) : nullptr;
+    return model() ? dynamic_cast<T*>(model()->findItem(dataRef<std::string>())) : nullptr;
 }
 
 } // namespace ModelView
@@ -21,9 +21,9 @@ namespace ModelView {
 
 class MVVM_MODEL_EXPORT TextItem : public CompoundItem {
 public:
-    static inline const std::string P_TEXT = "P_TEXT";
-    static inline const std::string P_FONT = "P_FONT";
-    static inline const std::string P_SIZE = "P_SIZE";
+    static inline const TagName P_TEXT = "P_TEXT";
+    static inline const TagName P_FONT = "P_FONT";
+    static inline const TagName P_SIZE = "P_SIZE";
 
     TextItem();
 };
@@ -32,9 +32,9 @@ public:
 
 class MVVM_MODEL_EXPORT PenItem : public CompoundItem {
 public:
-    static inline const std::string P_COLOR = "P_COLOR";
-    static inline const std::string P_STYLE = "P_STYLE";
-    static inline const std::string P_WIDTH = "P_WIDTH";
+    static inline const TagName P_COLOR = "P_COLOR";
+    static inline const TagName P_STYLE = "P_STYLE";
+    static inline const TagName P_WIDTH = "P_WIDTH";
 
     PenItem();
 
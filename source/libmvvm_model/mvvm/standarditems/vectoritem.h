@@ -18,9 +18,9 @@ namespace ModelView {
 
 class MVVM_MODEL_EXPORT VectorItem : public CompoundItem {
 public:
-    static inline const std::string P_X = "P_X";
-    static inline const std::string P_Y = "P_Y";
-    static inline const std::string P_Z = "P_Z";
+    static inline const TagName P_X = "P_X";
+    static inline const TagName P_Y = "P_Y";
+    static inline const TagName P_Z = "P_Z";
 
     VectorItem();
 
@@ -21,9 +21,9 @@ class ViewportAxisItem;
 
 class MVVM_MODEL_EXPORT ViewportItem : public CompoundItem {
 public:
-    static inline const std::string P_XAXIS = "P_XAXIS";
-    static inline const std::string P_YAXIS = "P_YAXIS";
-    static inline const std::string T_ITEMS = "T_ITEMS";
+    static inline const TagName P_XAXIS = "P_XAXIS";
+    static inline const TagName P_YAXIS = "P_YAXIS";
+    static inline const TagName T_ITEMS = "T_ITEMS";
 
     ViewportItem(const model_type& model);
 
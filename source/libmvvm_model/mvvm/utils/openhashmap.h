@@ -0,0 +1,168 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_UTILS_OPENHASHMAP_H
+#define MVVM_UTILS_OPENHASHMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ModelView {
+
+//! @class OpenHashMap
+//! @brief Hash map with open addressing and linear probing.
+
+//! Keys and values are stored in a single contiguous array of slots, without per-element heap
+//! allocation. Removal uses backward shift, so no tombstones accumulate. Intended for small
+//! trivially copyable keys and values (pointers, integers, binary identifiers). Pointers to
+//! values are invalidated on insertion.
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>> class OpenHashMap {
+public:
+    OpenHashMap() = default;
+
+    size_t size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    //! Inserts a key/value pair. Returns false, if key already exists (value is not updated).
+    bool insert(const Key& key, const Value& value)
+    {
+        if ((m_size + 1) * 4 > m_slots.size() * 3)
+            rehash(m_slots.empty() ? initial_capacity : m_slots.size() * 2);
+
+        size_t index = ideal_index(key);
+        while (m_slots[index].occupied) {
+            if (m_slots[index].key == key)
+                return false;
+            index = next_index(index);
+        }
+
+        m_slots[index].key = key;
+        m_slots[index].value = value;
+        m_slots[index].occupied = true;
+        ++m_size;
+        return true;
+    }
+
+    //! Returns pointer to the value for given key, or nullptr if no such key exists.
+    const Value* find(const Key& key) const
+    {
+        auto index = find_index(key);
+        return index == npos ? nullptr : &m_slots[index].value;
+    }
+
+    Value* find(const Key& key)
+    {
+        auto index = find_index(key);
+        return index == npos ? nullptr : &m_slots[index].value;
+    }
+
+    bool contains(const Key& key) const { return find_index(key) != npos; }
+
+    //! Removes the element with given key. Returns false if no such key exists.
+    bool erase(const Key& key)
+    {
+        auto hole = find_index(key);
+        if (hole == npos)
+            return false;
+
+        // backward shift of the following elements of the probe sequence
+        size_t index = next_index(hole);
+        while (m_slots[index].occupied) {
+            const size_t ideal = ideal_index(m_slots[index].key);
+            // element can be moved to the hole, if its ideal position is not in (hole, index]
+            const bool movable = hole <= index ? (ideal <= hole || ideal > index)
+                                               : (ideal <= hole && ideal > index);
+            if (movable) {
+                m_slots[hole] = m_slots[index];
+                hole = index;
+            }
+            index = next_index(index);
+        }
+
+        m_slots[hole] = Slot();
+        --m_size;
+        return true;
+    }
+
+    void clear()
+    {
+        m_slots.clear();
+        m_size = 0;
+    }
+
+    //! Prepares the map to hold given number of elements without rehashing.
+    void reserve(size_t count)
+    {
+        size_t capacity = initial_capacity;
+        while (count * 4 > capacity * 3)
+            capacity *= 2;
+        if (capacity > m_slots.size())
+            rehash(capacity);
+    }
+
+private:
+    struct Slot {
+        Key key{};
+        Value value{};
+        bool occupied{false};
+    };
+
+    static constexpr size_t initial_capacity = 16;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    //! Returns preferred slot for given key. Fibonacci hashing is applied on top of the given hash
+    //! function to spread poorly distributed hashes (i.e. aligned pointers) over the table.
+    size_t ideal_index(const Key& key) const
+    {
+        const uint64_t hash = static_cast<uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> m_shift);
+    }
+
+    size_t next_index(size_t index) const { return (index + 1) & (m_slots.size() - 1); }
+
+    size_t find_index(const Key& key) const
+    {
+        if (m_slots.empty())
+            return npos;
+
+        size_t index = ideal_index(key);
+        while (m_slots[index].occupied) {
+            if (m_slots[index].key == key)
+                return index;
+            index = next_index(index);
+        }
+        return npos;
+    }
+
+    //! Rebuilds the table with given capacity (should be a power of two).
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> old_slots(capacity);
+        std::swap(old_slots, m_slots);
+        m_shift = 64;
+        for (size_t n = capacity; n > 1; n >>= 1)
+            --m_shift;
+        m_size = 0;
+        for (const auto& slot : old_slots)
+            if (slot.occupied)
+                insert(slot.key, slot.value);
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_size{0};
+    int m_shift{64}; //! 64 - log2(capacity)
+};
+
+} // namespace ModelView
+
+#endif // MVVM_UTILS_OPENHASHMAP_H
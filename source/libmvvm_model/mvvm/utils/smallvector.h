@@ -0,0 +1,180 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_UTILS_SMALLVECTOR_H
+#define MVVM_UTILS_SMALLVECTOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace ModelView {
+
+//! @class SmallVector
+//! @brief Vector with inline storage for the first N elements.
+
+//! Elements are stored inside the object itself, while their number doesn't exceed N, so small
+//! collections don't need heap allocation. On overflow elements are moved to the heap buffer.
+//! Elements keep their order, removal shifts following elements. Pointers to elements are
+//! invalidated on insertion and removal.
+
+template <typename T, size_t N> class SmallVector {
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+
+    SmallVector(const SmallVector& other)
+    {
+        reserve(other.size());
+        for (const auto& x : other)
+            push_back(x);
+    }
+
+    SmallVector(SmallVector&& other) noexcept { take_from(other); }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            for (const auto& x : other)
+                push_back(x);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept
+    {
+        if (this != &other) {
+            clear();
+            release_heap();
+            take_from(other);
+        }
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        release_heap();
+    }
+
+    size_t size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    size_t capacity() const { return m_capacity; }
+
+    //! Returns true if elements are stored inside the object.
+    bool isInline() const { return m_data == inline_data(); }
+
+    T& operator[](size_t index) { return m_data[index]; }
+    const T& operator[](size_t index) const { return m_data[index]; }
+
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+    template <typename... Args> T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity)
+            grow(m_capacity * 2);
+        auto result = new (m_data + m_size) T(std::forward<Args>(args)...);
+        ++m_size;
+        return *result;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    //! Removes element at given position, following elements are shifted.
+    iterator erase(const_iterator pos)
+    {
+        auto index = static_cast<size_t>(pos - m_data);
+        for (size_t i = index + 1; i < m_size; ++i)
+            m_data[i - 1] = std::move(m_data[i]);
+        pop_back();
+        return m_data + index;
+    }
+
+    void pop_back()
+    {
+        --m_size;
+        m_data[m_size].~T();
+    }
+
+    void clear()
+    {
+        while (m_size > 0)
+            pop_back();
+    }
+
+    void reserve(size_t capacity)
+    {
+        if (capacity > m_capacity)
+            grow(capacity);
+    }
+
+private:
+    T* inline_data() { return reinterpret_cast<T*>(m_inline); }
+    const T* inline_data() const { return reinterpret_cast<const T*>(m_inline); }
+
+    //! Moves elements to the new heap buffer of given capacity.
+    void grow(size_t capacity)
+    {
+        auto buffer = std::allocator<T>().allocate(capacity);
+        for (size_t i = 0; i < m_size; ++i) {
+            new (buffer + i) T(std::move(m_data[i]));
+            m_data[i].~T();
+        }
+        release_heap();
+        m_data = buffer;
+        m_capacity = capacity;
+    }
+
+    void release_heap()
+    {
+        if (!isInline())
+            std::allocator<T>().deallocate(m_data, m_capacity);
+        m_data = inline_data();
+        m_capacity = N;
+    }
+
+    //! Takes elements of other vector, which has to be empty after that. Own vector is empty.
+    void take_from(SmallVector& other)
+    {
+        if (other.isInline()) {
+            for (auto& x : other)
+                new (inline_data() + m_size++) T(std::move(x));
+            other.clear();
+        } else {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = other.inline_data();
+            other.m_size = 0;
+            other.m_capacity = N;
+        }
+    }
+
+    alignas(T) unsigned char m_inline[N * sizeof(T)];
+    T* m_data{inline_data()};
+    size_t m_size{0};
+    size_t m_capacity{N};
+};
+
+} // namespace ModelView
+
+#endif // MVVM_UTILS_SMALLVECTOR_H
@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include "mvvm/plotting/axistitlecontroller.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/standarditems/plottableitems.h"
 #include <qcustomplot.h>
 #include <stdexcept>
@@ -31,7 +32,7 @@ struct AxisTitleController::AxisTitleControllerImpl {
         m_axis->setLabel(QString::fromStdString(item->property<std::string>(TextItem::P_TEXT)));
         m_axis->setLabelFont(font);
 
-        m_axis->parentPlot()->replot();
+        ReplotScheduler::instance(m_axis->parentPlot())->scheduleReplot();
     }
 };
 
@@ -10,6 +10,7 @@
 #include "mvvm/plotting/colormapplotcontroller.h"
 #include "mvvm/model/comboproperty.h"
 #include "mvvm/plotting/data2dplotcontroller.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/standarditems/colormapitem.h"
 #include "mvvm/standarditems/data2ditem.h"
 #include <qcustomplot.h>
@@ -74,7 +75,7 @@ struct ColorMapPlotController::ColorMapPlotControllerImpl {
         update_data_controller();
         update_interpolation();
         update_gradient();
-        custom_plot->replot();
+        ReplotScheduler::instance(custom_plot)->scheduleReplot();
     }
 
     void update_data_controller() { data_controller->setItem(colormap_item()->dataItem()); }
@@ -111,7 +112,7 @@ void ColorMapPlotController::subscribe()
         if (property_name == ColorMapItem::P_LINK)
             p_impl->update_data_controller();
 
-        p_impl->custom_plot->replot();
+        ReplotScheduler::instance(p_impl->custom_plot)->scheduleReplot();
     };
     setOnPropertyChange(on_property_change);
 
@@ -8,6 +8,7 @@
 // ************************************************************************** //
 
 #include "mvvm/plotting/data1dplotcontroller.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/standarditems/data1ditem.h"
 #include <qcustomplot.h>
 #include <stdexcept>
@@ -45,8 +46,8 @@ struct Data1DPlotController::Data1DPlotControllerImpl {
     void updateGraphPointsFromItem(Data1DItem* item)
     {
         m_graph->setData(fromStdVector<double>(item->binCenters()),
-                         fromStdVector<double>(item->binValues()));
-        customPlot()->replot();
+                         fromStdVector<double>(item->binValues().values()));
+        ReplotScheduler::instance(customPlot())->scheduleReplot();
     }
 
     void updateErrorBarsFromItem(Data1DItem* item)
@@ -60,14 +61,14 @@ struct Data1DPlotController::Data1DPlotControllerImpl {
         if (!m_errorBars)
             m_errorBars = new QCPErrorBars(customPlot()->xAxis, customPlot()->yAxis);
 
-        m_errorBars->setData(fromStdVector<double>(errors));
+        m_errorBars->setData(fromStdVector<double>(errors.values()));
         m_errorBars->setDataPlottable(m_graph);
     }
 
     void resetGraph()
     {
         m_graph->setData(QVector<double>{}, QVector<double>{});
-        customPlot()->replot();
+        ReplotScheduler::instance(customPlot())->scheduleReplot();
     }
 
     void resetErrorBars()
@@ -8,10 +8,12 @@
 // ************************************************************************** //
 
 #include "mvvm/plotting/data2dplotcontroller.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/standarditems/axisitems.h"
 #include "mvvm/standarditems/data2ditem.h"
 #include <qcustomplot.h>
 #include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 using namespace ModelView;
@@ -20,7 +22,18 @@ namespace {
 //! Returns QCPRange of axis.
 QCPRange qcpRange(const BinnedAxisItem* axis)
 {
-    auto centers = axis->binCenters(); // QCPColorMapData expects centers of bin
+    // QCPColorMapData expects centers of bin, for fixed binning they are known without
+    // generating the whole vector of centers
+    if (auto fixed_axis = dynamic_cast<const FixedBinAxisItem*>(axis); fixed_axis) {
+        const int nbins = fixed_axis->size();
+        if (nbins <= 0)
+            return QCPRange();
+        auto [lower, upper] = fixed_axis->range();
+        const double half_bin = (upper - lower) / nbins / 2.0;
+        return QCPRange(lower + half_bin, upper - half_bin);
+    }
+
+    auto centers = axis->binCenters();
     return centers.empty() ? QCPRange() : QCPRange(centers.front(), centers.back());
 }
 } // namespace
@@ -39,29 +52,46 @@ struct Data2DPlotController::Data2DPlotControllerImpl {
 
     void update_data_points()
     {
-        reset_colormap();
-
-        if (auto data_item = dataItem(); data_item) {
-            auto xAxis = data_item->xAxis();
-            auto yAxis = data_item->yAxis();
-            if (xAxis && yAxis) {
-                const int nbinsx = xAxis->size();
-                const int nbinsy = yAxis->size();
-
-                color_map->data()->setSize(nbinsx, nbinsy);
-                color_map->data()->setRange(qcpRange(xAxis), qcpRange(yAxis));
-
-                auto values = data_item->content();
-                for (int ix = 0; ix < nbinsx; ++ix)
-                    for (int iy = 0; iy < nbinsy; ++iy)
-                        color_map->data()->setCell(ix, iy,
-                                                   values[static_cast<size_t>(ix + iy * nbinsx)]);
-
-                auto [min, max] = std::minmax_element(std::begin(values), std::end(values));
-                color_map->setDataRange(QCPRange(*min, *max));
+        auto data_item = dataItem();
+        auto xAxis = data_item ? data_item->xAxis() : nullptr;
+        auto yAxis = data_item ? data_item->yAxis() : nullptr;
+        if (!xAxis || !yAxis) {
+            reset_colormap();
+            ReplotScheduler::instance(color_map->parentPlot())->scheduleReplot();
+            return;
+        }
+
+        const int nbinsx = xAxis->size();
+        const int nbinsy = yAxis->size();
+
+        // buffer of colormap is reallocated only if size has changed
+        auto map_data = color_map->data();
+        map_data->setSize(nbinsx, nbinsy);
+        map_data->setRange(qcpRange(xAxis), qcpRange(yAxis));
+
+        const auto values = data_item->content();
+        if (values.empty() || values.size() != static_cast<size_t>(nbinsx * nbinsy)) {
+            map_data->fill(0.0); // content doesn't match axes (i.e. during axes change)
+            ReplotScheduler::instance(color_map->parentPlot())->scheduleReplot();
+            return;
+        }
+
+        // Data2DItem and QCPColorMapData share the same memory layout (x-index runs fastest),
+        // so cells are filled in a single contiguous pass together with min/max search
+        const double* source = values.data();
+        double min = std::numeric_limits<double>::max();
+        double max = std::numeric_limits<double>::lowest();
+        for (int iy = 0; iy < nbinsy; ++iy) {
+            for (int ix = 0; ix < nbinsx; ++ix) {
+                const double value = *source++;
+                map_data->setCell(ix, iy, value);
+                min = std::min(min, value);
+                max = std::max(max, value);
             }
         }
-        color_map->parentPlot()->replot();
+        color_map->setDataRange(QCPRange(min, max));
+
+        ReplotScheduler::instance(color_map->parentPlot())->scheduleReplot();
     }
 
     void reset_colormap() { color_map->data()->clear(); }
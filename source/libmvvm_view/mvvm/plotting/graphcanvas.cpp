@@ -10,6 +10,7 @@
 #include "mvvm/plotting/graphcanvas.h"
 #include "mvvm/plotting/customplotsceneadapter.h"
 #include "mvvm/plotting/graphviewportplotcontroller.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/plotting/statusstringreporter.h"
 #include "mvvm/plotting/statusstringreporterfactory.h"
 #include "mvvm/standarditems/graphviewportitem.h"
@@ -134,5 +135,5 @@ void GraphCanvas::setAxisMargins(int left, int top, int right, int bottom)
     int new_bottom = bottom >= 0 ? bottom : orig.bottom();
     customPlot->axisRect()->setMargins(QMargins(new_left, new_top, new_right, new_bottom));
 
-    customPlot->replot();
+    ReplotScheduler::instance(customPlot)->scheduleReplot();
 }
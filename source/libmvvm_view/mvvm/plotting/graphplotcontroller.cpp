@@ -10,6 +10,7 @@
 #include "mvvm/plotting/graphplotcontroller.h"
 #include "mvvm/plotting/data1dplotcontroller.h"
 #include "mvvm/plotting/pencontroller.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/standarditems/data1ditem.h"
 #include "mvvm/standarditems/graphitem.h"
 #include "mvvm/standarditems/plottableitems.h"
@@ -60,7 +61,7 @@ struct GraphPlotController::GraphItemControllerImpl {
     void update_visible()
     {
         m_graph->setVisible(graph_item()->property<bool>(GraphItem::P_DISPLAYED));
-        m_customPlot->replot();
+        ReplotScheduler::instance(m_customPlot)->scheduleReplot();
     }
 
     void reset_graph()
@@ -69,7 +70,7 @@ struct GraphPlotController::GraphItemControllerImpl {
         m_penController->setItem(nullptr);
         m_customPlot->removePlottable(m_graph);
         m_graph = nullptr;
-        m_customPlot->replot();
+        ReplotScheduler::instance(m_customPlot)->scheduleReplot();
     }
 };
 
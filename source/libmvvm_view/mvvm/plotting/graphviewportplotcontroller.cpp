@@ -9,6 +9,7 @@
 
 #include "mvvm/plotting/graphviewportplotcontroller.h"
 #include "mvvm/plotting/graphplotcontroller.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/plotting/viewportaxisplotcontroller.h"
 #include "mvvm/standarditems/axisitems.h"
 #include "mvvm/standarditems/graphitem.h"
@@ -79,7 +80,7 @@ struct GraphViewportPlotController::GraphViewportPlotControllerImpl {
         auto controller = std::make_unique<GraphPlotController>(custom_plot);
         controller->setItem(added_child);
         graph_controllers.push_back(std::move(controller));
-        custom_plot->replot();
+        ReplotScheduler::instance(custom_plot)->scheduleReplot();
     }
 
     //! Remove GraphPlotController corresponding to GraphItem.
@@ -91,7 +92,7 @@ struct GraphViewportPlotController::GraphViewportPlotControllerImpl {
             return cntrl->currentItem() == child_about_to_be_removed;
         };
         graph_controllers.remove_if(if_func);
-        custom_plot->replot();
+        ReplotScheduler::instance(custom_plot)->scheduleReplot();
     }
 };
 
@@ -9,6 +9,7 @@
 
 #include "mvvm/plotting/pencontroller.h"
 #include "mvvm/model/comboproperty.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/standarditems/plottableitems.h"
 #include <qcustomplot.h>
 #include <stdexcept>
@@ -44,7 +45,7 @@ struct PenController::PenControllerImpl {
         pen.setWidth(penwidth);
         m_graph->setPen(pen);
 
-        m_graph->parentPlot()->replot();
+        ReplotScheduler::instance(m_graph->parentPlot())->scheduleReplot();
     }
 };
 
@@ -0,0 +1,122 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/plotting/replotscheduler.h"
+#include <qcustomplot.h>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ModelView;
+
+struct ReplotScheduler::ReplotSchedulerImpl {
+    QCustomPlot* custom_plot{nullptr};
+    QTimer timer;
+    QElapsedTimer since_last_replot;
+    int max_frame_rate{0};
+    int requested_count{0};
+    int performed_count{0};
+
+    ReplotSchedulerImpl(QCustomPlot* custom_plot) : custom_plot(custom_plot)
+    {
+        timer.setSingleShot(true);
+    }
+
+    //! Returns delay in msec before the next replot can be performed.
+    int replot_delay() const
+    {
+        if (max_frame_rate <= 0 || !since_last_replot.isValid())
+            return 0;
+        const int frame_interval = 1000 / max_frame_rate;
+        return std::max(0, frame_interval - static_cast<int>(since_last_replot.elapsed()));
+    }
+
+    void replot()
+    {
+        timer.stop();
+        ++performed_count;
+        since_last_replot.start();
+        custom_plot->replot();
+    }
+};
+
+ReplotScheduler::ReplotScheduler(QCustomPlot* custom_plot)
+    : QObject(custom_plot), p_impl(std::make_unique<ReplotSchedulerImpl>(custom_plot))
+{
+    connect(&p_impl->timer, &QTimer::timeout, this, [this]() { p_impl->replot(); });
+}
+
+ReplotScheduler::~ReplotScheduler() = default;
+
+//! Returns scheduler of given plot. Scheduler is created on first request and is owned by the plot.
+
+ReplotScheduler* ReplotScheduler::instance(QCustomPlot* custom_plot)
+{
+    if (!custom_plot)
+        throw std::runtime_error("ReplotScheduler: custom plot is not initialized.");
+
+    auto result = custom_plot->findChild<ReplotScheduler*>(QString(), Qt::FindDirectChildrenOnly);
+    return result ? result : new ReplotScheduler(custom_plot);
+}
+
+//! Requests replot. Replot will happen on the next event loop turn, or later, if frame rate
+//! limit is set.
+
+void ReplotScheduler::scheduleReplot()
+{
+    ++p_impl->requested_count;
+    if (!p_impl->timer.isActive())
+        p_impl->timer.start(p_impl->replot_delay());
+}
+
+//! Performs pending replot immediately.
+
+void ReplotScheduler::flush()
+{
+    if (hasPendingReplot())
+        p_impl->replot();
+}
+
+bool ReplotScheduler::hasPendingReplot() const
+{
+    return p_impl->timer.isActive();
+}
+
+//! Sets maximum number of replots per second. Zero value means no limit.
+
+void ReplotScheduler::setMaxFrameRate(int fps)
+{
+    p_impl->max_frame_rate = std::max(0, fps);
+}
+
+int ReplotScheduler::maxFrameRate() const
+{
+    return p_impl->max_frame_rate;
+}
+
+//! Returns number of replot requests since creation or last counter reset.
+
+int ReplotScheduler::requestedReplotCount() const
+{
+    return p_impl->requested_count;
+}
+
+//! Returns number of replots actually performed since creation or last counter reset.
+
+int ReplotScheduler::performedReplotCount() const
+{
+    return p_impl->performed_count;
+}
+
+void ReplotScheduler::resetCounters()
+{
+    p_impl->requested_count = 0;
+    p_impl->performed_count = 0;
+}
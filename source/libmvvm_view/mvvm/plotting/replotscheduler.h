@@ -0,0 +1,57 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef MVVM_PLOTTING_REPLOTSCHEDULER_H
+#define MVVM_PLOTTING_REPLOTSCHEDULER_H
+
+#include "mvvm/view_export.h"
+#include <QObject>
+#include <memory>
+
+class QCustomPlot;
+
+namespace ModelView {
+
+//! Coalesces replot requests of QCustomPlot.
+
+//! All requests made within one event loop turn result in a single replot. Optionally, the rate
+//! of replots can be limited to the given number of frames per second. The scheduler lives as a
+//! child of QCustomPlot, the only instance per plot is obtained via ReplotScheduler::instance().
+
+class MVVM_VIEW_EXPORT ReplotScheduler : public QObject {
+    Q_OBJECT
+
+public:
+    ~ReplotScheduler() override;
+
+    static ReplotScheduler* instance(QCustomPlot* custom_plot);
+
+    void scheduleReplot();
+
+    void flush();
+
+    bool hasPendingReplot() const;
+
+    void setMaxFrameRate(int fps);
+    int maxFrameRate() const;
+
+    int requestedReplotCount() const;
+    int performedReplotCount() const;
+    void resetCounters();
+
+private:
+    explicit ReplotScheduler(QCustomPlot* custom_plot);
+
+    struct ReplotSchedulerImpl;
+    std::unique_ptr<ReplotSchedulerImpl> p_impl;
+};
+
+} // namespace ModelView
+
+#endif // MVVM_PLOTTING_REPLOTSCHEDULER_H
@@ -10,6 +10,7 @@
 #include "mvvm/plotting/viewportaxisplotcontroller.h"
 #include "mvvm/plotting/axistitlecontroller.h"
 #include "mvvm/plotting/customplotutils.h"
+#include "mvvm/plotting/replotscheduler.h"
 #include "mvvm/standarditems/axisitems.h"
 #include "mvvm/standarditems/plottableitems.h"
 #include <qcustomplot.h>
@@ -119,7 +120,7 @@ void ViewportAxisPlotController::subscribe()
         if (name == ViewportAxisItem::P_IS_LOG)
             p_impl->setAxisLogScaleFromItem();
 
-        p_impl->m_axis->parentPlot()->replot();
+        ReplotScheduler::instance(p_impl->m_axis->parentPlot())->scheduleReplot();
     };
     setOnPropertyChange(on_property_change);
 
@@ -33,6 +33,7 @@ ViewModelControllerBuilder::operator std::unique_ptr<ViewModelController>()
     auto result = std::make_unique<ViewModelController>(context.model, context.view_model);
     result->setChildrenStrategy(std::move(context.children_strategy));
     result->setRowStrategy(std::move(context.row_strategy));
+    result->setLazyPopulation(context.lazy_population);
 
     return result;
 }
@@ -63,4 +64,12 @@ ViewModelControllerBuilder::rowStrategy(std::unique_ptr<RowStrategyInterface> ro
     return *this;
 }
 
+//! Enables construction of views on demand of Qt views, see ViewModelController::setLazyPopulation.
+
+ViewModelControllerBuilder::self& ViewModelControllerBuilder::lazyPopulation(bool value)
+{
+    context.lazy_population = value;
+    return *this;
+}
+
 } // namespace ModelView
@@ -37,6 +37,7 @@ public:
     self& viewModel(ViewModelBase* view_model);
     self& childrenStrategy(std::unique_ptr<ChildrenStrategyInterface> children_strategy);
     self& rowStrategy(std::unique_ptr<RowStrategyInterface> row_strategy);
+    self& lazyPopulation(bool value = true);
 
     operator std::unique_ptr<ViewModelController>();
 
@@ -47,6 +48,7 @@ private:
         ViewModelBase* view_model{nullptr};
         std::unique_ptr<ChildrenStrategyInterface> children_strategy;
         std::unique_ptr<RowStrategyInterface> row_strategy;
+        bool lazy_population{false};
     };
 
     Context context;
@@ -28,6 +28,10 @@ public:
 
     //! Returns vector of children of given item.
     virtual std::vector<SessionItem*> children(const SessionItem* item) const = 0;
+
+    //! Returns true if given item has children. Strategies are encouraged to override it with
+    //! something cheaper than building the vector of children.
+    virtual bool hasChildren(const SessionItem* item) const { return !children(item).empty(); }
 };
 
 } // namespace ModelView
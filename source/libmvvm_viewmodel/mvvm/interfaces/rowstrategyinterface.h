@@ -30,6 +30,11 @@ public:
     virtual QStringList horizontalHeaderLabels() const = 0;
 
     virtual std::vector<std::unique_ptr<ViewItem>> constructRow(SessionItem*) = 0;
+
+    //! Returns the number of views in the row of given item, if it is known without constructing
+    //! the row, and -1 otherwise. Rows of known size are constructed on demand, when first
+    //! accessed. Views of such rows should display the given item only.
+    virtual int columnCount(const SessionItem*) const { return -1; }
 };
 
 } // namespace ModelView
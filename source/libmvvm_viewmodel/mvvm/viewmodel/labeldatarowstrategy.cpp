@@ -33,3 +33,11 @@ std::vector<std::unique_ptr<ViewItem>> LabelDataRowStrategy::constructRow(Sessio
     result.emplace_back(std::make_unique<ViewDataItem>(item));
     return result;
 }
+
+//! Returns the number of views in the row, which is known in advance, so rows can be constructed
+//! on demand.
+
+int LabelDataRowStrategy::columnCount(const SessionItem* item) const
+{
+    return item ? 2 : 0;
+}
@@ -25,6 +25,8 @@ public:
     QStringList horizontalHeaderLabels() const override;
 
     std::vector<std::unique_ptr<ViewItem>> constructRow(SessionItem*) override;
+
+    int columnCount(const SessionItem* item) const override;
 };
 
 } // namespace ModelView
@@ -29,3 +29,13 @@ void PropertyTableViewModel::insertRow(ViewItem* parent, int row,
     if (parent->columnCount() != prevColumnCount)
         emit layoutChanged();
 }
+
+void PropertyTableViewModel::insertRows(ViewItem* parent, int row,
+                                        std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
+{
+    // see comment in insertRow
+    int prevColumnCount = parent->columnCount();
+    ViewModel::insertRows(parent, row, std::move(rows));
+    if (parent->columnCount() != prevColumnCount)
+        emit layoutChanged();
+}
@@ -10,9 +10,31 @@
 #include "mvvm/viewmodel/standardchildrenstrategies.h"
 #include "mvvm/model/groupitem.h"
 #include "mvvm/model/itemutils.h"
+#include "mvvm/model/sessionitemcontainer.h"
+#include "mvvm/model/sessionitemtags.h"
+#include "mvvm/model/taginfo.h"
 
 using namespace ModelView;
 
+namespace {
+
+//! Returns true if given item has visible children stored either under single property tags, or
+//! under all other tags. Stops at the first such child.
+
+bool hasVisibleChildren(const SessionItem& item, bool property_tags)
+{
+    for (auto container : *item.itemTags()) {
+        if (container->tagInfo().isSinglePropertyTag() != property_tags)
+            continue;
+        for (auto child : *container)
+            if (child->isVisible())
+                return true;
+    }
+    return false;
+}
+
+} // namespace
+
 // ----------------------------------------------------------------------------
 
 std::vector<SessionItem*> AllChildrenStrategy::children(const SessionItem* item) const
@@ -21,11 +43,21 @@ std::vector<SessionItem*> AllChildrenStrategy::children(const SessionItem* item)
     return item ? item->children() : std::vector<SessionItem*>();
 }
 
+bool AllChildrenStrategy::hasChildren(const SessionItem* item) const
+{
+    return item && item->childrenCount() > 0;
+}
+
 std::vector<SessionItem*> TopItemsStrategy::children(const SessionItem* item) const
 {
     return item ? Utils::TopLevelItems(*item) : std::vector<SessionItem*>();
 }
 
+bool TopItemsStrategy::hasChildren(const SessionItem* item) const
+{
+    return item && hasVisibleChildren(*item, /*property_tags*/ false);
+}
+
 // ----------------------------------------------------------------------------
 
 /*
@@ -56,6 +88,16 @@ std::vector<SessionItem*> PropertyItemsStrategy::children(const SessionItem* ite
     return Utils::SinglePropertyItems(*next_item);
 }
 
+bool PropertyItemsStrategy::hasChildren(const SessionItem* item) const
+{
+    if (!item)
+        return false;
+
+    auto group = dynamic_cast<const GroupItem*>(item);
+    auto next_item = group ? group->currentItem() : item;
+    return hasVisibleChildren(*next_item, /*property_tags*/ true);
+}
+
 // ----------------------------------------------------------------------------
 
 /*
@@ -98,3 +140,16 @@ std::vector<SessionItem*> PropertyItemsFlatStrategy::children(const SessionItem*
 
     return result;
 }
+
+//! Returns true if given item has children. Every property of the item shows up in the
+//! flat list, so it is enough to look for the first one.
+
+bool PropertyItemsFlatStrategy::hasChildren(const SessionItem* item) const
+{
+    if (!item)
+        return false;
+
+    auto group = dynamic_cast<const GroupItem*>(item);
+    auto next_item = group ? group->currentItem() : item;
+    return hasVisibleChildren(*next_item, /*property_tags*/ true);
+}
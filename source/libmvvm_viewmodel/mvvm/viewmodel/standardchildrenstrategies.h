@@ -26,6 +26,7 @@ class SessionItem;
 class MVVM_VIEWMODEL_EXPORT AllChildrenStrategy : public ChildrenStrategyInterface {
 public:
     std::vector<SessionItem*> children(const SessionItem* item) const override;
+    bool hasChildren(const SessionItem* item) const override;
 };
 
 //! Strategy to find children of given item: only top level items will be given, all
@@ -35,6 +36,7 @@ public:
 class MVVM_VIEWMODEL_EXPORT TopItemsStrategy : public ChildrenStrategyInterface {
 public:
     std::vector<SessionItem*> children(const SessionItem* item) const override;
+    bool hasChildren(const SessionItem* item) const override;
 };
 
 //! Strategy to find children of given item: only property item will be given, all top level items
@@ -44,6 +46,7 @@ public:
 class MVVM_VIEWMODEL_EXPORT PropertyItemsStrategy : public ChildrenStrategyInterface {
 public:
     std::vector<SessionItem*> children(const SessionItem* item) const override;
+    bool hasChildren(const SessionItem* item) const override;
 };
 
 //! Strategy to find children of given item: flat alignment.
@@ -53,6 +56,7 @@ public:
 class MVVM_VIEWMODEL_EXPORT PropertyItemsFlatStrategy : public ChildrenStrategyInterface {
 public:
     std::vector<SessionItem*> children(const SessionItem* item) const override;
+    bool hasChildren(const SessionItem* item) const override;
 };
 
 } // namespace ModelView
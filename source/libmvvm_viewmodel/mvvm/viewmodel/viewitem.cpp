@@ -10,27 +10,27 @@
 #include "mvvm/viewmodel/viewitem.h"
 #include "mvvm/model/customvariants.h"
 #include "mvvm/model/sessionitem.h"
-#include "mvvm/utils/containerutils.h"
 #include "mvvm/viewmodel/viewmodelutils.h"
 #include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include <vector>
 
 using namespace ModelView;
 
-struct ViewItem::ViewItemImpl {
+//! Table of children. Allocated only for items which have children, so cells of the table, which
+//! are leaves in the majority, consist of a single compact block. Lazy rows take a slot per column
+//! and the item of the row, views are constructed on first access.
+
+struct ViewItem::ViewItemChildren {
+    ViewItem* owner{nullptr};
     std::vector<std::unique_ptr<ViewItem>> children; //! buffer to hold rows x columns
+    std::vector<SessionItem*> row_items; //! items of lazy rows, nullptr for rows inserted as views
+    row_factory_t factory;               //! constructs views of lazy rows
     int rows{0};
     int columns{0};
-    SessionItem* item{nullptr};
-    int role{0};
-    ViewItem* parent_view_item{nullptr};
-    ViewItemImpl(SessionItem* item, int role) : item(item), role(role) {}
 
-    void appendRow(std::vector<std::unique_ptr<ViewItem>> items)
-    {
-        insertRow(rows, std::move(items));
-    }
+    ViewItemChildren(ViewItem* owner) : owner(owner) {}
 
     void insertRow(int row, std::vector<std::unique_ptr<ViewItem>> items)
     {
@@ -43,63 +43,157 @@ struct ViewItem::ViewItemImpl {
         if (row < 0 || row > rows)
             throw std::runtime_error("Error in ViewItemImpl: invalid row index.");
 
-        children.insert(std::next(children.begin(), row * columns),
+        children.insert(std::next(children.begin(), row * static_cast<int>(items.size())),
                         std::make_move_iterator(items.begin()),
                         std::make_move_iterator(items.end()));
+        row_items.insert(std::next(row_items.begin(), row), nullptr);
 
         columns = static_cast<int>(items.size());
         ++rows;
+        update_positions(row * columns);
     }
 
-    void removeRow(int row)
+    void insertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> new_rows)
     {
-        if (row < 0 || row >= rows)
+        if (new_rows.empty())
+            return;
+
+        const size_t ncolumns = columns > 0 ? static_cast<size_t>(columns) : new_rows.front().size();
+        for (const auto& items : new_rows) {
+            if (items.empty())
+                throw std::runtime_error("Error in ViewItemImpl: attempt to insert empty row");
+            if (items.size() != ncolumns)
+                throw std::runtime_error("Error in ViewItemImpl: wrong number of columns.");
+        }
+
+        if (row < 0 || row > rows)
+            throw std::runtime_error("Error in ViewItemImpl: invalid row index.");
+
+        std::vector<std::unique_ptr<ViewItem>> buffer;
+        buffer.reserve(new_rows.size() * ncolumns);
+        for (auto& items : new_rows)
+            std::move(items.begin(), items.end(), std::back_inserter(buffer));
+
+        children.insert(std::next(children.begin(), row * static_cast<int>(ncolumns)),
+                        std::make_move_iterator(buffer.begin()),
+                        std::make_move_iterator(buffer.end()));
+        row_items.insert(std::next(row_items.begin(), row), new_rows.size(), nullptr);
+
+        columns = static_cast<int>(ncolumns);
+        rows += static_cast<int>(new_rows.size());
+        update_positions(row * columns);
+    }
+
+    void insertLazyRows(int row, const std::vector<SessionItem*>& items, int ncolumns,
+                        row_factory_t row_factory)
+    {
+        if (items.empty())
+            return;
+
+        if (ncolumns < 1)
+            throw std::runtime_error("Error in ViewItemImpl: attempt to insert empty row");
+
+        if (columns > 0 && ncolumns != columns)
+            throw std::runtime_error("Error in ViewItemImpl: wrong number of columns.");
+
+        if (row < 0 || row > rows)
+            throw std::runtime_error("Error in ViewItemImpl: invalid row index.");
+
+        std::vector<std::unique_ptr<ViewItem>> empty_slots(items.size()
+                                                           * static_cast<size_t>(ncolumns));
+        children.insert(std::next(children.begin(), row * ncolumns),
+                        std::make_move_iterator(empty_slots.begin()),
+                        std::make_move_iterator(empty_slots.end()));
+        row_items.insert(std::next(row_items.begin(), row), items.begin(), items.end());
+        factory = std::move(row_factory);
+
+        columns = ncolumns;
+        rows += static_cast<int>(items.size());
+        update_positions(row * columns);
+    }
+
+    void removeRows(int row, int count)
+    {
+        if (row < 0 || count < 1 || row + count > rows)
             throw std::runtime_error("Error in RefViewItem: invalid row index.");
 
         auto begin = std::next(children.begin(), row * columns);
-        auto end = std::next(begin, columns);
+        auto end = std::next(begin, count * columns);
         children.erase(begin, end);
-        --rows;
+        auto items_begin = std::next(row_items.begin(), row);
+        row_items.erase(items_begin, std::next(items_begin, count));
+        update_positions(row * columns);
+        rows -= count;
         if (rows == 0)
             columns = 0;
     }
 
-    ViewItem* child(int row, int column) const
+    //! Updates cached positions of children starting from the given index in children buffer.
+    //! Called on layout change, so row() and column() requests don't need to search.
+
+    void update_positions(int from)
+    {
+        for (size_t index = static_cast<size_t>(from); index < children.size(); ++index)
+            if (children[index])
+                children[index]->m_position = static_cast<int>(index);
+    }
+
+    void check_row(int row) const
     {
         if (row < 0 || row >= rows)
             throw std::runtime_error("Error in RefViewItem: wrong row)");
+    }
 
-        if (column < 0 || column >= columns)
-            throw std::runtime_error("Error in RefViewItem: wrong column)");
-
-        return children.at(static_cast<size_t>(column + row * columns)).get();
+    bool is_constructed(int row) const
+    {
+        check_row(row);
+        return children[static_cast<size_t>(row * columns)] != nullptr;
     }
 
-    ViewItem* parent() { return parent_view_item; }
+    //! Constructs views of the lazy row with the factory given at insertion.
 
-    int index_of_child(const ViewItem* child)
+    void construct_row(int row)
     {
-        return Utils::IndexOfItem(children.begin(), children.end(), child);
+        auto views = factory ? factory(row_items[static_cast<size_t>(row)])
+                             : std::vector<std::unique_ptr<ViewItem>>();
+        if (views.size() != static_cast<size_t>(columns))
+            throw std::runtime_error("Error in ViewItemImpl: wrong number of columns.");
+
+        const size_t offset = static_cast<size_t>(row * columns);
+        for (size_t col = 0; col < views.size(); ++col) {
+            views[col]->setParent(owner);
+            views[col]->m_position = static_cast<int>(offset + col);
+            children[offset + col] = std::move(views[col]);
+        }
     }
 
-    //! Returns item data associated with this RefViewItem.
+    ViewItem* child(int row, int column)
+    {
+        check_row(row);
 
-    QVariant data() const { return item ? item->data<QVariant>(role) : QVariant(); }
+        if (column < 0 || column >= columns)
+            throw std::runtime_error("Error in RefViewItem: wrong column)");
 
-    //! Returns vector of children.
+        const size_t index = static_cast<size_t>(column + row * columns);
+        if (!children[index])
+            construct_row(row);
+        return children[index].get();
+    }
 
-    std::vector<ViewItem*> get_children() const
+    //! Returns vector of children. Views of lazy rows are constructed.
+
+    std::vector<ViewItem*> get_children()
     {
         std::vector<ViewItem*> result;
-        std::transform(children.begin(), children.end(), std::back_inserter(result),
-                       [](const auto& x) { return x.get(); });
+        result.reserve(children.size());
+        for (int row = 0; row < rows; ++row)
+            for (int col = 0; col < columns; ++col)
+                result.push_back(child(row, col));
         return result;
     }
 };
 
-ViewItem::ViewItem(SessionItem* item, int role) : p_impl(std::make_unique<ViewItemImpl>(item, role))
-{
-}
+ViewItem::ViewItem(SessionItem* item, int role) : m_item(item), m_role(role) {}
 
 ViewItem::~ViewItem() = default;
 
@@ -107,14 +201,14 @@ ViewItem::~ViewItem() = default;
 
 int ViewItem::rowCount() const
 {
-    return p_impl->rows;
+    return m_children ? m_children->rows : 0;
 }
 
 //! Returns the number of child item columns that the item has.
 
 int ViewItem::columnCount() const
 {
-    return p_impl->columns;
+    return m_children ? m_children->columns : 0;
 }
 
 //! Appends a row containing items. Number of items should be the same as columnCount()
@@ -122,9 +216,7 @@ int ViewItem::columnCount() const
 
 void ViewItem::appendRow(std::vector<std::unique_ptr<ViewItem>> items)
 {
-    for (auto& x : items)
-        x->setParent(this);
-    p_impl->appendRow(std::move(items));
+    insertRow(rowCount(), std::move(items));
 }
 
 //! Insert a row of items at index 'row'.
@@ -133,41 +225,91 @@ void ViewItem::insertRow(int row, std::vector<std::unique_ptr<ViewItem>> items)
 {
     for (auto& x : items)
         x->setParent(this);
-    p_impl->insertRow(row, std::move(items));
+    children_table().insertRow(row, std::move(items));
+}
+
+//! Inserts several rows of items starting from index 'row'. All rows should have the same number
+//! of items.
+
+void ViewItem::insertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
+{
+    for (auto& items : rows)
+        for (auto& x : items)
+            x->setParent(this);
+    children_table().insertRows(row, std::move(rows));
+}
+
+//! Inserts lazy rows for given items starting from index 'row'. Each row takes 'ncolumns' views,
+//! which are constructed by the factory when the row is first accessed.
+
+void ViewItem::insertLazyRows(int row, std::vector<SessionItem*> items, int ncolumns,
+                              row_factory_t factory)
+{
+    children_table().insertLazyRows(row, items, ncolumns, std::move(factory));
+}
+
+//! Returns true if views of given row are constructed.
+
+bool ViewItem::isRowConstructed(int row) const
+{
+    if (!m_children)
+        throw std::runtime_error("Error in RefViewItem: wrong row)");
+    return m_children->is_constructed(row);
+}
+
+//! Returns the item given for the lazy row at insertion, or nullptr for rows inserted as views.
+
+SessionItem* ViewItem::rowItem(int row) const
+{
+    if (!m_children)
+        throw std::runtime_error("Error in RefViewItem: wrong row)");
+    m_children->check_row(row);
+    return m_children->row_items[static_cast<size_t>(row)];
 }
 
 //! Removes row of items at given 'row'. Items will be deleted.
 
 void ViewItem::removeRow(int row)
 {
-    p_impl->removeRow(row);
+    removeRows(row, 1);
+}
+
+//! Removes 'count' rows of items starting from given 'row'. Items will be deleted.
+
+void ViewItem::removeRows(int row, int count)
+{
+    children_table().removeRows(row, count);
+    if (!m_children->rows)
+        m_children.reset();
 }
 
 void ViewItem::clear()
 {
-    p_impl->children.clear();
-    p_impl->rows = 0;
-    p_impl->columns = 0;
+    m_children.reset();
 }
 
 ViewItem* ViewItem::parent() const
 {
-    return p_impl->parent();
+    return m_parent;
 }
 
+//! Returns child at given row and column. Views of the lazy row are constructed on first access.
+
 ViewItem* ViewItem::child(int row, int column) const
 {
-    return p_impl->child(row, column);
+    if (!m_children)
+        throw std::runtime_error("Error in RefViewItem: wrong row)");
+    return m_children->child(row, column);
 }
 
 SessionItem* ViewItem::item() const
 {
-    return p_impl->item;
+    return m_item;
 }
 
 int ViewItem::item_role() const
 {
-    return p_impl->role;
+    return m_role;
 }
 
 //! Returns the row where the item is located in its parent's child table, or -1 if the item has no
@@ -175,8 +317,8 @@ int ViewItem::item_role() const
 
 int ViewItem::row() const
 {
-    auto index = parent() ? parent()->p_impl->index_of_child(this) : -1;
-    return index >= 0 ? index / parent()->p_impl->columns : -1;
+    auto index = parent() ? m_position : -1;
+    return index >= 0 ? index / parent()->columnCount() : -1;
 }
 
 //! Returns the column where the item is located in its parent's child table, or -1 if the item has
@@ -184,8 +326,8 @@ int ViewItem::row() const
 
 int ViewItem::column() const
 {
-    auto index = parent() ? parent()->p_impl->index_of_child(this) : -1;
-    return index >= 0 ? index % parent()->p_impl->columns : -1;
+    auto index = parent() ? m_position : -1;
+    return index >= 0 ? index % parent()->columnCount() : -1;
 }
 
 //! Returns the data for given role according to Qt::ItemDataRole namespace definitions.
@@ -193,19 +335,19 @@ int ViewItem::column() const
 
 QVariant ViewItem::data(int qt_role) const
 {
-    if (!p_impl->item)
+    if (!m_item)
         return QVariant();
 
     if (qt_role == Qt::DisplayRole || qt_role == Qt::EditRole)
-        return Utils::toQtVariant(p_impl->data());
+        return Utils::toQtVariant(m_item->data<QVariant>(m_role));
 #if QT_VERSION >= QT_VERSION_CHECK(5, 13, 0)
     else if (qt_role == Qt::ForegroundRole)
 #else
     else if (qt_role == Qt::TextColorRole)
 #endif
-        return Utils::TextColorRole(*p_impl->item);
+        return Utils::TextColorRole(*m_item);
     else if (qt_role == Qt::ToolTipRole)
-        return Utils::ToolTipRole(*p_impl->item);
+        return Utils::ToolTipRole(*m_item);
     else
         return QVariant();
 }
@@ -215,8 +357,8 @@ QVariant ViewItem::data(int qt_role) const
 
 bool ViewItem::setData(const QVariant& value, int qt_role)
 {
-    if (p_impl->item && qt_role == Qt::EditRole)
-        return p_impl->item->setData(Utils::toCustomVariant(value), p_impl->role);
+    if (m_item && qt_role == Qt::EditRole)
+        return m_item->setData(Utils::toCustomVariant(value), m_role);
     return false;
 }
 
@@ -229,12 +371,23 @@ Qt::ItemFlags ViewItem::flags() const
     return result;
 }
 
+//! Returns all children. Views of lazy rows are constructed.
+
 std::vector<ViewItem*> ViewItem::children() const
 {
-    return p_impl->get_children();
+    return m_children ? m_children->get_children() : std::vector<ViewItem*>();
 }
 
 void ViewItem::setParent(ViewItem* parent)
 {
-    p_impl->parent_view_item = parent;
+    m_parent = parent;
+}
+
+//! Returns table of children, creates it on first request.
+
+ViewItem::ViewItemChildren& ViewItem::children_table()
+{
+    if (!m_children)
+        m_children = std::make_unique<ViewItemChildren>(this);
+    return *m_children;
 }
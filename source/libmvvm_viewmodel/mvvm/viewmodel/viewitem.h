@@ -12,6 +12,7 @@
 
 #include "mvvm/core/variant.h"
 #include "mvvm/viewmodel_export.h"
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -20,9 +21,14 @@ namespace ModelView {
 class SessionItem;
 
 //! Represents the view of SessionItem's data in a single cell of ViewModel.
+//! The cell is a single compact block, the table of children is allocated only when the first row
+//! is inserted. Lazy rows of the table keep only the item they display, their views are
+//! constructed by the row factory when first accessed.
 
 class MVVM_VIEWMODEL_EXPORT ViewItem {
 public:
+    using row_factory_t = std::function<std::vector<std::unique_ptr<ViewItem>>(SessionItem*)>;
+
     virtual ~ViewItem();
 
     int rowCount() const;
@@ -33,8 +39,19 @@ public:
 
     void insertRow(int row, std::vector<std::unique_ptr<ViewItem>> items);
 
+    void insertRows(int row, std::vector<std::vector<std::unique_ptr<ViewItem>>> rows);
+
+    void insertLazyRows(int row, std::vector<SessionItem*> items, int ncolumns,
+                        row_factory_t factory);
+
+    bool isRowConstructed(int row) const;
+
+    SessionItem* rowItem(int row) const;
+
     void removeRow(int row);
 
+    void removeRows(int row, int count);
+
     void clear();
 
     ViewItem* parent() const;
@@ -62,8 +79,14 @@ protected:
     void setParent(ViewItem* parent);
 
 private:
-    struct ViewItemImpl;
-    std::unique_ptr<ViewItemImpl> p_impl;
+    struct ViewItemChildren;
+    ViewItemChildren& children_table();
+
+    std::unique_ptr<ViewItemChildren> m_children; //!< nullptr, while there are no children
+    SessionItem* m_item{nullptr};
+    ViewItem* m_parent{nullptr};
+    int m_role{0};
+    int m_position{-1}; //!< cached index of this item in the children table of its parent
 };
 
 } // namespace ModelView
@@ -31,6 +31,33 @@ QVariant ViewModel::headerData(int section, Qt::Orientation orientation, int rol
     return QVariant();
 }
 
+//! Returns true if parent has children. In the mode of lazy population children may be not
+//! fetched yet.
+
+bool ViewModel::hasChildren(const QModelIndex& parent) const
+{
+    return m_controller->hasChildren(parent.isValid() ? itemFromIndex(parent) : rootItem());
+}
+
+bool ViewModel::canFetchMore(const QModelIndex& parent) const
+{
+    return m_controller->canFetchMore(parent.isValid() ? itemFromIndex(parent) : rootItem());
+}
+
+void ViewModel::fetchMore(const QModelIndex& parent)
+{
+    m_controller->fetchMore(parent.isValid() ? itemFromIndex(parent) : rootItem());
+}
+
+//! Removes rows beneath given parent, to be fetched again on demand. Works in the mode of lazy
+//! population only, and is intended to be connected to QTreeView::collapsed signal.
+
+void ViewModel::releaseChildren(const QModelIndex& parent)
+{
+    if (parent.isValid())
+        m_controller->releaseChildren(itemFromIndex(parent));
+}
+
 SessionModel* ViewModel::sessionModel() const
 {
     return m_controller->sessionModel();
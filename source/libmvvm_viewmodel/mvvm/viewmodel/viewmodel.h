@@ -31,6 +31,14 @@ public:
     QVariant headerData(int section, Qt::Orientation orientation,
                         int role = Qt::DisplayRole) const override;
 
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+
+    bool canFetchMore(const QModelIndex& parent) const override;
+
+    void fetchMore(const QModelIndex& parent) override;
+
+    void releaseChildren(const QModelIndex& parent);
+
     SessionModel* sessionModel() const;
 
     SessionItem* rootSessionItem();
@@ -34,6 +34,8 @@ ViewModelBase::ViewModelBase(QObject* parent)
 
 ViewModelBase::~ViewModelBase() = default;
 
+//! Returns the index of the cell. Views of the lazy row are constructed on first request.
+
 QModelIndex ViewModelBase::index(int row, int column, const QModelIndex& parent) const
 {
     auto parent_item = itemFromIndex(parent) ? itemFromIndex(parent) : rootItem();
@@ -127,6 +129,19 @@ void ViewModelBase::removeRow(ViewItem* parent, int row)
     endRemoveRows();
 }
 
+//! Removes 'count' rows starting from given 'row'. Views are notified about the whole range at once.
+
+void ViewModelBase::removeRows(ViewItem* parent, int row, int count)
+{
+    if (!p_impl->item_belongs_to_model(parent))
+        throw std::runtime_error(
+            "Error in ViewModelBase: attempt to use parent from another model");
+
+    beginRemoveRows(indexFromItem(parent), row, row + count - 1);
+    parent->removeRows(row, count);
+    endRemoveRows();
+}
+
 void ViewModelBase::clearRows(ViewItem* parent)
 {
     if (!p_impl->item_belongs_to_model(parent))
@@ -155,6 +170,24 @@ void ViewModelBase::insertRow(ViewItem* parent, int row,
     endInsertRows();
 }
 
+//! Inserts several rows of items starting from index 'row' to given parent. Views are notified
+//! about the whole range at once.
+
+void ViewModelBase::insertRows(ViewItem* parent, int row,
+                               std::vector<std::vector<std::unique_ptr<ViewItem>>> rows)
+{
+    if (!p_impl->item_belongs_to_model(parent))
+        throw std::runtime_error(
+            "Error in ViewModelBase: attempt to use parent from another model");
+
+    if (rows.empty())
+        return;
+
+    beginInsertRows(indexFromItem(parent), row, row + static_cast<int>(rows.size()) - 1);
+    parent->insertRows(row, std::move(rows));
+    endInsertRows();
+}
+
 //! Appends row of items to given parent.
 
 void ViewModelBase::appendRow(ViewItem* parent, std::vector<std::unique_ptr<ViewItem>> items)
@@ -162,6 +195,24 @@ void ViewModelBase::appendRow(ViewItem* parent, std::vector<std::unique_ptr<View
     insertRow(parent, parent->rowCount(), std::move(items));
 }
 
+//! Inserts lazy rows for given items starting from index 'row' to given parent. Views of a row are
+//! constructed by the factory when the row is first indexed.
+
+void ViewModelBase::insertLazyRows(ViewItem* parent, int row, std::vector<SessionItem*> items,
+                                   int ncolumns, ViewItem::row_factory_t factory)
+{
+    if (!p_impl->item_belongs_to_model(parent))
+        throw std::runtime_error(
+            "Error in ViewModelBase: attempt to use parent from another model");
+
+    if (items.empty())
+        return;
+
+    beginInsertRows(indexFromItem(parent), row, row + static_cast<int>(items.size()) - 1);
+    parent->insertLazyRows(row, std::move(items), ncolumns, std::move(factory));
+    endInsertRows();
+}
+
 //! Returns the item flags for the given index.
 
 Qt::ItemFlags ViewModelBase::flags(const QModelIndex& index) const
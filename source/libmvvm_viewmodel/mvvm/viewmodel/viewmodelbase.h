@@ -10,18 +10,18 @@
 #ifndef MVVM_VIEWMODEL_VIEWMODELBASE_H
 #define MVVM_VIEWMODEL_VIEWMODELBASE_H
 
+#include "mvvm/viewmodel/viewitem.h"
 #include "mvvm/viewmodel_export.h"
 #include <QAbstractItemModel>
 #include <memory>
 
 namespace ModelView {
 
-class ViewItem;
-
 //! Base class for all view models to show content of SessionModel in Qt views.
 //! ViewModelBase is made of ViewItems, where each ViewItem represents some concrete data role
 //! of SessionItem. ViewModelBase doesn't have own logic and needs ViewModelController to listen
-//! for SessionModel changes.
+//! for SessionModel changes. Views of lazy rows are constructed only when the row is first indexed,
+//! so rows, which were never shown, take a slot per column.
 
 class MVVM_VIEWMODEL_EXPORT ViewModelBase : public QAbstractItemModel {
     Q_OBJECT
@@ -51,12 +51,20 @@ public:
 
     void removeRow(ViewItem* parent, int row);
 
+    void removeRows(ViewItem* parent, int row, int count);
+
     void clearRows(ViewItem* parent);
 
     virtual void insertRow(ViewItem* parent, int row, std::vector<std::unique_ptr<ViewItem>> items);
 
+    virtual void insertRows(ViewItem* parent, int row,
+                            std::vector<std::vector<std::unique_ptr<ViewItem>>> rows);
+
     void appendRow(ViewItem* parent, std::vector<std::unique_ptr<ViewItem>> items);
 
+    void insertLazyRows(ViewItem* parent, int row, std::vector<SessionItem*> items, int ncolumns,
+                        ViewItem::row_factory_t factory);
+
     Qt::ItemFlags flags(const QModelIndex& index) const override;
 
 private:
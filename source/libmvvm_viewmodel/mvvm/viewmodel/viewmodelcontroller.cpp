@@ -15,12 +15,18 @@
 #include "mvvm/model/path.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionmodel.h"
+#include "mvvm/signals/modelmapper.h"
 #include "mvvm/utils/containerutils.h"
+#include "mvvm/utils/openhashmap.h"
 #include "mvvm/viewmodel/standardviewitems.h"
 #include "mvvm/viewmodel/viewmodelbase.h"
 #include "mvvm/viewmodel/viewmodelutils.h"
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace ModelView;
 
@@ -44,7 +50,16 @@ struct ViewModelController::ViewModelControllerImpl {
     ViewModelBase* m_viewModel{nullptr};
     std::unique_ptr<ChildrenStrategyInterface> m_childrenStrategy;
     std::unique_ptr<RowStrategyInterface> m_rowStrategy;
-    std::map<SessionItem*, ViewItem*> m_itemToVview; //! correspondence of item and its view
+    //! correspondence of item and its view, which carries views of item's children; lazy rows
+    //! appear here once their views are constructed
+    OpenHashMap<const SessionItem*, ViewItem*> m_itemToVview;
+    //! constructed views (label, data, ...) displaying given item
+    std::unordered_map<const SessionItem*, std::vector<ViewItem*>> m_itemToViews;
+    //! views with data changed during the model transaction, and Qt roles of the change
+    std::unordered_map<ViewItem*, QVector<int>> m_changedViews;
+    //! views with children constructed, in the mode of lazy population
+    std::unordered_set<const ViewItem*> m_fetched;
+    bool m_lazyPopulation{false};
     Path m_rootItemPath;
 
     ViewModelControllerImpl(ViewModelController* controller, ViewModelBase* view_model)
@@ -68,88 +83,437 @@ struct ViewModelController::ViewModelControllerImpl {
     void init_view_model()
     {
         check_initialization();
-        m_itemToVview.clear();
-        m_itemToVview[m_self->rootSessionItem()] = m_viewModel->rootItem();
-        iterate(m_self->rootSessionItem(), m_viewModel->rootItem());
+        clear_views();
+        set_row_view(m_self->rootSessionItem(), m_viewModel->rootItem());
+        populate(m_self->rootSessionItem(), m_viewModel->rootItem());
+    }
+
+    //! Constructs views for the whole branch of given item, or only for its children in the mode
+    //! of lazy population.
+
+    void populate(const SessionItem* item, ViewItem* parent)
+    {
+        if (m_lazyPopulation)
+            fetch_children(item, parent);
+        else
+            iterate(item, parent);
+    }
+
+    //! Constructs rows of views for children of given item. Views of grandchildren are left to be
+    //! constructed on demand.
+
+    void fetch_children(const SessionItem* item, ViewItem* parent)
+    {
+        m_fetched.insert(parent);
+        insert_rows(parent, parent->rowCount(), m_childrenStrategy->children(item));
+    }
+
+    //! Returns true if views of children of given view weren't constructed yet. Only views in the
+    //! first column carry children.
+
+    bool is_unfetched(const ViewItem* view) const
+    {
+        if (!m_lazyPopulation || m_fetched.find(view) != m_fetched.end())
+            return false;
+        return view->item() && row_view(view->item()) == view;
     }
 
     void iterate(const SessionItem* item, ViewItem* parent)
     {
-        ViewItem* origParent(parent);
         for (auto child : m_childrenStrategy->children(item)) {
-            auto row = m_rowStrategy->constructRow(child);
-            if (!row.empty()) {
-                auto next_parent = row.at(0).get();
-                m_viewModel->appendRow(parent, std::move(row));
-                m_itemToVview[child] = next_parent;
-                parent = next_parent; // labelItem
-                iterate(child, parent);
-            }
-            parent = origParent;
+            const int row = parent->rowCount();
+            if (!insert_rows(parent, row, {child}).empty())
+                iterate_row(parent, row, child);
         }
     }
 
-    //! Remove row of ViewItem's corresponding to given item.
+    //! Constructs views beneath the row of given item. Views of the lazy row are constructed only
+    //! if the item has children to show.
 
-    void remove_row_of_views(SessionItem* item)
+    void iterate_row(ViewItem* parent, int row, SessionItem* item)
     {
-        auto pos = m_itemToVview.find(item);
-        if (pos != m_itemToVview.end()) {
-            auto view = pos->second;
-            m_viewModel->removeRow(view->parent(), view->row());
-            m_itemToVview.erase(pos);
+        if (!parent->isRowConstructed(row) && !m_childrenStrategy->hasChildren(item))
+            return;
+        iterate(item, parent->child(row, 0));
+    }
+
+    //! Inserts rows for given items into the parent view starting from given row. Rows of items of
+    //! known size are inserted as lazy rows, the rest are constructed right away. Items without
+    //! views are skipped. Returns items which got their rows.
+
+    std::vector<SessionItem*> insert_rows(ViewItem* parent, int row,
+                                          const std::vector<SessionItem*>& items)
+    {
+        std::vector<int> columns;
+        columns.reserve(items.size());
+        for (auto item : items)
+            columns.push_back(m_rowStrategy->columnCount(item));
+
+        std::vector<SessionItem*> result;
+        for (size_t begin = 0; begin < items.size();) {
+            size_t end = begin + 1;
+            const bool is_lazy = columns[begin] >= 0;
+            while (end < items.size()
+                   && (is_lazy ? columns[end] == columns[begin] : columns[end] < 0))
+                ++end;
+
+            const int position = row + static_cast<int>(result.size());
+            if (is_lazy)
+                insert_lazy_rows(parent, position, items, columns[begin], begin, end, result);
+            else
+                insert_constructed_rows(parent, position, items, begin, end, result);
+            begin = end;
         }
+        return result;
     }
 
-    void remove_children_of_view(ViewItem* view)
+    //! Inserts lazy rows for items[begin, end), which views are constructed on first access.
+
+    void insert_lazy_rows(ViewItem* parent, int row, const std::vector<SessionItem*>& items,
+                          int ncolumns, size_t begin, size_t end, std::vector<SessionItem*>& result)
     {
-        for (auto child : view->children()) {
-            auto pos = std::find_if(m_itemToVview.begin(), m_itemToVview.end(),
-                                    [child](const auto& it) { return it.second == child; });
-            if (pos != m_itemToVview.end())
-                m_itemToVview.erase(pos);
+        if (ncolumns == 0)
+            return; // items without views
+
+        std::vector<SessionItem*> rows;
+        for (size_t i = begin; i < end; ++i)
+            rows.push_back(items[i]);
+        result.insert(result.end(), rows.begin(), rows.end());
+        m_viewModel->insertLazyRows(parent, row, std::move(rows), ncolumns,
+                                    [this](SessionItem* item) { return construct_row(item); });
+    }
+
+    //! Constructs rows of views for items[begin, end) and inserts them into the view model at once.
+
+    void insert_constructed_rows(ViewItem* parent, int row, const std::vector<SessionItem*>& items,
+                                 size_t begin, size_t end, std::vector<SessionItem*>& result)
+    {
+        std::vector<std::vector<std::unique_ptr<ViewItem>>> rows;
+        for (size_t i = begin; i < end; ++i) {
+            auto views = m_rowStrategy->constructRow(items[i]);
+            if (views.empty())
+                continue;
+            register_views(views);
+            set_row_view(items[i], views.at(0).get()); // labelItem
+            result.push_back(items[i]);
+            rows.push_back(std::move(views));
         }
 
+        if (rows.size() == 1)
+            m_viewModel->insertRow(parent, row, std::move(rows.front()));
+        else
+            m_viewModel->insertRows(parent, row, std::move(rows));
+    }
+
+    //! Constructs and registers views of the lazy row of given item. Called by the view model on
+    //! first access to the row.
+
+    std::vector<std::unique_ptr<ViewItem>> construct_row(SessionItem* item)
+    {
+        auto views = m_rowStrategy->constructRow(item);
+        register_views(views);
+        if (!views.empty())
+            set_row_view(item, views.at(0).get()); // labelItem
+        return views;
+    }
+
+    //! Returns the view carrying rows of given item, which is the view of its nearest ancestor
+    //! having children shown.
+
+    ViewItem* carrier_view(const SessionItem* item) const
+    {
+        for (auto ancestor = item->parent(); ancestor; ancestor = ancestor->parent())
+            if (auto view = row_view(ancestor))
+                return view;
+        return nullptr;
+    }
+
+    //! Returns rows of given view by items of lazy rows.
+
+    std::unordered_map<const SessionItem*, int> lazy_rows(const ViewItem* view) const
+    {
+        std::unordered_map<const SessionItem*, int> result;
+        for (int row = 0; row < view->rowCount(); ++row)
+            if (auto item = view->rowItem(row))
+                result.emplace(item, row);
+        return result;
+    }
+
+    //! Returns the view, which carries views of item's children. Views of the lazy row are
+    //! constructed, if necessary. Returns nullptr, if the item has no row.
+
+    ViewItem* construct_row_view(const SessionItem* item)
+    {
+        if (auto view = row_view(item))
+            return view;
+
+        if (auto parent = carrier_view(item))
+            for (int row = 0; row < parent->rowCount(); ++row)
+                if (parent->rowItem(row) == item)
+                    return parent->child(row, 0);
+
+        return nullptr;
+    }
+
+    //! Forgets all views registered so far.
+
+    void clear_views()
+    {
+        m_itemToVview.clear();
+        m_itemToViews.clear();
+        m_changedViews.clear();
+        m_fetched.clear();
+    }
+
+    //! Registers all views of the row as views of their SessionItem's.
+
+    void register_views(const std::vector<std::unique_ptr<ViewItem>>& row)
+    {
+        for (const auto& view : row)
+            if (view->item())
+                m_itemToViews[view->item()].push_back(view.get());
+    }
+
+    //! Sets the view, which carries views of item's children.
+
+    void set_row_view(const SessionItem* item, ViewItem* view)
+    {
+        if (auto existing = m_itemToVview.find(item))
+            *existing = view;
+        else
+            m_itemToVview.insert(item, view);
+    }
+
+    //! Returns the view, which carries views of item's children, or nullptr if the item has no row,
+    //! or its lazy row wasn't constructed yet.
+
+    ViewItem* row_view(const SessionItem* item) const
+    {
+        auto view = m_itemToVview.find(item);
+        return view ? *view : nullptr;
+    }
+
+    //! Unregisters constructed views of given rows of the parent view, and all views beneath them.
+
+    void unregister_rows(ViewItem* parent, int first, int count)
+    {
+        for (int row = first; row < first + count; ++row)
+            if (parent->isRowConstructed(row))
+                for (int col = 0; col < parent->columnCount(); ++col)
+                    unregister_views(parent->child(row, col));
+    }
+
+    //! Unregisters given view and all views beneath it.
+
+    void unregister_views(ViewItem* view)
+    {
+        unregister_rows(view, 0, view->rowCount());
+
+        if (auto it = m_itemToViews.find(view->item()); it != m_itemToViews.end()) {
+            auto& views = it->second;
+            views.erase(std::remove(views.begin(), views.end(), view), views.end());
+            if (views.empty())
+                m_itemToViews.erase(it);
+        }
+
+        if (row_view(view->item()) == view)
+            m_itemToVview.erase(view->item());
+
+        m_fetched.erase(view);
+    }
+
+    //! Returns constructed views displaying given item.
+
+    std::vector<ViewItem*> constructed_views(const SessionItem* item) const
+    {
+        if (item == m_viewModel->rootItem()->item())
+            return {m_viewModel->rootItem()};
+
+        auto it = m_itemToViews.find(item);
+        return it != m_itemToViews.end() ? it->second : std::vector<ViewItem*>();
+    }
+
+    //! Removes rows of ViewItem's corresponding to given items, which are children of the same
+    //! parent. Adjacent rows are removed from the view model at once.
+
+    void remove_rows_of_views(const std::vector<SessionItem*>& items)
+    {
+        std::map<ViewItem*, std::vector<int>> rows_of_parent;
+        ViewItem* lazy_parent{nullptr};
+        std::unordered_map<const SessionItem*, int> lazy_rows_of_parent;
+        for (auto item : items) {
+            if (auto view = row_view(item)) {
+                rows_of_parent[view->parent()].push_back(view->row());
+                m_itemToVview.erase(item);
+                continue;
+            }
+
+            // row with views not constructed yet is looked for among rows of the common parent
+            if (!lazy_parent) {
+                lazy_parent = carrier_view(item);
+                if (lazy_parent)
+                    lazy_rows_of_parent = lazy_rows(lazy_parent);
+            }
+            if (auto it = lazy_rows_of_parent.find(item); it != lazy_rows_of_parent.end())
+                rows_of_parent[lazy_parent].push_back(it->second);
+        }
+
+        for (auto& [parent_view, rows] : rows_of_parent) {
+            // removing from the end, to keep row indices of remaining ranges valid
+            std::sort(rows.begin(), rows.end(), std::greater<int>());
+            for (size_t begin = 0; begin < rows.size();) {
+                size_t end = begin + 1;
+                while (end < rows.size() && rows[end] == rows[end - 1] - 1)
+                    ++end;
+                const int first_row = rows[end - 1];
+                const int count = static_cast<int>(end - begin);
+                unregister_rows(parent_view, first_row, count);
+                m_viewModel->removeRows(parent_view, first_row, count);
+                begin = end;
+            }
+        }
+    }
+
+    void remove_children_of_view(ViewItem* view)
+    {
+        unregister_rows(view, 0, view->rowCount());
         m_viewModel->clearRows(view);
     }
 
-    void insert_view(SessionItem* parent, const TagRow& tagrow)
+    //! Inserts rows of views for children of given parent in the range [first, first+count).
+    //! Adjacent rows are inserted into the view model at once.
+
+    void insert_views(SessionItem* parent, const std::string& tag, int first, int count)
     {
-        auto child = parent->getItem(tagrow.tag, tagrow.row);
-        auto children = m_childrenStrategy->children(parent);
-        auto index = Utils::IndexOfItem(children, child);
-        if (index == -1)
+        // in the mode of lazy population, the lazy row of the parent is not fetched yet
+        auto parent_view = m_lazyPopulation ? row_view(parent) : construct_row_view(parent);
+        if (!parent_view)
             return;
 
-        auto pos = m_itemToVview.find(parent);
-        if (pos == m_itemToVview.end())
+        // views of children will be constructed when the parent is fetched
+        if (is_unfetched(parent_view))
             return;
 
-        auto parent_view = pos->second;
+        // children already having rows were shown as a part of the branch of their ancestor
+        auto lazy = lazy_rows(parent_view);
+        auto has_row = [this, &lazy](const SessionItem* item) {
+            return m_itemToVview.contains(item) || lazy.find(item) != lazy.end();
+        };
+        std::unordered_set<SessionItem*> inserted;
+        for (int row = first; row < first + count; ++row)
+            if (auto child = parent->getItem(tag, row); child && !has_row(child))
+                inserted.insert(child);
+        if (inserted.empty())
+            return;
 
-        auto row = m_rowStrategy->constructRow(child);
-        if (!row.empty()) {
-            auto next_parent = row.at(0).get();
-            m_viewModel->insertRow(parent_view, index, std::move(row));
-            m_itemToVview[child] = next_parent;
-            parent_view = next_parent; // labelItem
-            iterate(child, parent_view);
+        // position of new row is given by the number of preceding children with rows
+        int view_row{0};
+        int run_row{0};
+        std::vector<SessionItem*> run;
+        for (auto child : m_childrenStrategy->children(parent)) {
+            if (inserted.find(child) != inserted.end()) {
+                if (run.empty())
+                    run_row = view_row;
+                run.push_back(child);
+                continue;
+            }
+            if (!run.empty()) {
+                view_row = insert_run(parent_view, run_row, run);
+                run.clear();
+            }
+            if (has_row(child))
+                ++view_row;
         }
+        if (!run.empty())
+            insert_run(parent_view, run_row, run);
     }
 
-    std::vector<ViewItem*> findViews(const SessionItem* item) const
+    //! Inserts rows of given items, which are adjacent in the view model, and constructs views
+    //! beneath them. Returns the row following inserted rows.
+
+    int insert_run(ViewItem* parent_view, int row, const std::vector<SessionItem*>& items)
     {
-        if (item == m_viewModel->rootItem()->item())
-            return {m_viewModel->rootItem()};
+        auto inserted = insert_rows(parent_view, row, items);
+        if (!m_lazyPopulation)
+            for (size_t i = 0; i < inserted.size(); ++i)
+                iterate_row(parent_view, row + static_cast<int>(i), inserted[i]);
+        return row + static_cast<int>(inserted.size());
+    }
+
+    //! Notifies the view model about data change of given view. During the model transaction
+    //! notifications are collected, to be reported by ranges on commit.
 
-        std::vector<ViewItem*> result;
-        auto on_index = [&](const QModelIndex& index) {
-            auto view_item = m_viewModel->itemFromIndex(index);
-            if (view_item->item() == item)
-                result.push_back(view_item);
+    void notify_data_changed(ViewItem* view, int item_role)
+    {
+        auto roles = Utils::ItemRoleToQtRole(item_role);
+        if (m_self->model()->mapper()->isInTransaction()) {
+            auto it = m_changedViews.find(view);
+            if (it == m_changedViews.end()) {
+                m_changedViews.emplace(view, roles);
+            }
+            else {
+                for (auto role : roles)
+                    if (!it->second.contains(role))
+                        it->second.push_back(role);
+            }
+            return;
+        }
+        auto index = m_viewModel->indexFromItem(view);
+        m_viewModel->dataChanged(index, index, roles);
+    }
+
+    //! Reports collected data changes. Changed views of the same parent are reported as a single
+    //! range spanning all of them.
+
+    void flush_data_changes()
+    {
+        if (m_changedViews.empty())
+            return;
+
+        struct ChangedRange {
+            int top, bottom, left, right;
+            QVector<int> roles;
         };
-        Utils::iterate_model(m_viewModel, QModelIndex(), on_index);
-        return result;
+        std::vector<std::pair<ViewItem*, ChangedRange>> ranges;
+        std::unordered_map<ViewItem*, size_t> range_of_parent;
+        for (const auto& [view, roles] : m_changedViews) {
+            auto parent = view->parent();
+            const int row = view->row();
+            const int col = view->column();
+            auto it = range_of_parent.find(parent);
+            if (it == range_of_parent.end()) {
+                range_of_parent.emplace(parent, ranges.size());
+                ranges.push_back({parent, {row, row, col, col, roles}});
+                continue;
+            }
+            auto& range = ranges[it->second].second;
+            range.top = std::min(range.top, row);
+            range.bottom = std::max(range.bottom, row);
+            range.left = std::min(range.left, col);
+            range.right = std::max(range.right, col);
+            for (auto role : roles)
+                if (!range.roles.contains(role))
+                    range.roles.push_back(role);
+        }
+        m_changedViews.clear();
+
+        for (const auto& [parent, range] : ranges) {
+            auto parent_index = m_viewModel->indexFromItem(parent);
+            auto top_left = m_viewModel->index(range.top, range.left, parent_index);
+            auto bottom_right = m_viewModel->index(range.bottom, range.right, parent_index);
+            m_viewModel->dataChanged(top_left, bottom_right, range.roles);
+        }
+    }
+
+    //! Returns all views displaying given item. Thanks to the map of registered views the cost
+    //! doesn't depend on the size of the view model. Views of the lazy row of the item are
+    //! constructed.
+
+    std::vector<ViewItem*> findViews(const SessionItem* item)
+    {
+        if (item != m_viewModel->rootItem()->item() && !row_view(item))
+            construct_row_view(item);
+        return constructed_views(item);
     }
 
     void setRootSessionItemIntern(SessionItem* item)
@@ -166,22 +530,23 @@ ViewModelController::ViewModelController(SessionModel* session_model, ViewModelB
     auto on_data_change = [this](SessionItem* item, int role) { onDataChange(item, role); };
     setOnDataChange(on_data_change);
 
-    auto on_item_inserted = [this](SessionItem* item, TagRow tagrow) {
-        onItemInserted(item, std::move(tagrow));
+    auto on_items_inserted = [this](SessionItem* item, std::string tag, int first, int count) {
+        onItemsInserted(item, std::move(tag), first, count);
     };
-    setOnItemInserted(on_item_inserted);
+    setOnItemsInserted(on_items_inserted);
 
     auto on_item_removed = [this](SessionItem* item, TagRow tagrow) {
         onItemRemoved(item, std::move(tagrow));
     };
     setOnItemRemoved(on_item_removed);
 
-    auto on_about_to_remove = [this](SessionItem* item, TagRow tagrow) {
-        onAboutToRemoveItem(item, std::move(tagrow));
+    auto on_about_to_remove = [this](SessionItem* item, std::string tag, int first, int count) {
+        onAboutToRemoveItems(item, std::move(tag), first, count);
     };
-    setOnAboutToRemoveItem(on_about_to_remove);
+    setOnAboutToRemoveItems(on_about_to_remove);
 
     auto on_model_destroyed = [this](auto) {
+        p_impl->clear_views();
         p_impl->m_viewModel->setRootViewItem(std::make_unique<RootViewItem>(nullptr));
     };
     setOnModelDestroyed(on_model_destroyed);
@@ -194,8 +559,14 @@ ViewModelController::ViewModelController(SessionModel* session_model, ViewModelB
     };
     setOnModelReset(on_model_reset);
 
-    auto on_model_about_to_be_reset = [this](auto) { p_impl->m_viewModel->beginResetModel(); };
+    auto on_model_about_to_be_reset = [this](auto) {
+        p_impl->flush_data_changes();
+        p_impl->m_viewModel->beginResetModel();
+    };
     setOnModelAboutToBeReset(on_model_about_to_be_reset);
+
+    auto on_transaction_committed = [this](auto) { p_impl->flush_data_changes(); };
+    setOnTransactionCommitted(on_transaction_committed);
 }
 
 void ViewModelController::setViewModel(ViewModelBase* view_model)
@@ -233,6 +604,7 @@ void ViewModelController::setRootSessionItem(SessionItem* item)
         throw std::runtime_error(
             "Error in ViewModelController: atttemp to use item from alien model as new root.");
 
+    p_impl->flush_data_changes();
     p_impl->m_viewModel->beginResetModel();
     p_impl->setRootSessionItemIntern(item);
     p_impl->m_viewModel->endResetModel();
@@ -244,6 +616,61 @@ SessionItem* ViewModelController::rootSessionItem() const
     return p_impl->m_viewModel->rootItem()->item();
 }
 
+//! Sets the mode of lazy population. In this mode views are constructed only for children of the
+//! root item, and for children of views which were fetched on demand of Qt views. Should be set
+//! before the view model is initialized.
+
+void ViewModelController::setLazyPopulation(bool value)
+{
+    p_impl->m_lazyPopulation = value;
+}
+
+bool ViewModelController::isLazyPopulation() const
+{
+    return p_impl->m_lazyPopulation;
+}
+
+//! Returns true if given view has children, or if its item has children to be fetched.
+
+bool ViewModelController::hasChildren(const ViewItem* view) const
+{
+    if (canFetchMore(view))
+        return p_impl->m_childrenStrategy->hasChildren(view->item());
+    return view->rowCount() > 0;
+}
+
+//! Returns true if views of children of given view weren't constructed yet.
+
+bool ViewModelController::canFetchMore(const ViewItem* view) const
+{
+    return p_impl->is_unfetched(view);
+}
+
+//! Constructs views of children of given view, if they weren't constructed yet.
+
+void ViewModelController::fetchMore(ViewItem* view)
+{
+    if (canFetchMore(view))
+        p_impl->fetch_children(view->item(), view);
+}
+
+//! Removes views beneath given view, so they are constructed again, when fetched next time.
+//! Makes sense only in the mode of lazy population, for example, when the view is collapsed.
+
+void ViewModelController::releaseChildren(ViewItem* view)
+{
+    if (!p_impl->m_lazyPopulation || !view || !view->item() || canFetchMore(view))
+        return;
+
+    // only views in the first column carry children
+    if (p_impl->row_view(view->item()) != view || view == p_impl->m_viewModel->rootItem())
+        return;
+
+    p_impl->flush_data_changes();
+    p_impl->remove_children_of_view(view);
+    p_impl->m_fetched.erase(view);
+}
+
 //! Returns all ViewItem's displaying given SessionItem.
 
 std::vector<ViewItem*> ViewModelController::findViews(const SessionItem* item) const
@@ -258,24 +685,36 @@ QStringList ViewModelController::horizontalHeaderLabels() const
 
 void ViewModelController::onDataChange(SessionItem* item, int role)
 {
-    for (auto view : findViews(item)) {
+    // views of lazy rows, which are not constructed yet, weren't shown
+    for (auto view : p_impl->constructed_views(item)) {
         // inform corresponding LabelView and DataView
-        if (isValidItemRole(view, role)) {
-            auto index = p_impl->m_viewModel->indexFromItem(view);
-            p_impl->m_viewModel->dataChanged(index, index, Utils::ItemRoleToQtRole(role));
-        }
+        if (isValidItemRole(view, role))
+            p_impl->notify_data_changed(view, role);
     }
 }
 
 void ViewModelController::onItemInserted(SessionItem* parent, TagRow tagrow)
 {
-    p_impl->insert_view(parent, tagrow);
+    p_impl->insert_views(parent, tagrow.tag, tagrow.row, 1);
+}
+
+//! Processes insertion of the range of items. Rows of views for adjacent items are inserted into
+//! the view model at once.
+
+void ViewModelController::onItemsInserted(SessionItem* parent, std::string tag, int first,
+                                          int count)
+{
+    if (count == 1)
+        onItemInserted(parent, TagRow{tag, first});
+    else
+        p_impl->insert_views(parent, tag, first, count);
 }
 
 void ViewModelController::onItemRemoved(SessionItem*, TagRow) {}
 
 void ViewModelController::onAboutToRemoveItem(SessionItem* parent, TagRow tagrow)
 {
+    p_impl->flush_data_changes();
     auto item_to_remove = parent->getItem(tagrow.tag, tagrow.row);
     if (item_to_remove == rootSessionItem()
         || Utils::IsItemAncestor(rootSessionItem(), item_to_remove)) {
@@ -283,23 +722,53 @@ void ViewModelController::onAboutToRemoveItem(SessionItem* parent, TagRow tagrow
         // or root item iteslf
         p_impl->m_viewModel->beginResetModel();
         p_impl->m_viewModel->setRootViewItem(std::make_unique<RootViewItem>(nullptr));
-        p_impl->m_itemToVview.clear();
+        p_impl->clear_views();
         p_impl->m_rootItemPath = {};
         p_impl->m_viewModel->endResetModel();
     }
     else {
-        p_impl->remove_row_of_views(item_to_remove);
+        p_impl->remove_rows_of_views({item_to_remove});
     }
 }
 
+//! Processes removal of the range of items. Rows of views for adjacent items are removed from the
+//! view model at once.
+
+void ViewModelController::onAboutToRemoveItems(SessionItem* parent, std::string tag, int first,
+                                               int count)
+{
+    if (count == 1) {
+        onAboutToRemoveItem(parent, TagRow{tag, first});
+        return;
+    }
+
+    p_impl->flush_data_changes();
+    std::vector<SessionItem*> items_to_remove;
+    for (int row = first; row < first + count; ++row) {
+        auto item = parent->getItem(tag, row);
+        if (item == rootSessionItem() || Utils::IsItemAncestor(rootSessionItem(), item)) {
+            // root item itself, or one of its ancestors is removed, see onAboutToRemoveItem
+            onAboutToRemoveItem(parent, TagRow{tag, row});
+            return;
+        }
+        items_to_remove.push_back(item);
+    }
+    p_impl->remove_rows_of_views(items_to_remove);
+}
+
 void ViewModelController::update_branch(const SessionItem* item)
 {
     auto views = findViews(item);
     if (views.empty())
         return;
 
+    // views of children will be constructed when the view is fetched
+    if (canFetchMore(views.at(0)))
+        return;
+
+    p_impl->flush_data_changes();
     for (auto view : views)
         p_impl->remove_children_of_view(view);
 
-    p_impl->iterate(item, views.at(0));
+    p_impl->populate(item, views.at(0));
 }
@@ -44,6 +44,18 @@ public:
 
     SessionItem* rootSessionItem() const;
 
+    void setLazyPopulation(bool value);
+
+    bool isLazyPopulation() const;
+
+    bool hasChildren(const ViewItem* view) const;
+
+    bool canFetchMore(const ViewItem* view) const;
+
+    void fetchMore(ViewItem* view);
+
+    void releaseChildren(ViewItem* view);
+
     std::vector<ViewItem*> findViews(const ModelView::SessionItem* item) const;
 
     QStringList horizontalHeaderLabels() const;
@@ -51,8 +63,10 @@ public:
 protected:
     virtual void onDataChange(SessionItem* item, int role);
     virtual void onItemInserted(SessionItem* parent, TagRow tagrow);
+    virtual void onItemsInserted(SessionItem* parent, std::string tag, int first, int count);
     virtual void onItemRemoved(SessionItem* parent, TagRow tagrow);
     virtual void onAboutToRemoveItem(SessionItem* parent, TagRow tagrow);
+    virtual void onAboutToRemoveItems(SessionItem* parent, std::string tag, int first, int count);
 
     void update_branch(const SessionItem* item);
 
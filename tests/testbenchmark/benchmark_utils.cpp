@@ -0,0 +1,72 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+double BenchmarkUtils::MeasureTime(const std::function<void()>& fun, int nrepetitions)
+{
+    if (nrepetitions < 1)
+        return 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nrepetitions; ++i)
+        fun();
+    auto end = std::chrono::steady_clock::now();
+
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    return elapsed.count() / nrepetitions;
+}
+
+void BenchmarkUtils::Report(const std::string& name, double msec)
+{
+    std::cout << "[ BENCHMARK ] " << std::left << std::setw(60) << name << " : " << std::fixed
+              << std::setprecision(3) << msec << " ms" << std::endl;
+}
+
+void BenchmarkUtils::Compare(const std::string& name, double reference_msec, double msec)
+{
+    Report(name + " (reference)", reference_msec);
+    Report(name, msec);
+    if (msec > 0.0)
+        std::cout << "[ BENCHMARK ] " << std::left << std::setw(60) << name + " (speedup)"
+                  << " : " << std::fixed << std::setprecision(1) << reference_msec / msec << "x"
+                  << std::endl;
+}
+
+double BenchmarkUtils::ResidentMemory()
+{
+    // second field of statm is the number of resident pages
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages{0}, resident_pages{0};
+    if (!(statm >> total_pages >> resident_pages))
+        return 0.0;
+    const double page_size = 4096.0; // typical page size of Linux systems
+    return resident_pages * page_size / (1024.0 * 1024.0);
+}
+
+void BenchmarkUtils::ReportMemory(const std::string& name, double megabytes)
+{
+    std::cout << "[ BENCHMARK ] " << std::left << std::setw(60) << name << " : " << std::fixed
+              << std::setprecision(1) << megabytes << " MB" << std::endl;
+}
+
+void BenchmarkUtils::CompareMemory(const std::string& name, double reference_megabytes,
+                                   double megabytes)
+{
+    ReportMemory(name + " (reference)", reference_megabytes);
+    ReportMemory(name, megabytes);
+    if (megabytes > 0.0)
+        std::cout << "[ BENCHMARK ] " << std::left << std::setw(60) << name + " (reduction)"
+                  << " : " << std::fixed << std::setprecision(1)
+                  << reference_megabytes / megabytes << "x" << std::endl;
+}
@@ -0,0 +1,41 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#ifndef BENCHMARKUTILS_H
+#define BENCHMARKUTILS_H
+
+//! @file benchmark_utils.h
+//! @brief Collection of utility functions for performance benchmarks.
+
+#include <functional>
+#include <string>
+
+namespace BenchmarkUtils {
+
+//! Runs given function 'nrepetitions' times and returns average execution time in milliseconds.
+double MeasureTime(const std::function<void()>& fun, int nrepetitions = 1);
+
+//! Prints benchmark result in a form of 'name : time ms' to standard output.
+void Report(const std::string& name, double msec);
+
+//! Prints comparison of two benchmark results (reference and optimized) to standard output.
+void Compare(const std::string& name, double reference_msec, double msec);
+
+//! Returns resident set size of the process in megabytes, or zero if it is not available.
+double ResidentMemory();
+
+//! Prints memory usage in a form of 'name : memory MB' to standard output.
+void ReportMemory(const std::string& name, double megabytes);
+
+//! Prints comparison of memory taken by reference and optimized versions to standard output.
+void CompareMemory(const std::string& name, double reference_megabytes, double megabytes);
+
+} // namespace BenchmarkUtils
+
+#endif
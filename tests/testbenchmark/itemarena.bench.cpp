@@ -0,0 +1,75 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/itemutils.h"
+#include "mvvm/model/sessionmodel.h"
+
+using namespace ModelView;
+
+//! Performance of models with items allocated in the item arena versus items on the heap.
+
+class ItemArenaBenchmark : public ::testing::Test {
+public:
+    //! Compound item with four properties.
+    class TestItem : public CompoundItem {
+    public:
+        TestItem() : CompoundItem("TestItem")
+        {
+            addProperty("a", 1.0);
+            addProperty("b", 2.0);
+            addProperty("c", 3);
+            addProperty("d", "text");
+        }
+    };
+
+    //! Builds 500k items model (100k compound items with four properties each), traverses it
+    //! and clears it. Reports timings and memory footprint.
+    void run(bool arena_enabled)
+    {
+        const int nitems = 100000;
+        const std::string name = arena_enabled ? "arena" : "heap";
+
+        SessionModel model;
+        model.setItemArenaEnabled(arena_enabled);
+
+        const double rss_before = BenchmarkUtils::ResidentMemory();
+        auto build = [&]() { model.insertItems<TestItem>(model.rootItem(), {}, nitems); };
+        BenchmarkUtils::Report("construct 500k items, " + name, BenchmarkUtils::MeasureTime(build));
+        BenchmarkUtils::ReportMemory("memory of 500k items, " + name,
+                                     BenchmarkUtils::ResidentMemory() - rss_before);
+
+        int count{0};
+        auto traverse = [&]() {
+            Utils::iterate(model.rootItem(), [&count](auto item) {
+                if (item->hasData())
+                    ++count;
+            });
+        };
+        BenchmarkUtils::Report("traverse 500k items, " + name,
+                               BenchmarkUtils::MeasureTime(traverse, 10));
+        EXPECT_EQ(count, 10 * 4 * nitems);
+
+        auto clear = [&]() { model.clear(); };
+        BenchmarkUtils::Report("clear 500k items, " + name, BenchmarkUtils::MeasureTime(clear));
+        EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    }
+};
+
+TEST_F(ItemArenaBenchmark, heap)
+{
+    run(false);
+}
+
+TEST_F(ItemArenaBenchmark, arena)
+{
+    run(true);
+}
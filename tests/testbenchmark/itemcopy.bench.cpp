@@ -0,0 +1,105 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "toyitems.h"
+#include "toymodel.h"
+#include "mvvm/model/directitemcopystrategy.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/tagrow.h"
+#include "mvvm/serialization/jsonitembackupstrategy.h"
+#include "mvvm/serialization/jsonitemcopystrategy.h"
+
+using namespace ModelView;
+
+//! Performance of deep copying of items.
+
+class ItemCopyBenchmark : public ::testing::Test {
+public:
+    //! Creates multilayer with given number of layers and particles in each layer.
+    ToyItems::MultiLayerItem* createMultiLayer(SessionModel& model, int nlayers, int nparticles)
+    {
+        auto multilayer = model.insertItem<ToyItems::MultiLayerItem>();
+        for (int i = 0; i < nlayers; ++i) {
+            auto layer = model.insertItem<ToyItems::LayerItem>(multilayer);
+            for (int j = 0; j < nparticles; ++j)
+                model.insertItem<ToyItems::ParticleItem>(layer);
+        }
+        return multilayer;
+    }
+};
+
+//! Copies 10 times the multilayer with 100 layers, each one with 10 particles, as it happens on
+//! copy/paste of the layered sample. Reference is a copy through JSON.
+
+TEST_F(ItemCopyBenchmark, multiLayer)
+{
+    const int ncopies = 10;
+    const int nlayers = 100;
+    const int nparticles = 10;
+
+    ToyItems::SampleModel model;
+    auto multilayer = createMultiLayer(model, nlayers, nparticles);
+
+    JsonItemCopyStrategy reference_strategy(model.factory());
+    auto run_reference = [&]() {
+        for (int i = 0; i < ncopies; ++i)
+            reference_strategy.createCopy(multilayer);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    DirectItemCopyStrategy strategy(model.factory());
+    auto run = [&]() {
+        for (int i = 0; i < ncopies; ++i)
+            strategy.createCopy(multilayer);
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run);
+    EXPECT_EQ(strategy.createCopy(multilayer)->childrenCount(), nlayers);
+
+    BenchmarkUtils::Compare("copy multilayer with 1000 particles 10 times", reference_msec, msec);
+}
+
+//! Copy/paste of the multilayer through the model with undo/redo enabled, 10 times. Reference
+//! repeats what the copy command did before: copy through JSON, then backup to JSON in the command
+//! and restore from it on insertion.
+
+TEST_F(ItemCopyBenchmark, modelCopyItem)
+{
+    const int ncopies = 10;
+    const int nlayers = 100;
+    const int nparticles = 10;
+
+    ToyItems::SampleModel reference_model;
+    reference_model.setUndoRedoEnabled(true);
+    auto reference_multilayer = createMultiLayer(reference_model, nlayers, nparticles);
+    JsonItemCopyStrategy copy_strategy(reference_model.factory());
+    auto run_reference = [&]() {
+        for (int i = 0; i < ncopies; ++i) {
+            JsonItemBackupStrategy backup_strategy(reference_model.factory());
+            backup_strategy.saveItem(copy_strategy.createCopy(reference_multilayer).get());
+            reference_model.rootItem()->insertItem(backup_strategy.restoreItem(),
+                                                   TagRow::append());
+        }
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    ToyItems::SampleModel model;
+    model.setUndoRedoEnabled(true);
+    auto multilayer = createMultiLayer(model, nlayers, nparticles);
+    auto run = [&]() {
+        for (int i = 0; i < ncopies; ++i)
+            model.copyItem(multilayer, model.rootItem());
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run);
+    EXPECT_EQ(model.rootItem()->childrenCount(), ncopies + 1);
+
+    BenchmarkUtils::Compare("copy/paste multilayer with 1000 particles 10 times", reference_msec,
+                            msec);
+}
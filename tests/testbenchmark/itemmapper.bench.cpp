@@ -0,0 +1,61 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/signals/itemmapper.h"
+
+using namespace ModelView;
+
+//! Performance of notifications delivered to item mappers.
+
+class ItemMapperBenchmark : public ::testing::Test {
+public:
+    //! Creates model with given number of compound items, each one subscribed to own property
+    //! changes. Returns property of the first item.
+    SessionItem* create_items(SessionModel& model, int nitems, int& counter)
+    {
+        for (int i = 0; i < nitems; ++i) {
+            auto item = model.insertItem<CompoundItem>();
+            item->addProperty("height", 0);
+            item->mapper()->setOnPropertyChange([&counter](auto, auto) { ++counter; }, this);
+        }
+        return model.rootItem()->children().front()->getItem("height");
+    }
+};
+
+//! Changes 100k times the property of an item, while 1 and 10k items are subscribed to property
+//! changes. Time shouldn't depend on the number of subscribed items.
+
+TEST_F(ItemMapperBenchmark, propertyChange)
+{
+    const int nchanges = 100000;
+
+    int counter{0};
+    SessionModel reference_model;
+    auto reference_property = create_items(reference_model, 1, counter);
+    auto run_reference = [&]() {
+        for (int i = 0; i < nchanges; ++i)
+            reference_property->setData(i + 1);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    SessionModel model;
+    auto property = create_items(model, 10000, counter);
+    auto run = [&]() {
+        for (int i = 0; i < nchanges; ++i)
+            property->setData(i + 1);
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run);
+    EXPECT_EQ(counter, 2 * nchanges);
+
+    BenchmarkUtils::Compare("change property 100k times, 1 vs 10k mappers", reference_msec, msec);
+}
@@ -0,0 +1,69 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/model/itempool.h"
+#include "mvvm/model/sessionitem.h"
+#include <map>
+
+using namespace ModelView;
+
+//! Performance of ItemPool registration and lookup.
+
+class ItemPoolBenchmark : public ::testing::Test {
+};
+
+//! Registers, finds and unregisters 200k items. Reference is a pair of std::map with
+//! string identifiers, as it was used before.
+
+TEST_F(ItemPoolBenchmark, registerAndFind)
+{
+    const int nitems = 200000;
+    std::vector<std::unique_ptr<SessionItem>> items;
+    std::vector<identifier_type> keys;
+    for (int i = 0; i < nitems; ++i) {
+        items.emplace_back(std::make_unique<SessionItem>());
+        keys.push_back(items.back()->identifier());
+    }
+
+    size_t nfound{0};
+    auto run_pool = [&]() {
+        ItemPool pool;
+        for (int i = 0; i < nitems; ++i)
+            pool.register_item(items[i].get(), keys[i]);
+        for (int i = 0; i < nitems; ++i)
+            if (pool.item_for_key(keys[i]) == items[i].get())
+                ++nfound;
+        for (int i = 0; i < nitems; ++i)
+            pool.unregister_item(items[i].get());
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run_pool);
+    EXPECT_EQ(nfound, static_cast<size_t>(nitems));
+
+    auto run_reference = [&]() {
+        std::map<identifier_type, SessionItem*> key_to_item;
+        std::map<const SessionItem*, identifier_type> item_to_key;
+        for (int i = 0; i < nitems; ++i) {
+            key_to_item.insert(std::make_pair(keys[i], items[i].get()));
+            item_to_key.insert(std::make_pair(items[i].get(), keys[i]));
+        }
+        for (int i = 0; i < nitems; ++i)
+            if (key_to_item.find(keys[i])->second == items[i].get())
+                ++nfound;
+        for (int i = 0; i < nitems; ++i) {
+            auto it = item_to_key.find(items[i].get());
+            key_to_item.erase(it->second);
+            item_to_key.erase(it);
+        }
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    BenchmarkUtils::Compare("register/find/unregister of 200k items", reference_msec, msec);
+}
@@ -0,0 +1,100 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "folderbasedtest.h"
+#include "google_test.h"
+#include "test_utils.h"
+#include "mvvm/factories/modeldocumentfactory.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/serialization/binarydocument.h"
+#include "mvvm/standarditems/axisitems.h"
+#include "mvvm/standarditems/data2ditem.h"
+
+using namespace ModelView;
+
+//! Performance of saving and loading projects with large two-dimensional data.
+
+class ModelDocumentBenchmark : public FolderBasedTest {
+public:
+    ModelDocumentBenchmark() : FolderBasedTest("bench_ModelDocument") {}
+
+    //! Populates the model with 'nitems' Data2DItem's, each containing 'nbins x nbins' values.
+    void populate_model(SessionModel& model, int nitems, int nbins)
+    {
+        for (int i_item = 0; i_item < nitems; ++i_item) {
+            auto item = model.insertItem<Data2DItem>();
+            item->setAxes(FixedBinAxisItem::create(nbins, 0.0, 1.0),
+                          FixedBinAxisItem::create(nbins, 0.0, 1.0));
+            std::vector<double> values(static_cast<size_t>(nbins * nbins));
+            for (size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<double>(i) / 3.0;
+            item->setContent(std::move(values));
+        }
+    }
+};
+
+//! Saves and loads 10 Data2DItem's of 1000x1000 values using JSON and binary document.
+
+TEST_F(ModelDocumentBenchmark, saveLoadData2DItems)
+{
+    SessionModel model("DataModel");
+    populate_model(model, /*nitems*/ 10, /*nbins*/ 1000);
+    const auto expected = model.topItem<Data2DItem>()->content();
+
+    auto json_name = TestUtils::TestFileName(testDir(), "datamodel.json");
+    auto json_document = CreateJsonDocument({&model});
+    auto binary_name = TestUtils::TestFileName(testDir(), "datamodel.mvvm");
+    auto binary_document = CreateBinaryDocument({&model});
+
+    const double json_save = BenchmarkUtils::MeasureTime([&]() { json_document->save(json_name); });
+    const double binary_save =
+        BenchmarkUtils::MeasureTime([&]() { binary_document->save(binary_name); });
+    BenchmarkUtils::Compare("save 10 Data2DItem of 1000x1000", json_save, binary_save);
+
+    const double json_load = BenchmarkUtils::MeasureTime([&]() { json_document->load(json_name); });
+    EXPECT_EQ(model.topItem<Data2DItem>()->content(), expected);
+
+    const double binary_load =
+        BenchmarkUtils::MeasureTime([&]() { binary_document->load(binary_name); });
+    EXPECT_EQ(model.topItem<Data2DItem>()->content(), expected);
+    BenchmarkUtils::Compare("load 10 Data2DItem of 1000x1000", json_load, binary_load);
+}
+
+//! Loads 100 Data2DItem's of 300x300 values and accesses the content of three of them.
+//! Reference is the binary document with all arrays stored inline.
+
+TEST_F(ModelDocumentBenchmark, loadMappedData2DItems)
+{
+    SessionModel model("DataModel");
+    populate_model(model, /*nitems*/ 100, /*nbins*/ 300);
+
+    auto inline_name = TestUtils::TestFileName(testDir(), "inline.mvvm");
+    BinaryDocument inline_document({&model}, /*mapping_threshold*/ 0);
+    inline_document.save(inline_name);
+
+    auto mapped_name = TestUtils::TestFileName(testDir(), "mapped.mvvm");
+    BinaryDocument mapped_document({&model});
+    mapped_document.save(mapped_name);
+
+    auto load_and_access = [&model](BinaryDocument& document, const std::string& file_name) {
+        document.load(file_name);
+        auto items = model.topItems<Data2DItem>();
+        for (size_t index : {0u, 50u, 99u})
+            EXPECT_EQ(items[index]->content().size(), 90000u);
+        for (size_t index : {0u, 50u, 99u})
+            EXPECT_EQ(items[index]->content()[1], 1.0 / 3.0);
+    };
+
+    const double reference_msec = BenchmarkUtils::MeasureTime(
+        [&]() { load_and_access(inline_document, inline_name); });
+    const double msec = BenchmarkUtils::MeasureTime(
+        [&]() { load_and_access(mapped_document, mapped_name); });
+    BenchmarkUtils::Compare("load 100 Data2DItem of 300x300, access 3", reference_msec, msec);
+}
@@ -0,0 +1,68 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "toyitems.h"
+#include "toymodel.h"
+#include "mvvm/model/modelsnapshot.h"
+#include "mvvm/model/modelutils.h"
+#include "mvvm/model/snapshotitem.h"
+#include "mvvm/standarditems/vectoritem.h"
+
+using namespace ModelView;
+
+//! Performance of taking consistent copies of the model for background readers.
+
+class ModelSnapshotBenchmark : public ::testing::Test {
+};
+
+//! Changes a property of the particle and takes the state of the model 100 times, as it happens
+//! with background saving while the user edits the multilayer with 100 layers, each one with 10
+//! particles. Reference is a clone of the model.
+
+TEST_F(ModelSnapshotBenchmark, editAndTakeSnapshot)
+{
+    const int nsnapshots = 100;
+    const int nlayers = 100;
+    const int nparticles = 10;
+
+    ToyItems::SampleModel model;
+    auto multilayer = model.insertItem<ToyItems::MultiLayerItem>();
+    ToyItems::ParticleItem* particle{nullptr};
+    for (int i = 0; i < nlayers; ++i) {
+        auto layer = model.insertItem<ToyItems::LayerItem>(multilayer);
+        for (int j = 0; j < nparticles; ++j)
+            particle = model.insertItem<ToyItems::ParticleItem>(layer);
+    }
+    auto property =
+        particle->item<VectorItem>(ToyItems::ParticleItem::P_POSITION)->getItem(VectorItem::P_X);
+
+    auto run_reference = [&]() {
+        for (int i = 0; i < nsnapshots; ++i) {
+            property->setData(property->data<double>() + 1.0);
+            Utils::CreateClone(model);
+        }
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    ModelSnapshot snapshot(model);
+    auto run = [&]() {
+        for (int i = 0; i < nsnapshots; ++i) {
+            property->setData(property->data<double>() + 1.0);
+            snapshot = ModelSnapshot(model);
+        }
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run);
+    EXPECT_EQ(snapshot.findItem(property->identifier())->data<double>(),
+              property->data<double>());
+
+    BenchmarkUtils::Compare("edit and take state of model with 1000 particles 100 times",
+                            reference_msec, msec);
+}
@@ -0,0 +1,65 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/model/modelupdatequeue.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/signals/modelmapper.h"
+#include <thread>
+
+using namespace ModelView;
+
+//! Performance of model updates requested from the worker thread.
+
+class ModelUpdateQueueBenchmark : public ::testing::Test {
+};
+
+//! Worker thread produces 1M results for 100 items, while the model thread processes them in
+//! batches of 1000. Reference applies every result to the model, as it happens when each result
+//! is delivered by the queued signal.
+
+TEST_F(ModelUpdateQueueBenchmark, workerResults)
+{
+    const int nitems = 100;
+    const int nresults = 1000000;
+
+    SessionModel model;
+    auto items = model.insertItems<SessionItem>(model.rootItem(), {"", -1}, nitems);
+    std::vector<identifier_type> identifiers;
+    for (auto item : items)
+        identifiers.push_back(item->identifier());
+    int data_changes{0};
+    model.mapper()->setOnDataChange([&data_changes](auto, auto) { ++data_changes; }, this);
+
+    auto run_reference = [&]() {
+        for (int i = 0; i < nresults; ++i)
+            model.setData(items[i % nitems], i + 1, ItemDataRole::DATA);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    auto run = [&]() {
+        ModelUpdateQueue queue(&model);
+        std::thread worker([&]() {
+            for (int i = 0; i < nresults; ++i)
+                queue.setData(identifiers[i % nitems], -(i + 1));
+        });
+        while (items.back()->data<int>() != -nresults)
+            queue.process(1000);
+        worker.join();
+        queue.processAll();
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run);
+    EXPECT_EQ(items.front()->data<int>(), -(nresults - nitems + 1));
+    EXPECT_LE(data_changes, 2 * nresults);
+
+    BenchmarkUtils::Compare("apply 1M worker results to 100 items", reference_msec, msec);
+    model.mapper()->unsubscribe(this);
+}
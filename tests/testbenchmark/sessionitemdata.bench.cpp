@@ -0,0 +1,85 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/standarditems/axisitems.h"
+#include "mvvm/standarditems/data1ditem.h"
+#include "mvvm/standarditems/graphitem.h"
+
+using namespace ModelView;
+
+//! Performance of data access on board of SessionItem.
+
+class SessionItemDataBenchmark : public ::testing::Test {
+};
+
+//! Looks up 10M times the data of items with several roles. Reference is a linear search in the
+//! vector of roles with the variant returned by value, as it was done before.
+
+TEST_F(SessionItemDataBenchmark, dataLookup)
+{
+    const int nlookups = 10000000;
+    const std::vector<int> roles = {ItemDataRole::IDENTIFIER, ItemDataRole::DISPLAY,
+                                    ItemDataRole::APPEARANCE, ItemDataRole::TOOLTIP,
+                                    ItemDataRole::EDITORTYPE, ItemDataRole::DATA};
+    const auto text = Variant::fromValue(std::string("some text longer than SSO buffer"));
+
+    std::vector<DataRole> reference_data;
+    SessionItemData data;
+    for (auto role : roles) {
+        reference_data.push_back(DataRole(text, role));
+        data.setData(text, role);
+    }
+
+    size_t length{0};
+    auto run_reference = [&]() {
+        auto reference_lookup = [&reference_data](int role) {
+            for (const auto& x : reference_data)
+                if (x.m_role == role)
+                    return x.m_data;
+            return Variant();
+        };
+        for (int i = 0; i < nlookups; ++i)
+            length += reference_lookup(ItemDataRole::DATA).isValid();
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    auto run_lookup = [&]() {
+        for (int i = 0; i < nlookups; ++i)
+            length += data.data(ItemDataRole::DATA).isValid();
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run_lookup);
+    EXPECT_EQ(length, 2u * nlookups);
+
+    BenchmarkUtils::Compare("lookup data role 10M times", reference_msec, msec);
+}
+
+//! Requests 1M times values of the graph with 1000 points.
+
+TEST_F(SessionItemDataBenchmark, graphBinValues)
+{
+    const int ncalls = 1000000;
+    SessionModel model;
+    auto data_item = model.insertItem<Data1DItem>();
+    data_item->setAxis<FixedBinAxisItem>(1000, 0.0, 1000.0);
+    data_item->setValues(std::vector<double>(1000, 1.0));
+    auto graph_item = model.insertItem<GraphItem>();
+    graph_item->setDataItem(data_item);
+
+    double sum{0.0};
+    auto run = [&]() {
+        for (int i = 0; i < ncalls; ++i)
+            sum += graph_item->binValues()[0];
+    };
+    BenchmarkUtils::Report("request graph values 1M times", BenchmarkUtils::MeasureTime(run));
+    EXPECT_EQ(sum, ncalls);
+}
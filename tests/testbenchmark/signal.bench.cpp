@@ -0,0 +1,112 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/signals/callbackcontainer.h"
+#include <list>
+
+using namespace ModelView;
+
+namespace {
+
+//! Signal, as it was implemented before: list of callbacks with linear search on removal.
+
+template <typename T> class ReferenceSignal {
+public:
+    void connect(T callback, Callbacks::slot_t client) { m_callbacks.push_back({callback, client}); }
+
+    template <typename... Args> void operator()(Args... args)
+    {
+        for (const auto& f : m_callbacks)
+            f.first(args...);
+    }
+
+    void remove_client(Callbacks::slot_t client)
+    {
+        m_callbacks.remove_if([client](const auto& x) { return x.second == client; });
+    }
+
+private:
+    std::list<std::pair<T, Callbacks::slot_t>> m_callbacks;
+};
+
+} // namespace
+
+//! Performance of connection, notification and disconnection of signals.
+
+class SignalBenchmark : public ::testing::Test {
+public:
+    using callback_t = std::function<void(SessionItem*, std::string)>;
+
+    //! Client addresses, as if they were listener objects.
+    std::vector<char> clients = std::vector<char>(nclients);
+
+    static constexpr int nclients = 20000;
+};
+
+//! Connects 20k clients, and then disconnects them one by one in the order of connection, as it
+//! happens when a view with many listeners is closed.
+
+TEST_F(SignalBenchmark, connectDisconnect)
+{
+    int counter{0};
+    auto run_reference = [&]() {
+        ReferenceSignal<callback_t> signal;
+        for (auto& client : clients)
+            signal.connect([&counter](SessionItem*, std::string) { ++counter; }, &client);
+        for (auto& client : clients)
+            signal.remove_client(&client);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    auto run = [&]() {
+        Signal<callback_t> signal;
+        for (auto& client : clients)
+            signal.connect([&counter](SessionItem*, std::string) { ++counter; }, &client);
+        for (auto& client : clients)
+            signal.remove_client(&client);
+        EXPECT_TRUE(signal.empty());
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run);
+
+    BenchmarkUtils::Compare("connect and disconnect 20k clients", reference_msec, msec);
+}
+
+//! Notifies 20k clients 100 times with the string argument.
+
+TEST_F(SignalBenchmark, emit)
+{
+    const int nemissions = 100;
+    const std::string name("name longer than SSO buffer of the string");
+
+    size_t length{0};
+    ReferenceSignal<callback_t> reference_signal;
+    Signal<callback_t> signal;
+    for (auto& client : clients) {
+        auto callback = [&length](SessionItem*, std::string name) { length += name.size(); };
+        reference_signal.connect(callback, &client);
+        signal.connect(callback, &client);
+    }
+
+    auto run_reference = [&]() {
+        for (int i = 0; i < nemissions; ++i)
+            reference_signal(nullptr, name);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    auto run = [&]() {
+        for (int i = 0; i < nemissions; ++i)
+            signal(nullptr, name);
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run);
+    EXPECT_EQ(length, 2u * nemissions * nclients * name.size());
+
+    BenchmarkUtils::Compare("notify 20k clients 100 times", reference_msec, msec);
+}
@@ -0,0 +1,129 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/tagname.h"
+#include "mvvm/standarditems/axisitems.h"
+#include <string>
+#include <vector>
+
+using namespace ModelView;
+
+//! Performance of property access by tag name.
+
+class TagNameBenchmark : public ::testing::Test {
+};
+
+//! Reads 10M times the property of the item with 20 properties. Reference is an access via the
+//! string tag, which has to be looked up in the symbol table on every call.
+
+TEST_F(TagNameBenchmark, propertyAccess)
+{
+    const int nlookups = 10000000;
+    const int nproperties = 20;
+
+    CompoundItem item;
+    for (int i = 0; i < nproperties; ++i)
+        item.addProperty("Property" + std::to_string(i), i);
+
+    const std::string name("Property15");
+    int sum{0};
+    auto run_reference = [&]() {
+        for (int i = 0; i < nlookups; ++i)
+            sum += item.property<int>(name);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    const TagName tag(name);
+    auto run_interned = [&]() {
+        for (int i = 0; i < nlookups; ++i)
+            sum += item.property<int>(tag);
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run_interned);
+    EXPECT_EQ(sum, 2 * 15 * nlookups);
+
+    BenchmarkUtils::Compare("read property 10M times", reference_msec, msec);
+}
+
+namespace {
+
+//! Reproduces the lookup of the property before tag names were interned: containers are scanned
+//! linearly, comparing copies of their names with the copy of the requested name.
+
+class BaselineTags {
+public:
+    struct Container {
+        std::string m_name;
+        std::vector<SessionItem*> m_items;
+        std::string name() const { return m_name; }
+    };
+
+    explicit BaselineTags(const SessionItem& item)
+    {
+        for (auto child : item.children()) {
+            const std::string name = item.tagRowOfItem(child).tag.name();
+            if (!find_container(name))
+                m_containers.push_back({name, {}});
+            find_container(name)->m_items.push_back(child);
+        }
+    }
+
+    SessionItem* getItem(const std::string& tag_name, int row = 0) const
+    {
+        std::string name = tag_name;
+        auto container = find_container(name);
+        return row >= 0 && row < static_cast<int>(container->m_items.size())
+                   ? container->m_items[static_cast<size_t>(row)]
+                   : nullptr;
+    }
+
+private:
+    Container* find_container(const std::string& tag_name) const
+    {
+        for (auto& container : m_containers)
+            if (container.name() == tag_name)
+                return &container;
+        return nullptr;
+    }
+
+    mutable std::vector<Container> m_containers;
+};
+
+} // namespace
+
+//! Reads 10M times the property of the axis item via its TagName constant. Reference is the
+//! lookup as it was done before tag names were interned.
+
+TEST_F(TagNameBenchmark, propertyAccessAgainstBaseline)
+{
+    const int nlookups = 10000000;
+
+    ViewportAxisItem item;
+    item.setProperty(ViewportAxisItem::P_MAX, 42.0);
+    BaselineTags baseline(item);
+
+    double sum{0.0};
+    auto run_reference = [&]() {
+        for (int i = 0; i < nlookups; ++i)
+            sum += baseline.getItem(ViewportAxisItem::P_MAX.name())->data<double>();
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    auto run_interned = [&]() {
+        for (int i = 0; i < nlookups; ++i)
+            sum += item.property<double>(ViewportAxisItem::P_MAX);
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run_interned);
+    EXPECT_DOUBLE_EQ(sum, 2 * 42.0 * nlookups);
+
+    BenchmarkUtils::Compare("read axis property 10M times, pre-interning lookup", reference_msec,
+                            msec);
+}
@@ -0,0 +1,74 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/interfaces/undostackinterface.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/standarditems/axisitems.h"
+#include "mvvm/standarditems/data1ditem.h"
+
+using namespace ModelView;
+
+//! Performance of model changes recorded in the undo stack.
+
+class UndoStackBenchmark : public ::testing::Test {
+};
+
+//! Sets 10k values of the item, which is the last one among 1000 siblings, as it happens while
+//! dragging a slider. Then undoes and redoes all changes.
+
+TEST_F(UndoStackBenchmark, setValue)
+{
+    const int nchanges = 10000;
+
+    SessionModel model;
+    model.insertItems<SessionItem>(model.rootItem(), {"", 0}, 999);
+    auto item = model.insertItem<SessionItem>();
+    model.setUndoRedoEnabled(true);
+
+    auto run_set = [&]() {
+        for (int i = 0; i < nchanges; ++i)
+            item->setData(static_cast<double>(i + 1));
+    };
+    BenchmarkUtils::Report("set 10k values", BenchmarkUtils::MeasureTime(run_set));
+
+    auto run_undo_redo = [&]() {
+        for (int i = 0; i < nchanges; ++i)
+            model.undoStack()->undo();
+        for (int i = 0; i < nchanges; ++i)
+            model.undoStack()->redo();
+    };
+    BenchmarkUtils::Report("undo and redo 10k values", BenchmarkUtils::MeasureTime(run_undo_redo));
+    EXPECT_EQ(item->data<double>(), nchanges);
+}
+
+//! Removes 100 times the item with 1M points, and restores it by undo.
+
+TEST_F(UndoStackBenchmark, removeItem)
+{
+    const int nremovals = 100;
+    const int npoints = 1000000;
+
+    SessionModel model;
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis<FixedBinAxisItem>(npoints, 0.0, 1.0);
+    model.setUndoRedoEnabled(true);
+
+    auto run = [&]() {
+        for (int i = 0; i < nremovals; ++i) {
+            model.removeItem(model.rootItem(), {"", 0});
+            model.undoStack()->undo();
+        }
+    };
+    BenchmarkUtils::Report("remove and restore item with 1M points 100 times",
+                           BenchmarkUtils::MeasureTime(run));
+    EXPECT_EQ(model.rootItem()->children().front(), item);
+}
@@ -0,0 +1,87 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/core/uniqueidgenerator.h"
+#include "mvvm/factories/modelconverterfactory.h"
+#include "mvvm/model/identifierloadingscope.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include <QJsonObject>
+#include <QUuid>
+
+using namespace ModelView;
+
+//! Performance of identifier generation and its impact on item construction.
+
+class UniqueIdGeneratorBenchmark : public ::testing::Test {
+};
+
+//! Generates 1M identifiers. Reference is QUuid based generation, as it was used before.
+
+TEST_F(UniqueIdGeneratorBenchmark, generate)
+{
+    const int nids = 1000000;
+    size_t length{0};
+
+    auto run_reference = [&]() {
+        for (int i = 0; i < nids; ++i)
+            length += QUuid::createUuid().toString().toStdString().size();
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(run_reference);
+
+    auto run_generator = [&]() {
+        for (int i = 0; i < nids; ++i)
+            length += UniqueIdGenerator::generate().size();
+    };
+    const double msec = BenchmarkUtils::MeasureTime(run_generator);
+    EXPECT_EQ(length, 2u * nids * 38);
+
+    BenchmarkUtils::Compare("generate 1M identifiers", reference_msec, msec);
+}
+
+//! Constructs 1M items with identifiers, and as loaders do, leaving identifiers to them.
+
+TEST_F(UniqueIdGeneratorBenchmark, createItems)
+{
+    const int nitems = 1000000;
+
+    auto create_items = [&]() {
+        std::vector<std::unique_ptr<SessionItem>> items;
+        items.reserve(nitems);
+        for (int i = 0; i < nitems; ++i)
+            items.emplace_back(std::make_unique<SessionItem>());
+    };
+
+    const double reference_msec = BenchmarkUtils::MeasureTime(create_items);
+    const double msec = BenchmarkUtils::MeasureTime([&]() {
+        IdentifierLoadingScope scope;
+        create_items();
+    });
+    BenchmarkUtils::Compare("create 1M items, identifiers left to loader", reference_msec, msec);
+}
+
+//! Loads model with 100k items from JSON in project mode. Identifiers come from JSON and no
+//! throwaway identifier is generated.
+
+TEST_F(UniqueIdGeneratorBenchmark, loadModelFromJson)
+{
+    const int nitems = 100000;
+    SessionModel model("TestModel");
+    for (int i = 0; i < nitems; ++i)
+        model.insertItem<SessionItem>();
+
+    auto converter = CreateModelProjectConverter();
+    auto json = converter->to_json(model);
+
+    const double msec = BenchmarkUtils::MeasureTime([&]() { converter->from_json(json, model); });
+    EXPECT_EQ(model.rootItem()->childrenCount(), nitems);
+    BenchmarkUtils::Report("load 100k items from JSON", msec);
+}
@@ -0,0 +1,69 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/standarditems/containeritem.h"
+#include "mvvm/utils/containerutils.h"
+#include "mvvm/viewmodel/topitemsviewmodel.h"
+#include "mvvm/viewmodel/viewitem.h"
+
+using namespace ModelView;
+
+//! Performance of ViewModelBase while serving index requests from Qt views.
+
+class ViewModelBaseBenchmark : public ::testing::Test {
+};
+
+//! Emulates scrolling through the flat TopItemsViewModel with 100k rows. For every visible cell
+//! Qt views ask for an index, its data, its parent, and index of the item for selection.
+//! Reference is the linear search of the item among its siblings, as it was before.
+
+TEST_F(ViewModelBaseBenchmark, scrollFlatTopItemsViewModel)
+{
+    const int nrows = 100000;
+    SessionModel model;
+    for (int i = 0; i < nrows; ++i)
+        model.insertItem<ContainerItem>();
+    TopItemsViewModel view_model(&model);
+    ASSERT_EQ(view_model.rowCount(), nrows);
+
+    int nvalid{0};
+    auto scroll = [&]() {
+        for (int row = 0; row < nrows; ++row) {
+            for (int col = 0; col < view_model.columnCount(); ++col) {
+                auto index = view_model.index(row, col);
+                view_model.data(index);
+                view_model.parent(index);
+                if (view_model.indexFromItem(view_model.itemFromIndex(index)) == index)
+                    ++nvalid;
+            }
+        }
+    };
+    const double msec = BenchmarkUtils::MeasureTime(scroll);
+    EXPECT_EQ(nvalid, nrows * view_model.columnCount());
+
+    // Reference is too slow to run over all rows, we measure it on a subset and scale.
+    const int nreference = 1000;
+    auto find_by_search = [&]() {
+        auto children = view_model.rootItem()->children();
+        for (int row = nrows - nreference; row < nrows; ++row) {
+            for (int col = 0; col < view_model.columnCount(); ++col) {
+                auto view = view_model.rootItem()->child(row, col);
+                auto position = Utils::IndexOfItem(children.begin(), children.end(), view);
+                EXPECT_EQ(position, row * view_model.columnCount() + col);
+            }
+        }
+    };
+    const double reference_msec =
+        BenchmarkUtils::MeasureTime(find_by_search) * static_cast<double>(nrows) / nreference;
+
+    BenchmarkUtils::Compare("index requests while scrolling 100k rows", reference_msec, msec);
+}
@@ -0,0 +1,235 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "benchmark_utils.h"
+#include "google_test.h"
+#include "mvvm/factories/viewmodelcontrollerbuilder.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/itemutils.h"
+#include "mvvm/model/propertyitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/taginfo.h"
+#include "mvvm/standarditems/containeritem.h"
+#include "mvvm/viewmodel/defaultviewmodel.h"
+#include "mvvm/viewmodel/labeldatarowstrategy.h"
+#include "mvvm/viewmodel/standardchildrenstrategies.h"
+#include "mvvm/viewmodel/topitemsviewmodel.h"
+#include "mvvm/viewmodel/viewitem.h"
+#include "mvvm/viewmodel/viewmodel.h"
+#include "mvvm/viewmodel/viewmodelutils.h"
+
+using namespace ModelView;
+
+//! Performance of ViewModelController while propagating data changes to the view model.
+
+class ViewModelControllerBenchmark : public ::testing::Test {
+public:
+    //! Populates the model with 'ntop' top level items. Each of them is the root of a chain of
+    //! 'depth' nested compound items, every item in a chain carries 'nproperties' properties.
+    //! Returns vector of all property items created.
+    std::vector<SessionItem*> create_deep_model(SessionModel& model, int ntop, int depth,
+                                                int nproperties)
+    {
+        std::vector<SessionItem*> result;
+        for (int i_top = 0; i_top < ntop; ++i_top) {
+            SessionItem* parent = model.rootItem();
+            for (int i_level = 0; i_level < depth; ++i_level) {
+                auto item = model.insertItem<CompoundItem>(parent);
+                item->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+                for (int i_prop = 0; i_prop < nproperties; ++i_prop)
+                    result.push_back(item->addProperty("p" + std::to_string(i_prop), 0.0));
+                parent = item;
+            }
+        }
+        return result;
+    }
+};
+
+//! Changes data of 10k leaf properties in a deep model, while the model is shown by the view
+//! model. Reference is the full walk over the view model to find views of the changed item.
+
+TEST_F(ViewModelControllerBenchmark, setDataOfLeafProperties)
+{
+    SessionModel model;
+    auto leaves = create_deep_model(model, /*ntop*/ 100, /*depth*/ 10, /*nproperties*/ 10);
+    DefaultViewModel view_model(&model);
+
+    double value{0.0};
+    auto set_data = [&]() {
+        for (auto leaf : leaves)
+            leaf->setData(++value);
+    };
+    const double msec = BenchmarkUtils::MeasureTime(set_data);
+
+    // Reference is too slow to run over all leaves, we measure it on a subset and scale.
+    const size_t nreference = 100;
+    auto find_views_by_walk = [&]() {
+        for (size_t i = 0; i < nreference; ++i) {
+            std::vector<ViewItem*> views;
+            auto on_index = [&](const QModelIndex& index) {
+                if (auto view = view_model.itemFromIndex(index); view->item() == leaves[i])
+                    views.push_back(view);
+            };
+            Utils::iterate_model(&view_model, QModelIndex(), on_index);
+            EXPECT_EQ(views.size(), 2u);
+        }
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(find_views_by_walk)
+                                  * static_cast<double>(leaves.size()) / nreference;
+
+    BenchmarkUtils::Compare("setData of 10k leaf properties", reference_msec, msec);
+
+    for (auto leaf : leaves)
+        EXPECT_EQ(view_model.findViews(leaf).size(), 2u);
+}
+
+//! Appends items to ContainerItem shown by the view model. Reference is the insertion of items one
+//! by one, where every insertion is processed by the view model separately.
+
+TEST_F(ViewModelControllerBenchmark, appendItemsToContainer)
+{
+    const int nitems = 10000;
+
+    auto append_one_by_one = [nitems]() {
+        SessionModel model;
+        auto container = model.insertItem<ContainerItem>();
+        DefaultViewModel view_model(&model);
+        for (int i = 0; i < nitems; ++i)
+            model.insertItem<PropertyItem>(container);
+        EXPECT_EQ(view_model.rowCount(view_model.index(0, 0)), nitems);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(append_one_by_one);
+
+    auto append_range = [](int count) {
+        SessionModel model;
+        auto container = model.insertItem<ContainerItem>();
+        DefaultViewModel view_model(&model);
+        model.insertItems<PropertyItem>(container, {}, count);
+        EXPECT_EQ(view_model.rowCount(view_model.index(0, 0)), count);
+    };
+    const double msec = BenchmarkUtils::MeasureTime([&]() { append_range(nitems); });
+    BenchmarkUtils::Compare("append 10k items to container", reference_msec, msec);
+
+    // bulk insertion grows linearly with the number of items
+    const double msec_100k = BenchmarkUtils::MeasureTime([&]() { append_range(10 * nitems); });
+    BenchmarkUtils::Report("append 100k items to container", msec_100k);
+}
+
+//! Builds the view model over 100k top level items. Reference is the collection of top level
+//! items, as it was done before, when the tag of every child was searched anew.
+
+TEST_F(ViewModelControllerBenchmark, topItemsViewModel)
+{
+    const int nitems = 100000;
+
+    SessionModel model;
+    model.insertItems<SessionItem>(model.rootItem(), {"", 0}, nitems);
+    const auto& root = *model.rootItem();
+
+    // Reference is too slow to run over all items, we measure it on evenly spaced subset and
+    // scale.
+    const size_t nreference = 1000;
+    auto collect_by_search = [&]() {
+        std::vector<SessionItem*> result;
+        auto children = root.children();
+        for (size_t i = 0; i < children.size(); i += children.size() / nreference)
+            if (!Utils::IsSinglePropertyTag(root, root.tagRowOfItem(children[i]).tag))
+                result.push_back(children[i]);
+        EXPECT_EQ(result.size(), nreference);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(collect_by_search)
+                                  * static_cast<double>(nitems) / nreference;
+
+    auto collect = [&]() { EXPECT_EQ(Utils::TopLevelItems(root).size(), static_cast<size_t>(nitems)); };
+    BenchmarkUtils::Compare("collect 100k top level items", reference_msec,
+                            BenchmarkUtils::MeasureTime(collect));
+
+    auto build = [&]() {
+        TopItemsViewModel view_model(&model);
+        EXPECT_EQ(view_model.rowCount(), nitems);
+    };
+    BenchmarkUtils::Report("build view model over 100k top level items",
+                           BenchmarkUtils::MeasureTime(build));
+}
+
+//! Builds the view model over the deep model with 110k items, as it happens when the tree view is
+//! opened. Reference is the view model, which constructs views for all items at once. Lazy view
+//! model constructs views of top level items only.
+
+TEST_F(ViewModelControllerBenchmark, lazyPopulation)
+{
+    SessionModel model;
+    create_deep_model(model, /*ntop*/ 1000, /*depth*/ 10, /*nproperties*/ 10);
+
+    auto build_reference = [&]() {
+        DefaultViewModel view_model(&model);
+        EXPECT_EQ(view_model.rowCount(), 1000);
+    };
+    const double reference_msec = BenchmarkUtils::MeasureTime(build_reference);
+
+    auto build_lazy = [&]() {
+        std::unique_ptr<ViewModelController> controller =
+            ViewModelControllerBuilder()
+                .model(&model)
+                .childrenStrategy(std::make_unique<AllChildrenStrategy>())
+                .rowStrategy(std::make_unique<LabelDataRowStrategy>())
+                .lazyPopulation();
+        ViewModel view_model(std::move(controller));
+        EXPECT_EQ(view_model.rowCount(), 1000);
+    };
+    const double msec = BenchmarkUtils::MeasureTime(build_lazy);
+
+    BenchmarkUtils::Compare("build view model over 110k items", reference_msec, msec);
+}
+
+//! Memory taken by views of the DefaultViewModel over the deep model with 110k items. Reference is
+//! the view model constructing a view per cell for all rows at once, as it was done before rows
+//! were constructed on demand. The original views also carried a pimpl per cell, so the reference
+//! is the lower bound of the original memory.
+
+TEST_F(ViewModelControllerBenchmark, memoryOfViews)
+{
+    //! Row strategy, which doesn't report the size of rows, so they are constructed at once.
+    class ConstructedRowStrategy : public LabelDataRowStrategy {
+    public:
+        int columnCount(const SessionItem*) const override { return -1; }
+    };
+
+    SessionModel model;
+    create_deep_model(model, /*ntop*/ 1000, /*depth*/ 10, /*nproperties*/ 10);
+
+    // view models are kept alive, so memory released by one of them is not reused by another
+    double rss_before = BenchmarkUtils::ResidentMemory();
+    auto view_model = std::make_unique<DefaultViewModel>(&model);
+    const double megabytes = BenchmarkUtils::ResidentMemory() - rss_before;
+    EXPECT_EQ(view_model->rowCount(), 1000);
+
+    rss_before = BenchmarkUtils::ResidentMemory();
+    std::unique_ptr<ViewModelController> controller =
+        ViewModelControllerBuilder()
+            .model(&model)
+            .childrenStrategy(std::make_unique<AllChildrenStrategy>())
+            .rowStrategy(std::make_unique<ConstructedRowStrategy>());
+    auto reference_view_model = std::make_unique<ViewModel>(std::move(controller));
+    const double reference_megabytes = BenchmarkUtils::ResidentMemory() - rss_before;
+    EXPECT_EQ(reference_view_model->rowCount(), 1000);
+
+    BenchmarkUtils::CompareMemory("views of 110k items", reference_megabytes, megabytes);
+
+    // all rows are accessed, as when the whole tree is expanded and scrolled through
+    rss_before = BenchmarkUtils::ResidentMemory();
+    int ncells{0};
+    Utils::iterate_model(view_model.get(), QModelIndex(), [&](const QModelIndex& index) {
+        if (view_model->itemFromIndex(index))
+            ++ncells;
+    });
+    BenchmarkUtils::ReportMemory("views of 110k items, all accessed",
+                                 megabytes + BenchmarkUtils::ResidentMemory() - rss_before);
+    EXPECT_EQ(ncells, 2 * 110000);
+}
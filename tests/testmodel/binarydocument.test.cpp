@@ -0,0 +1,402 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/serialization/binarydocument.h"
+
+#include "folderbasedtest.h"
+#include "google_test.h"
+#include "test_utils.h"
+#include "mvvm/interfaces/undostackinterface.h"
+#include "mvvm/model/comboproperty.h"
+#include "mvvm/model/externalproperty.h"
+#include "mvvm/model/propertyitem.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemtags.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/taginfo.h"
+#include "mvvm/standarditems/axisitems.h"
+#include "mvvm/standarditems/data2ditem.h"
+#include "mvvm/standarditems/vectoritem.h"
+#include "mvvm/utils/fileutils.h"
+#include "mvvm/utils/reallimits.h"
+#include <QColor>
+#include <QFile>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests BinaryDocument class
+
+class BinaryDocumentTest : public FolderBasedTest {
+public:
+    BinaryDocumentTest() : FolderBasedTest("test_BinaryDocument") {}
+
+    class TestModel1 : public SessionModel {
+    public:
+        TestModel1() : SessionModel("TestModel1") {}
+    };
+
+    class TestModel2 : public SessionModel {
+    public:
+        TestModel2() : SessionModel("TestModel2") {}
+    };
+};
+
+//! Saving the model with content into document and restoring it after.
+
+TEST_F(BinaryDocumentTest, saveLoadSingleModel)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadSingleModel.mvvm");
+    SessionModel model("TestModel");
+    BinaryDocument document({&model});
+
+    // filling model with parent and child
+    auto parent = model.insertItem<SessionItem>();
+    parent->setDisplayName("parent_name");
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    const auto parent_identifier = parent->identifier();
+
+    parent->setData(QVariant::fromValue(42));
+    auto child = model.insertItem<PropertyItem>(parent);
+    child->setDisplayName("child_name");
+    const auto child_identifier = child->identifier();
+
+    // saving model in file
+    document.save(fileName);
+
+    // modifying model further
+    model.removeItem(model.rootItem(), {"", 0});
+
+    // loading model from file
+    document.load(fileName);
+
+    // accessing reconstructed parent and child
+    auto reco_parent = model.rootItem()->getItem("", 0);
+    auto reco_child = reco_parent->getItem("", 0);
+
+    // checking parent reconstruction, display name isn't stored as in JSON project mode
+    EXPECT_EQ(reco_parent->model(), &model);
+    EXPECT_EQ(reco_parent->modelType(), Constants::BaseType);
+    EXPECT_EQ(reco_parent->parent(), model.rootItem());
+    EXPECT_EQ(reco_parent->displayName(), "SessionItem");
+    EXPECT_EQ(reco_parent->childrenCount(), 1);
+    EXPECT_EQ(reco_parent->identifier(), parent_identifier);
+    EXPECT_EQ(reco_parent->itemTags()->defaultTag(), "defaultTag");
+    EXPECT_EQ(reco_parent->data<int>(), 42);
+
+    // checking child reconstruction, display name is the one given by the item constructor
+    EXPECT_EQ(reco_child->model(), &model);
+    EXPECT_EQ(reco_child->modelType(), Constants::PropertyType);
+    EXPECT_EQ(reco_child->parent(), reco_parent);
+    EXPECT_EQ(reco_child->displayName(), "Property");
+    EXPECT_EQ(reco_child->childrenCount(), 0);
+    EXPECT_EQ(reco_child->identifier(), child_identifier);
+    EXPECT_EQ(reco_child->itemTags()->defaultTag(), "");
+}
+
+//! Saving and restoring items carrying all supported variant types.
+
+TEST_F(BinaryDocumentTest, saveLoadVariants)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadVariants.mvvm");
+    SessionModel model("TestModel");
+    BinaryDocument document({&model});
+
+    auto combo = ComboProperty::createFrom({"a1", "a2", "a3"});
+    combo.setSelected(1);
+    auto extprop = ExternalProperty("text", QColor(Qt::red), "identifier");
+    auto limits = RealLimits::limited(1.0, 2.0);
+    const std::vector<double> vec{1.0, 2.0, 3.0};
+
+    std::vector<QVariant> variants = {QVariant(),
+                                      QVariant::fromValue(true),
+                                      QVariant::fromValue(42),
+                                      QVariant::fromValue(std::string("abc")),
+                                      QVariant::fromValue(43.1),
+                                      QVariant::fromValue(vec),
+                                      QVariant::fromValue(DoubleArray(vec)),
+                                      QVariant::fromValue(combo),
+                                      QVariant::fromValue(QColor(Qt::green)),
+                                      QVariant::fromValue(extprop),
+                                      QVariant::fromValue(limits)};
+
+    for (const auto& variant : variants) {
+        auto item = model.insertItem<PropertyItem>();
+        if (variant.isValid())
+            item->setData(variant);
+    }
+
+    document.save(fileName);
+    model.clear();
+    document.load(fileName);
+
+    ASSERT_EQ(model.rootItem()->childrenCount(), static_cast<int>(variants.size()));
+    for (size_t i = 0; i < variants.size(); ++i)
+        EXPECT_EQ(model.rootItem()->children()[i]->data<QVariant>(), variants[i]);
+}
+
+//! Saving and restoring item with two-dimensional data.
+
+TEST_F(BinaryDocumentTest, saveLoadData2DItem)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadData2DItem.mvvm");
+    SessionModel model("TestModel");
+    BinaryDocument document({&model});
+
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(3, 0.0, 3.0), FixedBinAxisItem::create(2, 0.0, 2.0));
+    const std::vector<double> expected{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    item->setContent(expected);
+    const auto identifier = item->identifier();
+
+    document.save(fileName);
+    model.clear();
+    document.load(fileName);
+
+    auto reco_item = dynamic_cast<Data2DItem*>(model.rootItem()->getItem("", 0));
+    ASSERT_TRUE(reco_item != nullptr);
+    EXPECT_EQ(reco_item->identifier(), identifier);
+    EXPECT_EQ(reco_item->xAxis()->binCenters(), std::vector<double>({0.5, 1.5, 2.5}));
+    EXPECT_EQ(reco_item->yAxis()->binCenters(), std::vector<double>({0.5, 1.5}));
+    EXPECT_EQ(reco_item->content(), expected);
+
+    // roles set by the item constructor are kept
+    auto values = reco_item->getItem(Data2DItem::P_VALUES);
+    EXPECT_EQ(values->displayName(), "Values");
+    EXPECT_FALSE(values->isEditable());
+}
+
+//! Saving and restoring compound item preserves roles of its properties given by constructor.
+
+TEST_F(BinaryDocumentTest, saveLoadVectorItem)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadVectorItem.mvvm");
+    SessionModel model("TestModel");
+    BinaryDocument document({&model});
+
+    auto item = model.insertItem<VectorItem>();
+    item->setX(1.0);
+    item->setZ(3.0);
+    const auto identifier = item->getItem(VectorItem::P_X)->identifier();
+
+    document.save(fileName);
+    model.clear();
+    document.load(fileName);
+
+    auto reco_item = model.topItem<VectorItem>();
+    ASSERT_TRUE(reco_item != nullptr);
+    EXPECT_EQ(reco_item->x(), 1.0);
+    EXPECT_EQ(reco_item->y(), 0.0);
+    EXPECT_EQ(reco_item->z(), 3.0);
+
+    auto reco_x = reco_item->getItem(VectorItem::P_X);
+    EXPECT_EQ(reco_x->identifier(), identifier);
+    EXPECT_EQ(reco_x->displayName(), "X");
+    EXPECT_TRUE(reco_x->isEditable());
+    EXPECT_EQ(reco_x->data<RealLimits>(ItemDataRole::LIMITS), RealLimits::limitless());
+    EXPECT_EQ(reco_item->getItem(VectorItem::P_Z)->displayName(), "Z");
+}
+
+//! Saving two models with content into document and restoring it after.
+
+TEST_F(BinaryDocumentTest, saveLoadTwoModels)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "saveLoadTwoModels.mvvm");
+    TestModel1 model1;
+    TestModel2 model2;
+    BinaryDocument document({&model1, &model2});
+
+    auto parent1 = model1.insertItem<SessionItem>();
+    const auto parent_identifier1 = parent1->identifier();
+
+    auto parent2 = model2.insertItem<SessionItem>();
+    const auto parent_identifier2 = parent2->identifier();
+
+    document.save(fileName);
+
+    model1.removeItem(model1.rootItem(), {"", 0});
+    model2.removeItem(model2.rootItem(), {"", 0});
+
+    document.load(fileName);
+
+    auto reco_parent1 = model1.rootItem()->getItem("", 0);
+    auto reco_parent2 = model2.rootItem()->getItem("", 0);
+
+    EXPECT_EQ(reco_parent1->model(), &model1);
+    EXPECT_EQ(reco_parent1->parent(), model1.rootItem());
+    EXPECT_EQ(reco_parent1->identifier(), parent_identifier1);
+
+    EXPECT_EQ(reco_parent2->model(), &model2);
+    EXPECT_EQ(reco_parent2->parent(), model2.rootItem());
+    EXPECT_EQ(reco_parent2->identifier(), parent_identifier2);
+}
+
+//! Attempt to restore models in wrong order.
+
+TEST_F(BinaryDocumentTest, loadModelsInWrongOrder)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "loadModelsInWrongOrder.mvvm");
+    TestModel1 model1;
+    TestModel2 model2;
+
+    model1.insertItem<SessionItem>();
+    model2.insertItem<SessionItem>();
+
+    {
+        BinaryDocument document({&model1, &model2});
+        document.save(fileName);
+    }
+
+    BinaryDocument document({&model2, &model1}); // intentional wrong order
+    EXPECT_THROW(document.load(fileName), std::runtime_error);
+}
+
+//! Attempt to load file which is not a binary document.
+
+TEST_F(BinaryDocumentTest, loadInvalidFile)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "loadInvalidFile.mvvm");
+    {
+        QFile file(QString::fromStdString(fileName));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("[]");
+    }
+
+    SessionModel model("TestModel");
+    BinaryDocument document({&model});
+    EXPECT_THROW(document.load(fileName), std::runtime_error);
+    EXPECT_THROW(document.load(TestUtils::TestFileName(testDir(), "nonexisting.mvvm")),
+                 std::runtime_error);
+}
+
+//! Large arrays are stored in a sidecar file and are loaded on first access.
+
+TEST_F(BinaryDocumentTest, mappedArrays)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "mappedArrays.mvvm");
+    SessionModel model("TestModel");
+    BinaryDocument document({&model}, /*mapping_threshold*/ 4);
+
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(3, 0.0, 3.0), FixedBinAxisItem::create(2, 0.0, 2.0));
+    const std::vector<double> expected{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    item->setContent(expected);
+
+    document.save(fileName);
+    EXPECT_TRUE(Utils::exists(fileName + ".1.data"));
+
+    model.clear();
+    document.load(fileName);
+
+    auto reco_item = model.topItem<Data2DItem>();
+    auto content = reco_item->content();
+    EXPECT_FALSE(content.isLoaded());
+    EXPECT_EQ(content.size(), expected.size());
+
+    // axes values are too small for the sidecar file
+    EXPECT_EQ(reco_item->xAxis()->binCenters(), std::vector<double>({0.5, 1.5, 2.5}));
+
+    // saving document again while the content is still mapped, content isn't loaded by the save
+    document.save(fileName);
+    EXPECT_FALSE(content.isLoaded());
+    EXPECT_TRUE(Utils::exists(fileName + ".2.data"));
+    EXPECT_EQ(content.values(), expected);
+
+    // after reload, sidecar file of the new generation holds the same data
+    document.load(fileName);
+    EXPECT_FALSE(model.topItem<Data2DItem>()->content().isLoaded());
+    EXPECT_EQ(model.topItem<Data2DItem>()->content(), expected);
+}
+
+//! Every save writes the sidecar file of the new generation and removes the previous one.
+
+TEST_F(BinaryDocumentTest, mappedArraysGenerations)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "mappedArraysGenerations.mvvm");
+    SessionModel model("TestModel");
+    BinaryDocument document({&model}, /*mapping_threshold*/ 1);
+
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(1, 0.0, 1.0));
+    item->setContent(std::vector<double>{1.0, 2.0});
+    document.save(fileName);
+    document.load(fileName);
+
+    EXPECT_TRUE(Utils::exists(fileName + ".1.data"));
+
+    model.topItem<Data2DItem>()->setContent(std::vector<double>{3.0, 4.0});
+    document.save(fileName);
+    EXPECT_FALSE(Utils::exists(fileName + ".1.data"));
+    EXPECT_TRUE(Utils::exists(fileName + ".2.data"));
+
+    // unrelated files next to the document are kept
+    const auto other = fileName + ".backup.data";
+    {
+        QFile file(QString::fromStdString(other));
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    }
+    document.save(fileName);
+    EXPECT_TRUE(Utils::exists(other));
+    EXPECT_TRUE(Utils::exists(fileName + ".3.data"));
+
+    model.clear();
+    document.load(fileName);
+    EXPECT_EQ(model.topItem<Data2DItem>()->content(), std::vector<double>({3.0, 4.0}));
+}
+
+//! Lazy arrays coexist with undo/redo.
+
+TEST_F(BinaryDocumentTest, mappedArraysUndoRedo)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "mappedArraysUndoRedo.mvvm");
+    SessionModel model("TestModel");
+    BinaryDocument document({&model}, /*mapping_threshold*/ 1);
+
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(1, 0.0, 1.0));
+    item->setContent(std::vector<double>{1.0, 2.0});
+    document.save(fileName);
+    document.load(fileName);
+    model.setUndoRedoEnabled(true);
+
+    auto reco_item = model.topItem<Data2DItem>();
+    reco_item->setContent(std::vector<double>{3.0, 4.0});
+    EXPECT_EQ(reco_item->content(), std::vector<double>({3.0, 4.0}));
+
+    // undo brings back the mapped array, which is still not loaded
+    model.undoStack()->undo();
+    EXPECT_FALSE(reco_item->content().isLoaded());
+    EXPECT_EQ(reco_item->content(), std::vector<double>({1.0, 2.0}));
+
+    model.undoStack()->redo();
+    EXPECT_EQ(reco_item->content(), std::vector<double>({3.0, 4.0}));
+}
+
+//! Small arrays don't produce sidecar file, stale sidecar file is removed.
+
+TEST_F(BinaryDocumentTest, noMappedArrays)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "noMappedArrays.mvvm");
+    SessionModel model("TestModel");
+    auto item = model.insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(1, 0.0, 1.0));
+    item->setContent(std::vector<double>{1.0, 2.0});
+
+    BinaryDocument(std::vector<SessionModel*>{&model}, 1).save(fileName);
+    EXPECT_TRUE(Utils::exists(fileName + ".1.data"));
+
+    BinaryDocument document({&model});
+    document.save(fileName);
+    EXPECT_FALSE(Utils::exists(fileName + ".1.data"));
+    EXPECT_FALSE(Utils::exists(fileName + ".2.data"));
+
+    document.load(fileName);
+    EXPECT_TRUE(model.topItem<Data2DItem>()->content().isLoaded());
+    EXPECT_EQ(model.topItem<Data2DItem>()->content(), std::vector<double>({1.0, 2.0}));
+}
@@ -13,6 +13,7 @@
 #include "mockwidgets.h"
 #include "mvvm/model/sessionitem.h"
 #include <memory>
+#include <vector>
 
 using namespace ModelView;
 using ::testing::_;
@@ -103,3 +104,104 @@ TEST_F(CallbackContainerTest, twoParameters)
     // perform action
     signal(item.get(), expected_role);
 }
+
+//! Disconnection of the callback by the handle.
+
+TEST_F(CallbackContainerTest, disconnect)
+{
+    Signal<Callbacks::item_int_t> signal;
+    std::vector<int> calls;
+    const int client{0};
+
+    auto connection1 = signal.connect([&](SessionItem*, int) { calls.push_back(1); }, &client);
+    auto connection2 = signal.connect([&](SessionItem*, int) { calls.push_back(2); }, &client);
+    signal.connect([&](SessionItem*, int) { calls.push_back(3); }, &client);
+    EXPECT_EQ(signal.size(), 3u);
+
+    signal.disconnect(connection2);
+    EXPECT_EQ(signal.size(), 2u);
+    signal(nullptr, 0);
+    EXPECT_EQ(calls, std::vector<int>({1, 3}));
+
+    // handle of disconnected callback doesn't refer to the new connection
+    signal.disconnect(connection2);
+    signal.connect([&](SessionItem*, int) { calls.push_back(4); }, &client);
+    signal.disconnect(connection2);
+    calls.clear();
+    signal(nullptr, 0);
+    EXPECT_EQ(calls, std::vector<int>({1, 3, 4}));
+
+    // removing the client disconnects all its callbacks
+    signal.disconnect(connection1);
+    signal.remove_client(&client);
+    EXPECT_TRUE(signal.empty());
+    calls.clear();
+    signal(nullptr, 0);
+    EXPECT_TRUE(calls.empty());
+}
+
+//! Callbacks disconnect and connect during the notification.
+
+TEST_F(CallbackContainerTest, reentrancy)
+{
+    Signal<Callbacks::item_int_t> signal;
+    std::vector<int> calls;
+    const int client1{0}, client2{0}, client3{0};
+
+    signal.connect(
+        [&](SessionItem*, int) {
+            calls.push_back(1);
+            signal.remove_client(&client1);
+            signal.remove_client(&client2);
+            signal.connect([&](SessionItem*, int) { calls.push_back(4); }, &client3);
+        },
+        &client1);
+    signal.connect([&](SessionItem*, int) { calls.push_back(2); }, &client2);
+    signal.connect([&](SessionItem*, int) { calls.push_back(3); }, &client3);
+
+    signal(nullptr, 0);
+    EXPECT_EQ(calls, std::vector<int>({1, 3}));
+
+    calls.clear();
+    signal(nullptr, 0);
+    EXPECT_EQ(calls, std::vector<int>({3, 4}));
+}
+
+//! Arguments are passed to callbacks without copying.
+
+TEST_F(CallbackContainerTest, argumentForwarding)
+{
+    struct Argument {
+        int* copies{nullptr};
+        Argument(int* copies) : copies(copies) {}
+        Argument(const Argument& other) : copies(other.copies) { ++*copies; }
+    };
+
+    int copies{0};
+    SignalBase<std::function<void(const Argument&)>, Callbacks::slot_t> signal;
+    signal.connect([](const Argument&) {}, nullptr);
+    signal.connect([](const Argument&) {}, nullptr);
+
+    Argument argument(&copies);
+    signal(argument);
+    EXPECT_EQ(copies, 0);
+}
+
+//! Callback disconnected during the notification is destroyed right after it, even if the
+//! storage isn't compacted.
+
+TEST_F(CallbackContainerTest, releaseOnEmission)
+{
+    Signal<Callbacks::item_int_t> signal;
+    const int client1{0}, client2{0}, client3{0};
+    auto state = std::make_shared<int>(42);
+
+    signal.connect([&](SessionItem*, int) { signal.remove_client(&client2); }, &client1);
+    signal.connect([state](SessionItem*, int) {}, &client2);
+    signal.connect([](SessionItem*, int) {}, &client3);
+    EXPECT_EQ(state.use_count(), 2);
+
+    signal(nullptr, 0);
+    EXPECT_EQ(signal.size(), 2u);
+    EXPECT_EQ(state.use_count(), 1);
+}
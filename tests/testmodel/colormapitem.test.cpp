@@ -59,7 +59,7 @@ TEST_F(ColorMapItemTest, onSetDataItem)
     MockWidgetForItem widget(colormap_item);
 
     EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
-    EXPECT_CALL(widget, onPropertyChange(colormap_item, ColorMapItem::P_LINK)).Times(1);
+    EXPECT_CALL(widget, onPropertyChange(colormap_item, ColorMapItem::P_LINK.name())).Times(1);
     EXPECT_CALL(widget, onChildPropertyChange(_, _)).Times(0);
     EXPECT_CALL(widget, onItemInserted(_, _)).Times(0);
     EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
@@ -0,0 +1,65 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/compactidentifier.h"
+
+#include "google_test.h"
+#include "mvvm/core/uniqueidgenerator.h"
+
+using namespace ModelView;
+
+//! Tests of CompactIdentifier.
+
+class CompactIdentifierTest : public ::testing::Test {
+};
+
+TEST_F(CompactIdentifierTest, initialState)
+{
+    CompactIdentifier id;
+    EXPECT_EQ(id.high(), 0u);
+    EXPECT_EQ(id.low(), 0u);
+    EXPECT_EQ(id.toString(), "{00000000-0000-0000-0000-000000000000}");
+}
+
+TEST_F(CompactIdentifierTest, fromString)
+{
+    const identifier_type str("{1b4e28ba-2fa1-11d2-883f-0016d3cca427}");
+    auto id = CompactIdentifier::fromString(str);
+    ASSERT_TRUE(id.has_value());
+    EXPECT_EQ(id->high(), 0x1b4e28ba2fa111d2u);
+    EXPECT_EQ(id->low(), 0x883f0016d3cca427u);
+    EXPECT_EQ(id->toString(), str);
+
+    // strings of other form can't be converted
+    EXPECT_FALSE(CompactIdentifier::fromString("").has_value());
+    EXPECT_FALSE(CompactIdentifier::fromString("abc-cde-fgh").has_value());
+    EXPECT_FALSE(CompactIdentifier::fromString("1b4e28ba-2fa1-11d2-883f-0016d3cca427").has_value());
+    EXPECT_FALSE(
+        CompactIdentifier::fromString("{1B4E28BA-2FA1-11D2-883F-0016D3CCA427}").has_value());
+    EXPECT_FALSE(
+        CompactIdentifier::fromString("{1b4e28ba+2fa1-11d2-883f-0016d3cca427}").has_value());
+}
+
+TEST_F(CompactIdentifierTest, generatedIdentifiers)
+{
+    for (int i = 0; i < 100; ++i) {
+        auto str = UniqueIdGenerator::generate();
+        auto id = CompactIdentifier::fromString(str);
+        ASSERT_TRUE(id.has_value());
+        EXPECT_EQ(id->toString(), str);
+    }
+}
+
+TEST_F(CompactIdentifierTest, comparison)
+{
+    EXPECT_EQ(CompactIdentifier(1, 2), CompactIdentifier(1, 2));
+    EXPECT_NE(CompactIdentifier(1, 2), CompactIdentifier(2, 1));
+    EXPECT_NE(CompactIdentifier::Hash()(CompactIdentifier(1, 2)),
+              CompactIdentifier::Hash()(CompactIdentifier(1, 3)));
+}
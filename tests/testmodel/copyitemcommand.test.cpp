@@ -48,10 +48,18 @@ TEST_F(CopyItemCommandTest, copyChild)
     EXPECT_EQ(copy->data<double>(), 43.0);
 
     // undoing command
+    const auto copy_identifier = copy->identifier();
     command->undo();
     expected = {child0, child1};
     EXPECT_EQ(parent->getItems("tag1"), expected);
     EXPECT_FALSE(command->isObsolete());
+
+    // redoing command brings back the same copy
+    command->execute();
+    expected = {child0, copy, child1};
+    EXPECT_EQ(parent->getItems("tag1"), expected);
+    EXPECT_EQ(copy->identifier(), copy_identifier);
+    EXPECT_EQ(model.findItem(copy_identifier), copy);
 }
 
 //! Attempt to copy item to invalid tag
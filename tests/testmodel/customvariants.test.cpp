@@ -11,6 +11,7 @@
 
 #include "google_test.h"
 #include "mvvm/model/comboproperty.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/externalproperty.h"
 #include "mvvm/model/variant_constants.h"
 #include <QColor>
@@ -163,6 +164,24 @@ TEST_F(CustomVariantsTest, IsTheSameComboProperty)
     EXPECT_FALSE(Utils::IsTheSame(v1, v2));
 }
 
+//! Checks if DoubleArray based variant is the same. Arrays are compared by identity of their
+//! buffers.
+
+TEST_F(CustomVariantsTest, IsTheSameDoubleArray)
+{
+    const DoubleArray array1(std::vector<double>{1.0, 2.0});
+    const DoubleArray array2(std::vector<double>{1.0, 2.0});
+    const DoubleArray array3 = array1;
+
+    EXPECT_TRUE(Utils::IsTheSame(QVariant::fromValue(array1), QVariant::fromValue(array3)));
+    EXPECT_FALSE(Utils::IsTheSame(QVariant::fromValue(array1), QVariant::fromValue(array2)));
+    EXPECT_FALSE(Utils::IsTheSame(QVariant::fromValue(array1),
+                                  QVariant::fromValue(std::vector<double>{1.0, 2.0})));
+
+    // variants are still equal by value
+    EXPECT_TRUE(QVariant::fromValue(array1) == QVariant::fromValue(array2));
+}
+
 //! Test toQtVAriant function.
 
 TEST_F(CustomVariantsTest, toQtVariant)
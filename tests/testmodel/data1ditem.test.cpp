@@ -184,7 +184,7 @@ TEST_F(Data1DItemTest, checkSignalsOnBinValuesChange)
     MockWidgetForItem widget(item);
 
     EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
-    EXPECT_CALL(widget, onPropertyChange(item, Data1DItem::P_VALUES)).Times(1);
+    EXPECT_CALL(widget, onPropertyChange(item, Data1DItem::P_VALUES.name())).Times(1);
     EXPECT_CALL(widget, onChildPropertyChange(_, _)).Times(0);
     EXPECT_CALL(widget, onItemInserted(_, _)).Times(0);
     EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
@@ -192,3 +192,48 @@ TEST_F(Data1DItemTest, checkSignalsOnBinValuesChange)
     // trigger change
     item->setValues(std::vector<double>{1.0, 2.0, 3.0});
 }
+
+//! Values are stored without copying. Setting the same buffer again doesn't trigger signals.
+
+TEST_F(Data1DItemTest, sharedValues)
+{
+    SessionModel model;
+    auto item = model.insertItem<Data1DItem>();
+    item->setAxis<FixedBinAxisItem>(3, 0.0, 3.0);
+
+    const DoubleArray values(std::vector<double>{1.0, 2.0, 3.0});
+    item->setValues(values);
+    EXPECT_TRUE(item->binValues().isSharedWith(values));
+    EXPECT_EQ(item->binValues().data(), values.data());
+
+    MockWidgetForItem widget(item);
+
+    EXPECT_CALL(widget, onPropertyChange(_, _)).Times(0);
+    item->setValues(values);
+
+    // modification of returned array doesn't affect the item
+    auto modified = item->binValues();
+    modified.mutableValues()[0] = 42.0;
+    EXPECT_EQ(item->binValues(), std::vector<double>({1.0, 2.0, 3.0}));
+
+    EXPECT_CALL(widget, onPropertyChange(item, Data1DItem::P_VALUES.name())).Times(1);
+    item->setValues(modified);
+    EXPECT_EQ(item->binValues(), std::vector<double>({42.0, 2.0, 3.0}));
+}
+
+//! Values and errors can be set from braced lists, including empty one.
+
+TEST_F(Data1DItemTest, bracedValues)
+{
+    Data1DItem item;
+    item.setValues({});
+    item.setErrors({});
+    EXPECT_EQ(item.binValues().size(), 0u);
+
+    item.setAxis<FixedBinAxisItem>(2, 0.0, 2.0);
+    item.setValues({1.0, 2.0});
+    item.setErrors({0.1, 0.2});
+    EXPECT_EQ(item.binValues(), std::vector<double>({1.0, 2.0}));
+    EXPECT_EQ(item.binErrors(), std::vector<double>({0.1, 0.2}));
+    EXPECT_THROW(item.setValues({1.0}), std::runtime_error);
+}
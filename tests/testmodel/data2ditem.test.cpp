@@ -83,7 +83,7 @@ TEST_F(Data2DItemTest, checkSignalsOnAxisChange)
     MockWidgetForItem widget(item);
 
     EXPECT_CALL(widget, onDataChange(item, ItemDataRole::DATA)).Times(0);
-    EXPECT_CALL(widget, onPropertyChange(_, Data2DItem::P_VALUES)).Times(1);
+    EXPECT_CALL(widget, onPropertyChange(_, Data2DItem::P_VALUES.name())).Times(1);
     EXPECT_CALL(widget, onChildPropertyChange(_, _)).Times(0);
     EXPECT_CALL(widget, onItemInserted(item, _)).Times(2);
     EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
@@ -103,7 +103,7 @@ TEST_F(Data2DItemTest, checkSignalsOnContentChange)
     MockWidgetForItem widget(item);
 
     EXPECT_CALL(widget, onDataChange(item, ItemDataRole::DATA)).Times(0);
-    EXPECT_CALL(widget, onPropertyChange(_, Data2DItem::P_VALUES)).Times(1);
+    EXPECT_CALL(widget, onPropertyChange(_, Data2DItem::P_VALUES.name())).Times(1);
     EXPECT_CALL(widget, onChildPropertyChange(_, _)).Times(0);
     EXPECT_CALL(widget, onItemInserted(_, _)).Times(0);
     EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
@@ -0,0 +1,172 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/directitemcopystrategy.h"
+
+#include "google_test.h"
+#include "mvvm/factories/itemcataloguefactory.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/itemfactory.h"
+#include "mvvm/model/modelutils.h"
+#include "mvvm/model/propertyitem.h"
+#include "mvvm/model/sessionitemtags.h"
+#include "mvvm/standarditems/axisitems.h"
+#include "mvvm/standarditems/data1ditem.h"
+#include <stdexcept>
+
+using namespace ModelView;
+
+class DirectItemCopyStrategyTest : public ::testing::Test {
+public:
+    DirectItemCopyStrategyTest()
+        : m_factory(std::make_unique<ItemFactory>(CreateStandardItemCatalogue()))
+    {
+    }
+
+    std::unique_ptr<DirectItemCopyStrategy>
+    createCopyStrategy(ConverterMode mode = ConverterMode::copy)
+    {
+        return std::make_unique<DirectItemCopyStrategy>(m_factory.get(), mode);
+    }
+
+    std::unique_ptr<ItemFactory> m_factory;
+};
+
+TEST_F(DirectItemCopyStrategyTest, unsupportedMode)
+{
+    EXPECT_THROW(createCopyStrategy(ConverterMode::project), std::runtime_error);
+    EXPECT_THROW(createCopyStrategy(ConverterMode::none), std::runtime_error);
+}
+
+//! Copying PropertyItem.
+
+TEST_F(DirectItemCopyStrategyTest, propertyItem)
+{
+    auto strategy = createCopyStrategy();
+
+    PropertyItem item;
+    item.setData(42.0);
+
+    auto copy = strategy->createCopy(&item);
+
+    EXPECT_EQ(item.modelType(), copy->modelType());
+    EXPECT_EQ(item.data<QVariant>(), copy->data<QVariant>());
+    EXPECT_EQ(item.itemData()->roles(), copy->itemData()->roles());
+    EXPECT_FALSE(item.identifier() == copy->identifier());
+}
+
+//! Copying CompoundItem.
+
+TEST_F(DirectItemCopyStrategyTest, compoundItem)
+{
+    auto strategy = createCopyStrategy();
+
+    CompoundItem item;
+    auto property = item.addProperty("thickness", 42.0);
+
+    auto copy = strategy->createCopy(&item);
+
+    EXPECT_EQ(item.modelType(), copy->modelType());
+    EXPECT_EQ(copy->getItem("thickness")->data<double>(), property->data<double>());
+    EXPECT_FALSE(copy->getItem("thickness")->identifier() == property->identifier());
+    EXPECT_FALSE(item.identifier() == copy->identifier());
+}
+
+//! Copying item with tags registered after the construction.
+
+TEST_F(DirectItemCopyStrategyTest, customItem)
+{
+    auto strategy = createCopyStrategy();
+
+    const std::string model_type(Constants::BaseType);
+
+    // creating parent with one child
+    auto parent = std::make_unique<SessionItem>(model_type);
+    parent->setDisplayName("parent_name");
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto child = parent->insertItem(std::make_unique<SessionItem>(model_type), TagRow::append());
+    child->setDisplayName("child_name");
+
+    // creating copy
+    auto parent_copy = strategy->createCopy(parent.get());
+
+    EXPECT_EQ(parent_copy->childrenCount(), 1);
+    EXPECT_EQ(parent_copy->modelType(), model_type);
+    EXPECT_EQ(parent_copy->displayName(), "parent_name");
+    EXPECT_EQ(parent_copy->itemTags()->defaultTag(), "defaultTag");
+    EXPECT_EQ(parent_copy->model(), nullptr);
+    EXPECT_FALSE(parent_copy->identifier() == parent->identifier());
+
+    // checking child reconstruction
+    auto child_copy = parent_copy->getItem("defaultTag");
+    EXPECT_EQ(child_copy->parent(), parent_copy.get());
+    EXPECT_EQ(child_copy->childrenCount(), 0);
+    EXPECT_EQ(child_copy->modelType(), model_type);
+    EXPECT_EQ(child_copy->displayName(), "child_name");
+    EXPECT_EQ(child_copy->itemTags()->defaultTag(), "");
+    EXPECT_FALSE(child_copy->identifier() == child->identifier());
+}
+
+//! Clone preserves identifiers of all items.
+
+TEST_F(DirectItemCopyStrategyTest, clone)
+{
+    auto strategy = createCopyStrategy(ConverterMode::clone);
+
+    CompoundItem item;
+    auto property = item.addProperty("thickness", 42.0);
+
+    auto clone = strategy->createCopy(&item);
+
+    EXPECT_EQ(clone->identifier(), item.identifier());
+    EXPECT_EQ(clone->getItem("thickness")->identifier(), property->identifier());
+    EXPECT_EQ(clone->getItem("thickness")->data<double>(), 42.0);
+}
+
+//! Array of values is shared between the item and its copy, until one of them is changed.
+
+TEST_F(DirectItemCopyStrategyTest, sharedValues)
+{
+    auto strategy = createCopyStrategy();
+
+    Data1DItem item;
+    item.setAxis<FixedBinAxisItem>(3, 0.0, 3.0);
+    item.setValues(std::vector<double>{1.0, 2.0, 3.0});
+
+    auto copy = strategy->createCopy(&item);
+    auto data_copy = dynamic_cast<Data1DItem*>(copy.get());
+    ASSERT_TRUE(data_copy != nullptr);
+
+    EXPECT_EQ(data_copy->binValues(), item.binValues());
+    EXPECT_TRUE(data_copy->binValues().isSharedWith(item.binValues()));
+    EXPECT_EQ(data_copy->binCenters(), item.binCenters());
+
+    data_copy->setValues(std::vector<double>{4.0, 5.0, 6.0});
+    EXPECT_EQ(item.binValues(), std::vector<double>({1.0, 2.0, 3.0}));
+}
+
+//! Copy and clone of the whole model.
+
+TEST_F(DirectItemCopyStrategyTest, modelCopy)
+{
+    SessionModel model;
+    auto item = model.insertItem<CompoundItem>();
+    item->addProperty("thickness", 42.0);
+
+    auto copy = Utils::CreateCopy(model);
+    auto item_copy = copy->topItem<CompoundItem>();
+    EXPECT_EQ(item_copy->property<double>("thickness"), 42.0);
+    EXPECT_FALSE(item_copy->identifier() == item->identifier());
+    EXPECT_EQ(copy->findItem(item_copy->identifier()), item_copy);
+
+    auto clone = Utils::CreateClone(model);
+    auto item_clone = clone->topItem<CompoundItem>();
+    EXPECT_EQ(item_clone->identifier(), item->identifier());
+    EXPECT_EQ(clone->findItem(item->identifier()), item_clone);
+}
@@ -0,0 +1,158 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/doublearray.h"
+
+#include "google_test.h"
+#include <numeric>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Testing DoubleArray class.
+
+class DoubleArrayTest : public ::testing::Test {
+};
+
+TEST_F(DoubleArrayTest, initialState)
+{
+    DoubleArray array;
+    EXPECT_EQ(array.size(), 0u);
+    EXPECT_TRUE(array.empty());
+    EXPECT_EQ(array.values(), std::vector<double>());
+    EXPECT_EQ(array, std::vector<double>());
+
+    // all empty arrays are considered as the same
+    EXPECT_TRUE(array.isSharedWith(DoubleArray()));
+}
+
+TEST_F(DoubleArrayTest, constructFromVector)
+{
+    const std::vector<double> expected{1.0, 2.0, 3.0};
+    DoubleArray array(expected);
+
+    EXPECT_EQ(array.size(), 3u);
+    EXPECT_FALSE(array.empty());
+    EXPECT_EQ(array.values(), expected);
+    EXPECT_EQ(array[1], 2.0);
+    EXPECT_EQ(array.data()[2], 3.0);
+    EXPECT_EQ(std::accumulate(array.begin(), array.end(), 0.0), 6.0);
+
+    const std::vector<double>& converted = array;
+    EXPECT_EQ(converted.data(), array.data());
+}
+
+//! Copies share the same buffer, modification detaches it.
+
+TEST_F(DoubleArrayTest, copyOnWrite)
+{
+    DoubleArray array1(std::vector<double>{1.0, 2.0, 3.0});
+    DoubleArray array2 = array1;
+
+    EXPECT_TRUE(array1.isSharedWith(array2));
+    EXPECT_EQ(array1.data(), array2.data());
+    EXPECT_EQ(array1, array2);
+
+    array2.mutableValues()[0] = 42.0;
+    EXPECT_FALSE(array1.isSharedWith(array2));
+    EXPECT_EQ(array1.values(), std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_EQ(array2.values(), std::vector<double>({42.0, 2.0, 3.0}));
+
+    // buffer is not shared anymore, no detaching is necessary
+    auto data = array2.data();
+    array2.mutableValues()[1] = 43.0;
+    EXPECT_EQ(array2.data(), data);
+}
+
+//! Arrays with different buffers are compared by value.
+
+TEST_F(DoubleArrayTest, comparison)
+{
+    DoubleArray array1(std::vector<double>{1.0, 2.0});
+    DoubleArray array2(std::vector<double>{1.0, 2.0});
+    DoubleArray array3(std::vector<double>{1.0, 3.0});
+
+    EXPECT_FALSE(array1.isSharedWith(array2));
+    EXPECT_TRUE(array1 == array2);
+    EXPECT_FALSE(array1 != array2);
+    EXPECT_FALSE(array1 == array3);
+    EXPECT_TRUE(array1 < array3);
+    EXPECT_FALSE(array3 < array1);
+    EXPECT_FALSE(array1 < array1);
+}
+
+TEST_F(DoubleArrayTest, variantEquality)
+{
+    DoubleArray array1(std::vector<double>{1.0, 2.0});
+    DoubleArray array2(std::vector<double>{1.0, 2.0});
+    DoubleArray array3(std::vector<double>{1.0, 3.0});
+
+    EXPECT_TRUE(QVariant::fromValue(array1) == QVariant::fromValue(array2));
+    EXPECT_FALSE(QVariant::fromValue(array1) == QVariant::fromValue(array3));
+
+    // variant keeps the buffer shared
+    auto variant = QVariant::fromValue(array1);
+    EXPECT_TRUE(variant.value<DoubleArray>().isSharedWith(array1));
+}
+
+//! Lazy array gets its content from the loader on first access.
+
+TEST_F(DoubleArrayTest, lazyArray)
+{
+    int load_count{0};
+    auto loader = [&load_count]() {
+        ++load_count;
+        return std::vector<double>{1.0, 2.0, 3.0};
+    };
+    auto array = DoubleArray::createLazy(3, loader);
+
+    // size is known without loading, copies share the same lazy buffer
+    EXPECT_FALSE(array.isLoaded());
+    EXPECT_EQ(array.size(), 3u);
+    EXPECT_FALSE(array.empty());
+    auto copy = array;
+    EXPECT_TRUE(copy.isSharedWith(array));
+    EXPECT_EQ(load_count, 0);
+
+    // first access loads the content for all copies
+    EXPECT_EQ(copy[1], 2.0);
+    EXPECT_TRUE(array.isLoaded());
+    EXPECT_EQ(array.values(), std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_EQ(load_count, 1);
+
+    // arrays of different size are compared without loading
+    auto other = DoubleArray::createLazy(2, loader);
+    EXPECT_FALSE(other == array);
+    EXPECT_FALSE(other.isLoaded());
+
+    EXPECT_THROW(DoubleArray::createLazy(1, {}), std::runtime_error);
+}
+
+//! Copy of values of lazy array doesn't load the array itself.
+
+TEST_F(DoubleArrayTest, copyValuesOfLazyArray)
+{
+    int load_count{0};
+    auto loader = [&load_count]() {
+        ++load_count;
+        return std::vector<double>{1.0, 2.0};
+    };
+    auto array = DoubleArray::createLazy(2, loader);
+
+    EXPECT_EQ(array.copyValues(), std::vector<double>({1.0, 2.0}));
+    EXPECT_FALSE(array.isLoaded());
+    EXPECT_EQ(load_count, 1);
+
+    // loaded array is copied from memory
+    EXPECT_EQ(array.values(), std::vector<double>({1.0, 2.0}));
+    EXPECT_EQ(array.copyValues(), std::vector<double>({1.0, 2.0}));
+    EXPECT_EQ(load_count, 2);
+
+    EXPECT_EQ(DoubleArray(std::vector<double>{3.0}).copyValues(), std::vector<double>({3.0}));
+}
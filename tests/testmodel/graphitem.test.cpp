@@ -67,6 +67,9 @@ TEST_F(GraphItemTest, binValues)
 
     EXPECT_EQ(graph_item->binValues(), expected_values);
     EXPECT_EQ(graph_item->binCenters(), expected_centers);
+
+    // values are shared with data item
+    EXPECT_TRUE(graph_item->binValues().isSharedWith(data_item->binValues()));
 }
 
 //! Setting dataItem with errors
@@ -127,7 +130,7 @@ TEST_F(GraphItemTest, onSetDataItem)
     MockWidgetForItem widget(graph_item);
 
     EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
-    EXPECT_CALL(widget, onPropertyChange(graph_item, GraphItem::P_LINK)).Times(1);
+    EXPECT_CALL(widget, onPropertyChange(graph_item, GraphItem::P_LINK.name())).Times(1);
     EXPECT_CALL(widget, onChildPropertyChange(_, _)).Times(0);
     EXPECT_CALL(widget, onItemInserted(_, _)).Times(0);
     EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
@@ -109,7 +109,7 @@ TEST_F(GraphViewportItemTest, onSetDataItem)
 
     EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
     EXPECT_CALL(widget, onPropertyChange(_, _)).Times(0);
-    EXPECT_CALL(widget, onChildPropertyChange(graph_item, GraphItem::P_LINK)).Times(1);
+    EXPECT_CALL(widget, onChildPropertyChange(graph_item, GraphItem::P_LINK.name())).Times(1);
     EXPECT_CALL(widget, onItemInserted(_, _)).Times(0);
     EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
 
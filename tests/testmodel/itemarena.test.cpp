@@ -0,0 +1,269 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "google_test.h"
+#include "mvvm/factories/modelconverterfactory.h"
+#include "mvvm/interfaces/undostackinterface.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/itemarena.h"
+#include "mvvm/model/propertyitem.h"
+#include "mvvm/model/sessionitemdata.h"
+#include "mvvm/model/sessionmodel.h"
+#include <QJsonObject>
+#include <thread>
+
+using namespace ModelView;
+
+//! Testing ItemArena and its usage by SessionModel.
+
+class ItemArenaTest : public ::testing::Test {
+};
+
+TEST_F(ItemArenaTest, initialState)
+{
+    ItemArena arena;
+    EXPECT_EQ(arena.blockCount(), 0u);
+    EXPECT_EQ(arena.reservedSize(), 0u);
+    EXPECT_EQ(ItemArena::current(), nullptr);
+}
+
+TEST_F(ItemArenaTest, heapAllocation)
+{
+    auto item = std::make_unique<SessionItem>();
+    EXPECT_EQ(ItemArena::owner(item.get()), nullptr);
+    EXPECT_EQ(ItemArena::owner(item->itemData()), nullptr);
+    EXPECT_EQ(ItemArena::owner(nullptr), nullptr);
+}
+
+TEST_F(ItemArenaTest, scope)
+{
+    ItemArena arena1;
+    ItemArena arena2;
+    {
+        ItemArena::Scope scope1(&arena1);
+        EXPECT_EQ(ItemArena::current(), &arena1);
+        {
+            ItemArena::Scope scope2(&arena2);
+            EXPECT_EQ(ItemArena::current(), &arena2);
+            {
+                ItemArena::Scope scope3(nullptr);
+                EXPECT_EQ(ItemArena::current(), nullptr);
+            }
+            EXPECT_EQ(ItemArena::current(), &arena2);
+        }
+        EXPECT_EQ(ItemArena::current(), &arena1);
+    }
+    EXPECT_EQ(ItemArena::current(), nullptr);
+}
+
+//! Item and its internal blocks are allocated in the arena. Released blocks are reused.
+
+TEST_F(ItemArenaTest, itemAllocation)
+{
+    ItemArena arena;
+
+    std::unique_ptr<SessionItem> item;
+    {
+        ItemArena::Scope scope(&arena);
+        item = std::make_unique<SessionItem>();
+    }
+    EXPECT_EQ(ItemArena::owner(item.get()), &arena);
+    EXPECT_EQ(ItemArena::owner(item->itemData()), &arena);
+    EXPECT_EQ(ItemArena::owner(item->itemTags()), &arena);
+
+    // item, its implementation, data and tags
+    const auto block_count = arena.blockCount();
+    EXPECT_EQ(block_count, 4u);
+    EXPECT_EQ(arena.reservedSize(), ItemArena::default_chunk_size);
+
+    // identifier is generated later, but data still goes to the same arena
+    item->identifier();
+    EXPECT_EQ(ItemArena::owner(item->itemData()), &arena);
+    EXPECT_EQ(arena.blockCount(), block_count);
+
+    item.reset();
+    EXPECT_EQ(arena.blockCount(), 0u);
+
+    // memory is reused
+    {
+        ItemArena::Scope scope(&arena);
+        item = std::make_unique<SessionItem>();
+    }
+    EXPECT_EQ(arena.blockCount(), block_count);
+    EXPECT_EQ(arena.reservedSize(), ItemArena::default_chunk_size);
+    item.reset();
+}
+
+//! Arena owned by shared_ptr lives until its last block is released.
+
+TEST_F(ItemArenaTest, lifetime)
+{
+    auto arena = std::make_shared<ItemArena>();
+    std::weak_ptr<ItemArena> weak_arena = arena;
+
+    std::unique_ptr<SessionItem> item;
+    {
+        ItemArena::Scope scope(arena.get());
+        item = std::make_unique<PropertyItem>();
+    }
+
+    arena.reset();
+    EXPECT_FALSE(weak_arena.expired());
+
+    item->setData(42.0);
+    EXPECT_EQ(item->data<double>(), 42.0);
+
+    item.reset();
+    EXPECT_TRUE(weak_arena.expired());
+}
+
+//! Blocks can be released from another thread.
+
+TEST_F(ItemArenaTest, releaseFromAnotherThread)
+{
+    ItemArena arena;
+    std::vector<std::unique_ptr<SessionItem>> items;
+    {
+        ItemArena::Scope scope(&arena);
+        for (int i = 0; i < 100; ++i)
+            items.emplace_back(std::make_unique<SessionItem>());
+    }
+    EXPECT_EQ(arena.blockCount(), 400u);
+
+    std::thread thread([&items]() { items.clear(); });
+    thread.join();
+    EXPECT_EQ(arena.blockCount(), 0u);
+}
+
+TEST_F(ItemArenaTest, modelInitialState)
+{
+    SessionModel model;
+    EXPECT_EQ(model.itemArena(), nullptr);
+
+    auto item = model.insertItem<PropertyItem>();
+    EXPECT_EQ(ItemArena::owner(item), nullptr);
+}
+
+//! Items inserted in the model with enabled arena.
+
+TEST_F(ItemArenaTest, modelInsertItems)
+{
+    SessionModel model;
+    model.setItemArenaEnabled(true);
+    auto arena = model.itemArena();
+    ASSERT_NE(arena, nullptr);
+
+    // enabling it again doesn't change the arena
+    model.setItemArenaEnabled(true);
+    EXPECT_EQ(model.itemArena(), arena);
+
+    auto item0 = model.insertItem<CompoundItem>();
+    auto property = item0->addProperty("height", 42.0);
+    auto item1 = model.insertNewItem(Constants::PropertyType);
+    auto items = model.insertItems<PropertyItem>(model.rootItem(), {}, 2);
+
+    EXPECT_EQ(ItemArena::owner(item0), arena);
+    EXPECT_EQ(ItemArena::owner(property), arena);
+    EXPECT_EQ(ItemArena::owner(item1), arena);
+    EXPECT_EQ(ItemArena::owner(items.at(0)), arena);
+    EXPECT_EQ(ItemArena::owner(items.at(1)), arena);
+    EXPECT_EQ(property->data<double>(), 42.0);
+
+    // disabling the arena, new items go to the heap
+    model.setItemArenaEnabled(false);
+    EXPECT_EQ(model.itemArena(), nullptr);
+    auto item2 = model.insertItem<PropertyItem>();
+    EXPECT_EQ(ItemArena::owner(item2), nullptr);
+
+    // items created before are still there
+    EXPECT_EQ(property->data<double>(), 42.0);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 5);
+}
+
+//! Items which are recreated by undo/redo and copy go to the arena.
+
+TEST_F(ItemArenaTest, modelUndoRedoAndCopy)
+{
+    SessionModel model;
+    model.setItemArenaEnabled(true);
+    model.setUndoRedoEnabled(true);
+    auto arena = model.itemArena();
+
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(42.0);
+    const auto id = item->identifier();
+
+    model.undoStack()->undo();
+    model.undoStack()->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    model.undoStack()->redo();
+    item = dynamic_cast<PropertyItem*>(model.findItem(id));
+    ASSERT_NE(item, nullptr);
+    EXPECT_EQ(ItemArena::owner(item), arena);
+
+    model.removeItem(model.rootItem(), {"", 0});
+    model.undoStack()->undo();
+    EXPECT_EQ(ItemArena::owner(model.findItem(id)), arena);
+
+    auto copy = model.copyItem(model.findItem(id), model.rootItem());
+    EXPECT_EQ(ItemArena::owner(copy), arena);
+}
+
+//! Clearing the model releases the whole arena at once. New content goes to a new arena.
+
+TEST_F(ItemArenaTest, modelClear)
+{
+    SessionModel model;
+    model.setItemArenaEnabled(true);
+    for (int i = 0; i < 10; ++i)
+        model.insertItem<CompoundItem>()->addProperty("height", 42.0);
+
+    std::weak_ptr<ItemArena> weak_arena = model.itemArena()->shared_from_this();
+    EXPECT_FALSE(weak_arena.expired());
+
+    model.clear();
+    EXPECT_TRUE(weak_arena.expired());
+    ASSERT_NE(model.itemArena(), nullptr);
+    EXPECT_EQ(ItemArena::owner(model.rootItem()), model.itemArena());
+}
+
+//! Items restored from JSON go to the arena.
+
+TEST_F(ItemArenaTest, modelLoadFromJson)
+{
+    SessionModel model("TestModel");
+    auto property = model.insertItem<PropertyItem>();
+    property->setData(42.0);
+
+    auto converter = CreateModelProjectConverter();
+    auto json = converter->to_json(model);
+
+    model.setItemArenaEnabled(true);
+    converter->from_json(json, model);
+
+    auto item = model.topItem<PropertyItem>();
+    EXPECT_EQ(ItemArena::owner(item), model.itemArena());
+    EXPECT_EQ(ItemArena::owner(item->itemData()), model.itemArena());
+    EXPECT_EQ(item->data<double>(), 42.0);
+}
+
+//! Items taken from the model outlive model's arena.
+
+TEST_F(ItemArenaTest, itemOutlivesModel)
+{
+    std::unique_ptr<SessionItem> item;
+    {
+        SessionModel model;
+        model.setItemArenaEnabled(true);
+        model.insertItem<PropertyItem>()->setData(42.0);
+        item = model.rootItem()->takeItem({"", 0});
+    }
+    EXPECT_EQ(item->data<double>(), 42.0);
+    item.reset();
+}
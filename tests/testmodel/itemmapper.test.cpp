@@ -244,3 +244,76 @@ TEST(ItemMapperTest, onAboutToRemoveItem)
     // perform action
     model.removeItem(compound1, expected_tagrow);
 }
+
+//! Mapper of the root item is notified about insertion and removal of its children, but not about
+//! their data change.
+
+TEST(ItemMapperTest, rootItemChildren)
+{
+    SessionModel model;
+    auto root = model.rootItem();
+
+    MockWidgetForItem widget(root);
+
+    EXPECT_CALL(widget, onItemDestroy(_)).Times(0);
+    EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(widget, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget, onChildPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget, onItemInserted(root, _)).Times(1);
+    EXPECT_CALL(widget, onItemRemoved(root, _)).Times(1);
+    EXPECT_CALL(widget, onAboutToRemoveItem(root, _)).Times(1);
+
+    // perform actions
+    auto item = model.insertItem<SessionItem>(root);
+    item->setData(42.0);
+    model.removeItem(root, root->tagRowOfItem(item));
+}
+
+//! Mappers of unrelated items are not notified about data change.
+
+TEST(ItemMapperTest, onDataChangeOfUnrelatedItem)
+{
+    SessionModel model;
+    auto compound1 = model.insertItem<CompoundItem>();
+    auto property1 = compound1->addProperty("height", 42.0);
+    auto compound2 = model.insertItem<CompoundItem>();
+    compound2->addProperty("height", 42.0);
+
+    MockWidgetForItem widget1(compound1);
+    MockWidgetForItem widget2(compound2);
+    MockWidgetForItem widget3(property1);
+
+    EXPECT_CALL(widget1, onPropertyChange(compound1, "height")).Times(1);
+    EXPECT_CALL(widget2, onPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget3, onDataChange(property1, ItemDataRole::DATA)).Times(1);
+
+    // perform action
+    compound1->setProperty("height", 43.0);
+}
+
+//! Mapper of the item moved to another parent follows the item.
+
+TEST(ItemMapperTest, moveItem)
+{
+    SessionModel model;
+    auto compound1 = model.insertItem<CompoundItem>();
+    compound1->registerTag(TagInfo::universalTag("tag1"), /*set_as_default*/ true);
+    auto compound2 = model.insertItem<CompoundItem>();
+    compound2->registerTag(TagInfo::universalTag("tag2"), /*set_as_default*/ true);
+    auto item = model.insertItem<CompoundItem>(compound1);
+    item->addProperty("height", 42.0);
+
+    MockWidgetForItem widget(item);
+    MockWidgetForItem widget1(compound1);
+    MockWidgetForItem widget2(compound2);
+
+    model.moveItem(item, compound2, {"tag2", 0});
+    EXPECT_EQ(item->parent(), compound2);
+
+    EXPECT_CALL(widget, onPropertyChange(item, "height")).Times(1);
+    EXPECT_CALL(widget1, onChildPropertyChange(_, _)).Times(0);
+    EXPECT_CALL(widget2, onChildPropertyChange(item, "height")).Times(1);
+
+    // perform action
+    item->setProperty("height", 43.0);
+}
@@ -105,3 +105,35 @@ TEST_F(ItemPoolTest, customKey)
 
     delete item;
 }
+
+//! Mixing generated identifiers with custom keys.
+
+TEST_F(ItemPoolTest, generatedAndCustomKeys)
+{
+    ItemPool pool;
+    SessionItem item1, item2, item3;
+
+    auto key1 = pool.register_item(&item1);
+    auto key2 = pool.register_item(&item2, "custom-key");
+    auto key3 = pool.register_item(&item3, item3.identifier());
+    EXPECT_EQ(key2, "custom-key");
+    EXPECT_EQ(key3, item3.identifier());
+    EXPECT_EQ(pool.size(), 3u);
+
+    EXPECT_EQ(pool.item_for_key(key1), &item1);
+    EXPECT_EQ(pool.item_for_key(key2), &item2);
+    EXPECT_EQ(pool.item_for_key(key3), &item3);
+    EXPECT_EQ(pool.key_for_item(&item1), key1);
+    EXPECT_EQ(pool.key_for_item(&item2), key2);
+    EXPECT_EQ(pool.key_for_item(&item3), key3);
+
+    EXPECT_THROW(pool.register_item(&item1, "another-key"), std::runtime_error);
+
+    pool.unregister_item(&item2);
+    pool.unregister_item(&item3);
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(pool.item_for_key(key2), nullptr);
+    EXPECT_EQ(pool.item_for_key(key3), nullptr);
+    EXPECT_EQ(pool.key_for_item(&item3), identifier_type());
+    EXPECT_EQ(pool.item_for_key(key1), &item1);
+}
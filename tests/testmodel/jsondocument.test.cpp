@@ -12,11 +12,16 @@
 #include "folderbasedtest.h"
 #include "google_test.h"
 #include "test_utils.h"
+#include "mvvm/model/customvariants.h"
 #include "mvvm/model/propertyitem.h"
 #include "mvvm/model/sessionitem.h"
 #include "mvvm/model/sessionitemtags.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/model/taginfo.h"
+#include "mvvm/standarditems/axisitems.h"
+#include "mvvm/standarditems/data1ditem.h"
+#include "mvvm/standarditems/data2ditem.h"
+#include <QFile>
 #include <stdexcept>
 
 using namespace ModelView;
@@ -164,3 +169,42 @@ TEST_F(JsonDocumentTest, loadModelsInWrongOrder)
     // loading model from file
     EXPECT_THROW(document.load(fileName), std::runtime_error);
 }
+
+//! Values of Data1DItem and Data2DItem are saved as std::vector<double>, as before arrays were
+//! stored as DoubleArray, so the document remains readable by older versions.
+
+TEST_F(JsonDocumentTest, loadLegacyArrays)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "loadLegacyArrays.json");
+    SessionModel model("TestModel");
+    auto data1d = model.insertItem<Data1DItem>();
+    data1d->setAxis<FixedBinAxisItem>(3, 0.0, 3.0);
+    data1d->setValues(std::vector<double>{1.0, 2.0, 3.0});
+    auto data2d = model.insertItem<Data2DItem>();
+    data2d->setAxes(FixedBinAxisItem::create(2, 0.0, 2.0), FixedBinAxisItem::create(1, 0.0, 1.0));
+    data2d->setContent(std::vector<double>{4.0, 5.0});
+
+    JsonDocument document({&model});
+    document.save(fileName);
+
+    // checking that the document is in the legacy format
+    {
+        QFile file(QString::fromStdString(fileName));
+        ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+        auto content = file.readAll();
+        EXPECT_TRUE(content.contains("std::vector<double>"));
+        EXPECT_FALSE(content.contains("ModelView::DoubleArray"));
+    }
+
+    model.clear();
+    document.load(fileName);
+
+    auto reco_data1d = model.topItem<Data1DItem>();
+    ASSERT_NE(reco_data1d, nullptr);
+    auto values_variant = reco_data1d->getItem(Data1DItem::P_VALUES)->data<QVariant>();
+    EXPECT_TRUE(Utils::IsDoubleArrayVariant(values_variant));
+    EXPECT_EQ(reco_data1d->binValues(), std::vector<double>({1.0, 2.0, 3.0}));
+    auto reco_data2d = model.topItem<Data2DItem>();
+    ASSERT_NE(reco_data2d, nullptr);
+    EXPECT_EQ(reco_data2d->content(), std::vector<double>({4.0, 5.0}));
+}
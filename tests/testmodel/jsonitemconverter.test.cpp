@@ -13,6 +13,7 @@
 #include "google_test.h"
 #include "test_utils.h"
 #include "mvvm/model/compounditem.h"
+#include "mvvm/model/identifierloadingscope.h"
 #include "mvvm/model/itemcatalogue.h"
 #include "mvvm/model/propertyitem.h"
 #include "mvvm/model/sessionitem.h"
@@ -54,9 +55,9 @@ public:
     {
     }
 
-    std::unique_ptr<JsonItemConverter> createConverter()
+    std::unique_ptr<JsonItemConverter> createConverter(ConverterMode mode = ConverterMode::clone)
     {
-        ConverterContext context{m_model->factory(), ConverterMode::clone};
+        ConverterContext context{m_model->factory(), mode};
         return std::make_unique<JsonItemConverter>(context);
     }
 
@@ -226,3 +227,53 @@ TEST_F(JsonItemConverterTest, testItemToFileAndBack)
     // tooltip was preserved after the serialization
     EXPECT_EQ(reco->getItem("Thickness")->toolTip(), "thickness");
 }
+
+//! Loading item in project mode restores identifiers from json without generating new ones.
+
+TEST_F(JsonItemConverterTest, projectModeDoesntGenerateIdentifiers)
+{
+    auto converter = createConverter(ConverterMode::project);
+
+    TestItem item;
+    auto object = converter->to_json(&item);
+
+    // items constructed by the converter get no identifiers of their own
+    IdentifierLoadingScope scope;
+    auto reco = converter->from_json(object);
+
+    EXPECT_EQ(reco->identifier(), item.identifier());
+    EXPECT_EQ(reco->getItem("Thickness")->identifier(), item.getItem("Thickness")->identifier());
+}
+
+//! Items missing in json get their identifiers generated when loading in project mode.
+
+TEST_F(JsonItemConverterTest, projectModeGeneratesMissingIdentifiers)
+{
+    auto converter = createConverter(ConverterMode::project);
+
+    TestItem item;
+    auto object = converter->to_json(&item);
+
+    // removing the identifier of the property from json
+    auto tags_object = object[JsonItemFormatAssistant::itemTagsKey].toObject();
+    auto containers = tags_object[JsonItemFormatAssistant::containerKey].toArray();
+    auto container = containers[0].toObject();
+    auto items = container[JsonItemFormatAssistant::itemsKey].toArray();
+    auto property = items[0].toObject();
+    QJsonArray property_data;
+    for (const auto& x : property[JsonItemFormatAssistant::itemDataKey].toArray())
+        if (x.toObject()[JsonItemFormatAssistant::roleKey].toInt() != ItemDataRole::IDENTIFIER)
+            property_data.append(x);
+    property[JsonItemFormatAssistant::itemDataKey] = property_data;
+    items[0] = property;
+    container[JsonItemFormatAssistant::itemsKey] = items;
+    containers[0] = container;
+    tags_object[JsonItemFormatAssistant::containerKey] = containers;
+    object[JsonItemFormatAssistant::itemTagsKey] = tags_object;
+
+    auto reco = converter->from_json(object);
+    EXPECT_EQ(reco->identifier(), item.identifier());
+    auto identifier = reco->getItem("Thickness")->identifier();
+    EXPECT_FALSE(identifier.empty());
+    EXPECT_NE(identifier, item.getItem("Thickness")->identifier());
+}
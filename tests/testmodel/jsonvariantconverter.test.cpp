@@ -14,6 +14,7 @@
 #include "test_utils.h"
 #include "mvvm/model/comboproperty.h"
 #include "mvvm/model/customvariants.h"
+#include "mvvm/model/doublearray.h"
 #include "mvvm/model/externalproperty.h"
 #include "mvvm/model/variant_constants.h"
 #include "mvvm/utils/reallimits.h"
@@ -195,6 +196,35 @@ TEST_F(JsonVariantConverterTest, vectorOfDoubleVariant)
     EXPECT_EQ(variant, reco_variant);
 }
 
+//! QVariant(DoubleArray) conversion. The array is saved as std::vector<double>, so older versions
+//! can read it. The array saved under its own type name can be read too.
+
+TEST_F(JsonVariantConverterTest, doubleArrayVariant)
+{
+    JsonVariantConverter converter;
+
+    const std::vector<double> values{42.0, 43.0, 44.0};
+    const DoubleArray value(values);
+    QVariant variant = QVariant::fromValue(value);
+
+    // from variant to json object
+    auto object = converter.get_json(variant);
+    EXPECT_TRUE(converter.isVariant(object));
+    EXPECT_EQ(object["type"].toString().toStdString(), Constants::vector_double_type_name);
+
+    // from json object to variant
+    QVariant reco_variant = converter.get_variant(object);
+    EXPECT_TRUE(Utils::IsDoubleVectorVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<std::vector<double>>(), values);
+
+    // from json object with own type name to variant
+    object["type"] = QString::fromStdString(Constants::double_array_type_name);
+    reco_variant = converter.get_variant(object);
+    EXPECT_TRUE(Utils::IsDoubleArrayVariant(reco_variant));
+    EXPECT_EQ(reco_variant.value<DoubleArray>(), value);
+    EXPECT_FALSE(reco_variant.value<DoubleArray>().isSharedWith(value));
+}
+
 //! QVariant(ComboProperty) conversion.
 
 TEST_F(JsonVariantConverterTest, comboPropertyVariant)
@@ -0,0 +1,103 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/serialization/mappedarrayreader.h"
+
+#include "folderbasedtest.h"
+#include "google_test.h"
+#include "test_utils.h"
+#include "mvvm/model/doublearray.h"
+#include "mvvm/serialization/binaryarraywriter.h"
+#include "mvvm/utils/fileutils.h"
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Tests MappedArrayReader together with BinaryArrayWriter.
+
+class MappedArrayReaderTest : public FolderBasedTest {
+public:
+    MappedArrayReaderTest() : FolderBasedTest("test_MappedArrayReader") {}
+};
+
+//! Writer accepts only arrays above the threshold and creates file on first write only.
+
+TEST_F(MappedArrayReaderTest, writer)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "writer.data");
+
+    BinaryArrayWriter writer(fileName, 3);
+    EXPECT_FALSE(writer.isAccepted(DoubleArray(std::vector<double>{1.0, 2.0})));
+    EXPECT_TRUE(writer.isAccepted(DoubleArray(std::vector<double>{1.0, 2.0, 3.0})));
+    writer.commit();
+    EXPECT_FALSE(Utils::exists(fileName));
+
+    BinaryArrayWriter disabled_writer(fileName, 0);
+    EXPECT_FALSE(disabled_writer.isAccepted(DoubleArray(std::vector<double>{1.0, 2.0, 3.0})));
+}
+
+//! Arrays are written one after another and read back lazily.
+
+TEST_F(MappedArrayReaderTest, writeAndRead)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "writeAndRead.data");
+
+    const std::vector<double> values1{1.0, 2.0, 3.0};
+    const std::vector<double> values2{4.0, 5.0, 6.0, 7.0};
+
+    BinaryArrayWriter writer(fileName, 1);
+    auto offset1 = writer.write(DoubleArray(values1));
+    auto offset2 = writer.write(DoubleArray(values2));
+    EXPECT_EQ(offset2, offset1 + values1.size() * sizeof(double));
+
+    // file appears on commit only
+    EXPECT_FALSE(Utils::exists(fileName));
+    writer.commit();
+    EXPECT_TRUE(Utils::exists(fileName));
+
+    MappedArrayReader reader(fileName);
+    auto array2 = reader.array(offset2, values2.size());
+    auto array1 = reader.array(offset1, values1.size());
+    EXPECT_FALSE(array1.isLoaded());
+    EXPECT_EQ(array1.size(), values1.size());
+    EXPECT_EQ(array1.values(), values1);
+    EXPECT_EQ(array2.values(), values2);
+
+    // array outside of the file
+    EXPECT_THROW(reader.array(offset2, values2.size() + 1), std::runtime_error);
+    EXPECT_THROW(reader.array(0, 1), std::runtime_error);
+}
+
+//! Lazy arrays remain valid after the file was overwritten.
+
+TEST_F(MappedArrayReaderTest, overwriteMappedFile)
+{
+    auto fileName = TestUtils::TestFileName(testDir(), "overwriteMappedFile.data");
+
+    const std::vector<double> values{1.0, 2.0, 3.0};
+    BinaryArrayWriter writer(fileName, 1);
+    auto offset = writer.write(DoubleArray(values));
+    writer.commit();
+
+    MappedArrayReader reader(fileName);
+    auto array = reader.array(offset, values.size());
+
+    BinaryArrayWriter writer2(fileName, 1);
+    writer2.write(DoubleArray(std::vector<double>{42.0}));
+    writer2.commit();
+
+    EXPECT_FALSE(array.isLoaded());
+    EXPECT_EQ(array.values(), values);
+}
+
+TEST_F(MappedArrayReaderTest, invalidFile)
+{
+    MappedArrayReader reader(TestUtils::TestFileName(testDir(), "nonexisting.data"));
+    EXPECT_THROW(reader.array(8, 1), std::runtime_error);
+}
@@ -220,3 +220,42 @@ TEST(ModelMapperTest, onClearRebuild)
     auto rebuild = [](auto item) { item->insertItem(TagRow::append()); };
     model->clear(rebuild);
 }
+
+//! Testing range signals on bulk insertion and removal of items.
+
+TEST(ModelMapperTest, onItemsInsertedRemoved)
+{
+    SessionModel model;
+    MockWidgetForModel widget(&model);
+
+    std::vector<std::string> ranges;
+    auto on_range = [&ranges](const std::string& name) {
+        return [&ranges, name](SessionItem*, std::string tag, int first, int count) {
+            ranges.push_back(name + " " + tag + " " + std::to_string(first) + " "
+                             + std::to_string(count));
+        };
+    };
+    model.mapper()->setOnItemsInserted(on_range("inserted"), &ranges);
+    model.mapper()->setOnAboutToRemoveItems(on_range("about"), &ranges);
+    model.mapper()->setOnItemsRemoved(on_range("removed"), &ranges);
+
+    // per-item notifications are still emitted
+    EXPECT_CALL(widget, onItemInserted(model.rootItem(), _)).Times(4);
+    model.insertItems<SessionItem>(model.rootItem(), {}, 4);
+    EXPECT_EQ(ranges, std::vector<std::string>({"inserted rootTag 0 4"}));
+
+    ranges.clear();
+    EXPECT_CALL(widget, onAboutToRemoveItem(model.rootItem(), _)).Times(2);
+    EXPECT_CALL(widget, onItemRemoved(model.rootItem(), _)).Times(2);
+    model.removeItems(model.rootItem(), {"", 1}, 2);
+    EXPECT_EQ(ranges, std::vector<std::string>({"about rootTag 1 2", "removed rootTag 1 2"}));
+
+    // removal of single item is reported as range of one item
+    ranges.clear();
+    EXPECT_CALL(widget, onAboutToRemoveItem(model.rootItem(), _)).Times(1);
+    EXPECT_CALL(widget, onItemRemoved(model.rootItem(), _)).Times(1);
+    model.removeItem(model.rootItem(), {"", 0});
+    EXPECT_EQ(ranges, std::vector<std::string>({"about rootTag 0 1", "removed rootTag 0 1"}));
+
+    model.mapper()->unsubscribe(&ranges);
+}
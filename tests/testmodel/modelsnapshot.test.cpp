@@ -0,0 +1,189 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modelsnapshot.h"
+
+#include "google_test.h"
+#include "mvvm/model/compounditem.h"
+#include "mvvm/model/modeltransaction.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/snapshotitem.h"
+#include "mvvm/model/taginfo.h"
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace ModelView;
+
+//! Testing ModelSnapshot and SnapshotItem.
+
+class ModelSnapshotTest : public ::testing::Test {
+};
+
+TEST_F(ModelSnapshotTest, initialState)
+{
+    ModelSnapshot snapshot;
+    EXPECT_EQ(snapshot.rootItem(), nullptr);
+    EXPECT_EQ(snapshot.findItem("abc"), nullptr);
+    EXPECT_FALSE(snapshot.isSharedWith(snapshot));
+
+    SessionModel model("TestModel");
+    ModelSnapshot empty_model_snapshot(model);
+    EXPECT_EQ(empty_model_snapshot.modelType(), "TestModel");
+    ASSERT_NE(empty_model_snapshot.rootItem(), nullptr);
+    EXPECT_EQ(empty_model_snapshot.rootItem()->childrenCount(), 0);
+    EXPECT_EQ(empty_model_snapshot.rootItem()->identifier(), model.rootItem()->identifier());
+}
+
+//! Snapshot reproduces data and children of items.
+
+TEST_F(ModelSnapshotTest, content)
+{
+    SessionModel model;
+    auto parent = model.insertItem<CompoundItem>();
+    parent->setDisplayName("parent");
+    parent->addProperty("height", 42.0);
+    parent->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+    auto child0 = model.insertItem<SessionItem>(parent);
+    child0->setData(1);
+    auto child1 = model.insertItem<SessionItem>(parent);
+
+    ModelSnapshot snapshot(model);
+    auto snapshot_parent = snapshot.rootItem()->getItem("", 0);
+    ASSERT_NE(snapshot_parent, nullptr);
+    EXPECT_EQ(snapshot_parent->modelType(), Constants::CompoundItemType);
+    EXPECT_EQ(snapshot_parent->identifier(), parent->identifier());
+    EXPECT_EQ(snapshot_parent->displayName(), "parent");
+    EXPECT_EQ(snapshot_parent->property<double>("height"), 42.0);
+    EXPECT_EQ(snapshot_parent->childrenCount(), 3);
+    EXPECT_EQ(snapshot_parent->itemCount("children"), 2);
+    EXPECT_EQ(snapshot_parent->getItems("").size(), 2u);
+    EXPECT_EQ(snapshot_parent->getItem("children", 0)->data<int>(), 1);
+    EXPECT_FALSE(snapshot_parent->getItem("children", 1)->hasData());
+    EXPECT_EQ(snapshot_parent->getItem("children", 2), nullptr);
+    EXPECT_THROW(snapshot_parent->getItem("undefined"), std::runtime_error);
+
+    EXPECT_EQ(snapshot.findItem(child1->identifier()), snapshot_parent->getItem("children", 1));
+    EXPECT_EQ(snapshot.findItem("undefined"), nullptr);
+}
+
+//! Snapshot doesn't change, when the model is edited.
+
+TEST_F(ModelSnapshotTest, immutability)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    item->setData(1);
+
+    ModelSnapshot snapshot(model);
+    item->setData(2);
+    model.insertItem<SessionItem>();
+    model.removeItem(model.rootItem(), {"", 0});
+
+    EXPECT_EQ(snapshot.rootItem()->childrenCount(), 1);
+    EXPECT_EQ(snapshot.rootItem()->getItem("", 0)->data<int>(), 1);
+
+    ModelSnapshot snapshot2(model);
+    EXPECT_EQ(snapshot2.rootItem()->childrenCount(), 1);
+    EXPECT_FALSE(snapshot2.rootItem()->getItem("", 0)->hasData());
+}
+
+//! Parts of the tree, which didn't change, are shared between snapshots.
+
+TEST_F(ModelSnapshotTest, structuralSharing)
+{
+    SessionModel model;
+    auto parent0 = model.insertItem<CompoundItem>();
+    auto property0 = parent0->addProperty("height", 0.0);
+    auto parent1 = model.insertItem<CompoundItem>();
+    parent1->addProperty("height", 0.0);
+
+    ModelSnapshot snapshot1(model);
+    ModelSnapshot snapshot2(model);
+    EXPECT_TRUE(snapshot1.isSharedWith(snapshot2));
+
+    property0->setData(1.0);
+    ModelSnapshot snapshot3(model);
+    EXPECT_FALSE(snapshot3.isSharedWith(snapshot1));
+    EXPECT_NE(snapshot3.rootItem()->getItem("", 0), snapshot1.rootItem()->getItem("", 0));
+    EXPECT_EQ(snapshot3.rootItem()->getItem("", 1), snapshot1.rootItem()->getItem("", 1));
+    EXPECT_EQ(snapshot3.rootItem()->getItem("", 0)->property<double>("height"), 1.0);
+    EXPECT_EQ(snapshot1.rootItem()->getItem("", 0)->property<double>("height"), 0.0);
+
+    // changes inside the transaction are visible right away
+    {
+        ModelTransaction transaction(&model);
+        property0->setData(2.0);
+        ModelSnapshot snapshot4(model);
+        EXPECT_EQ(snapshot4.rootItem()->getItem("", 0)->property<double>("height"), 2.0);
+    }
+
+    // moved item keeps its snapshot
+    auto snapshot_parent1 = ModelSnapshot(model).rootItem()->getItem("", 1);
+    model.moveItem(parent1, model.rootItem(), {"", 0});
+    ModelSnapshot snapshot5(model);
+    EXPECT_EQ(snapshot5.rootItem()->getItem("", 0), snapshot_parent1);
+}
+
+//! Items don't keep their snapshots alive, once the snapshots are released by their users.
+
+TEST_F(ModelSnapshotTest, releasedSnapshot)
+{
+    SessionModel model;
+    auto parent = model.insertItem<CompoundItem>();
+    auto property = parent->addProperty("height", 0);
+
+    std::weak_ptr<const SnapshotItem> released = parent->snapshot();
+    EXPECT_TRUE(released.expired());
+
+    auto snapshot = parent->snapshot();
+    EXPECT_EQ(parent->snapshot(), snapshot);
+    std::weak_ptr<const SnapshotItem> property_snapshot = property->snapshot();
+    EXPECT_FALSE(property_snapshot.expired());
+
+    released = snapshot;
+    snapshot.reset();
+    EXPECT_TRUE(released.expired());
+    EXPECT_TRUE(property_snapshot.expired());
+
+    property->setData(42);
+    EXPECT_EQ(parent->snapshot()->property<int>("height"), 42);
+}
+
+//! Worker thread reads snapshots, while the model is edited.
+
+TEST_F(ModelSnapshotTest, concurrentReading)
+{
+    const int nchanges = 1000;
+
+    SessionModel model;
+    auto parent = model.insertItem<CompoundItem>();
+    auto property = parent->addProperty("height", 0);
+
+    ModelSnapshot snapshot(model);
+    std::atomic<bool> is_running{true};
+    std::atomic<int> mismatches{0};
+    std::thread reader([&]() {
+        while (is_running)
+            if (snapshot.rootItem()->getItem("", 0)->property<int>("height") != 0)
+                ++mismatches;
+    });
+
+    for (int i = 0; i < nchanges; ++i) {
+        property->setData(i + 1);
+        ModelSnapshot next(model);
+        EXPECT_EQ(next.rootItem()->getItem("", 0)->property<int>("height"), i + 1);
+    }
+    is_running = false;
+    reader.join();
+
+    EXPECT_EQ(mismatches, 0);
+}
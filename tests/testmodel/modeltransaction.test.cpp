@@ -0,0 +1,299 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modeltransaction.h"
+
+#include "google_test.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/taginfo.h"
+#include "mvvm/signals/modelmapper.h"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ModelView;
+
+//! Testing ModelTransaction and deferred notifications of ModelMapper.
+
+class ModelTransactionTest : public ::testing::Test {
+public:
+    //! Records notifications of the model as strings.
+    class Recorder {
+    public:
+        Recorder(SessionModel* model) : m_model(model)
+        {
+            auto mapper = model->mapper();
+            mapper->setOnDataChange(
+                [this](SessionItem* item, int role) {
+                    events.push_back("data " + item->displayName() + " " + std::to_string(role));
+                },
+                this);
+            mapper->setOnItemInserted(
+                [this](SessionItem*, TagRow tagrow) {
+                    events.push_back("insert " + tagrow.tag + " " + std::to_string(tagrow.row));
+                },
+                this);
+            mapper->setOnItemsInserted(
+                [this](SessionItem*, std::string tag, int first, int count) {
+                    events.push_back("range " + tag + " " + std::to_string(first) + " "
+                                     + std::to_string(count));
+                },
+                this);
+            mapper->setOnAboutToRemoveItem(
+                [this](SessionItem*, TagRow tagrow) {
+                    events.push_back("remove " + tagrow.tag + " " + std::to_string(tagrow.row));
+                },
+                this);
+            mapper->setOnTransactionCommitted([this](SessionModel*) { events.push_back("commit"); },
+                                              this);
+        }
+        ~Recorder() { m_model->mapper()->unsubscribe(this); }
+
+        std::vector<std::string> events;
+
+    private:
+        SessionModel* m_model{nullptr};
+    };
+};
+
+//! Without transaction every insertion is reported immediately as range of one item.
+
+TEST_F(ModelTransactionTest, noTransaction)
+{
+    SessionModel model;
+    Recorder recorder(&model);
+
+    auto item = model.insertItem<SessionItem>();
+    item->setDisplayName("item");
+    model.setData(item, 42, ItemDataRole::DATA);
+
+    std::vector<std::string> expected = {"insert rootTag 0", "range rootTag 0 1",
+                                         "data item " + std::to_string(ItemDataRole::DISPLAY),
+                                         "data item " + std::to_string(ItemDataRole::DATA)};
+    EXPECT_EQ(recorder.events, expected);
+    EXPECT_FALSE(model.mapper()->isInTransaction());
+}
+
+//! Repeated data changes are reported once, after the commit.
+
+TEST_F(ModelTransactionTest, dataChanges)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<SessionItem>();
+    item0->setDisplayName("item0");
+    auto item1 = model.insertItem<SessionItem>();
+    item1->setDisplayName("item1");
+    Recorder recorder(&model);
+
+    ModelTransaction transaction(&model);
+    EXPECT_TRUE(model.mapper()->isInTransaction());
+    model.setData(item1, 1, ItemDataRole::DATA);
+    model.setData(item0, 1, ItemDataRole::DATA);
+    model.setData(item1, 2, ItemDataRole::DATA);
+    model.setData(item1, 3, ItemDataRole::DATA);
+    EXPECT_TRUE(recorder.events.empty());
+
+    transaction.commit();
+    EXPECT_TRUE(transaction.isCommitted());
+    EXPECT_FALSE(model.mapper()->isInTransaction());
+
+    const std::string role = std::to_string(ItemDataRole::DATA);
+    std::vector<std::string> expected = {"data item1 " + role, "data item0 " + role, "commit"};
+    EXPECT_EQ(recorder.events, expected);
+    EXPECT_EQ(item1->data<int>(), 3);
+
+    // repeated commit does nothing
+    transaction.commit();
+    EXPECT_EQ(recorder.events, expected);
+}
+
+//! Adjacent insertions are reported as a single range.
+
+TEST_F(ModelTransactionTest, insertRange)
+{
+    SessionModel model;
+    Recorder recorder(&model);
+
+    {
+        ModelTransaction transaction(&model);
+        model.insertItem<SessionItem>();                        // row 0
+        model.insertItem<SessionItem>();                        // row 1
+        model.insertItem<SessionItem>(nullptr, {"rootTag", 0}); // prepend
+        model.insertItem<SessionItem>(nullptr, {"rootTag", 2}); // into the middle
+        EXPECT_TRUE(recorder.events.empty());
+    }
+
+    std::vector<std::string> expected = {"insert rootTag 0", "insert rootTag 1",
+                                         "insert rootTag 2", "insert rootTag 3",
+                                         "range rootTag 0 4", "commit"};
+    EXPECT_EQ(recorder.events, expected);
+}
+
+//! Insertions into different places are reported as separate ranges. Insertion adjacent to the
+//! range recorded earlier extends it.
+
+TEST_F(ModelTransactionTest, insertSeveralRanges)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("child"), /*set_as_default*/ true);
+    Recorder recorder(&model);
+
+    {
+        ModelTransaction transaction(&model);
+        model.insertItem<SessionItem>(parent);
+        model.insertItem<SessionItem>(parent);
+        model.insertItem<SessionItem>();
+        model.insertItem<SessionItem>(parent);
+    }
+
+    std::vector<std::string> expected = {"insert child 0",    "insert child 1",   "insert child 2",
+                                         "range child 0 3",   "insert rootTag 1",
+                                         "range rootTag 1 1", "commit"};
+    EXPECT_EQ(recorder.events, expected);
+}
+
+//! Insertion before the range recorded earlier shifts it. Every inserted item is reported once,
+//! and reported rows are valid when ranges are replayed one after another.
+
+TEST_F(ModelTransactionTest, insertBeforeEarlierRange)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("child"), /*set_as_default*/ true);
+    auto existing0 = model.insertItem<SessionItem>(parent);
+    auto existing1 = model.insertItem<SessionItem>(parent);
+    Recorder recorder(&model);
+
+    // replaying insertions on the list of children
+    std::vector<SessionItem*> replayed = {existing0, existing1};
+    model.mapper()->setOnItemInserted(
+        [&replayed](SessionItem* parent, TagRow tagrow) {
+            if (tagrow.tag == "child")
+                replayed.insert(replayed.begin() + tagrow.row,
+                                parent->getItem("child", tagrow.row));
+        },
+        this);
+
+    {
+        ModelTransaction transaction(&model);
+        model.insertItem<SessionItem>(parent, {"child", 2});
+        model.insertItem<SessionItem>();
+        model.insertItem<SessionItem>(parent, {"child", 0});
+    }
+
+    std::vector<std::string> expected = {"insert child 0",   "range child 0 1",
+                                         "insert child 3",   "range child 3 1",
+                                         "insert rootTag 1", "range rootTag 1 1",
+                                         "commit"};
+    EXPECT_EQ(recorder.events, expected);
+    EXPECT_EQ(replayed, parent->getItems("child"));
+
+    model.mapper()->unsubscribe(this);
+}
+
+//! Removal delivers recorded notifications first.
+
+TEST_F(ModelTransactionTest, removeDuringTransaction)
+{
+    SessionModel model;
+    Recorder recorder(&model);
+
+    ModelTransaction transaction(&model);
+    model.insertItem<SessionItem>();
+    model.insertItem<SessionItem>();
+    model.removeItem(model.rootItem(), {"rootTag", 0});
+
+    std::vector<std::string> expected = {"insert rootTag 0", "insert rootTag 1", "range rootTag 0 2",
+                                         "remove rootTag 0"};
+    EXPECT_EQ(recorder.events, expected);
+
+    transaction.commit();
+    expected.push_back("commit");
+    EXPECT_EQ(recorder.events, expected);
+}
+
+//! Notifications are delivered on commit of the outermost transaction.
+
+TEST_F(ModelTransactionTest, nestedTransactions)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    item->setDisplayName("item");
+    Recorder recorder(&model);
+
+    ModelTransaction outer(&model);
+    {
+        ModelTransaction inner(&model);
+        model.setData(item, 42, ItemDataRole::DATA);
+    }
+    EXPECT_TRUE(recorder.events.empty());
+    EXPECT_TRUE(model.mapper()->isInTransaction());
+
+    outer.commit();
+    std::vector<std::string> expected = {"data item " + std::to_string(ItemDataRole::DATA),
+                                         "commit"};
+    EXPECT_EQ(recorder.events, expected);
+}
+
+//! Exception thrown by the listener is reported by explicit commit, and suppressed by destructor.
+
+TEST_F(ModelTransactionTest, listenerThrows)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    model.mapper()->setOnDataChange(
+        [](SessionItem*, int) { throw std::runtime_error("listener error"); }, this);
+
+    {
+        ModelTransaction transaction(&model);
+        model.setData(item, 42, ItemDataRole::DATA);
+        EXPECT_THROW(transaction.commit(), std::runtime_error);
+        EXPECT_TRUE(transaction.isCommitted());
+        EXPECT_FALSE(model.mapper()->isInTransaction());
+    }
+
+    {
+        ModelTransaction transaction(&model);
+        model.setData(item, 43, ItemDataRole::DATA);
+    }
+    EXPECT_FALSE(model.mapper()->isInTransaction());
+    EXPECT_EQ(item->data<int>(), 43);
+
+    model.mapper()->unsubscribe(this);
+}
+
+//! Transaction left because of the exception delivers recorded notifications, but doesn't report
+//! the commit.
+
+TEST_F(ModelTransactionTest, exceptionDuringTransaction)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    item->setDisplayName("item");
+    Recorder recorder(&model);
+
+    try {
+        ModelTransaction outer(&model);
+        ModelTransaction inner(&model);
+        model.setData(item, 42, ItemDataRole::DATA);
+        throw std::runtime_error("error");
+    } catch (const std::runtime_error&) {
+    }
+
+    EXPECT_FALSE(model.mapper()->isInTransaction());
+    std::vector<std::string> expected = {"data item " + std::to_string(ItemDataRole::DATA)};
+    EXPECT_EQ(recorder.events, expected);
+}
+
+TEST_F(ModelTransactionTest, invalidModel)
+{
+    EXPECT_THROW(ModelTransaction(nullptr), std::runtime_error);
+}
@@ -0,0 +1,301 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/modelupdatequeue.h"
+
+#include "google_test.h"
+#include "mvvm/model/doublearray.h"
+#include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionmodel.h"
+#include "mvvm/model/taginfo.h"
+#include "mvvm/signals/modelmapper.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ModelView;
+
+//! Testing ModelUpdateQueue.
+
+class ModelUpdateQueueTest : public ::testing::Test {
+};
+
+TEST_F(ModelUpdateQueueTest, initialState)
+{
+    SessionModel model;
+    ModelUpdateQueue queue(&model);
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.processAll(), 0u);
+
+    EXPECT_THROW(ModelUpdateQueue(nullptr), std::runtime_error);
+}
+
+//! Data change is applied only when the queue is processed.
+
+TEST_F(ModelUpdateQueueTest, setData)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    item->setData(0.0);
+
+    ModelUpdateQueue queue(&model);
+    queue.setData(item->identifier(), 42.0);
+    queue.setData(item->identifier(), "abc", ItemDataRole::DISPLAY);
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(item->data<double>(), 0.0);
+
+    EXPECT_EQ(queue.processAll(), 2u);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(item->data<double>(), 42.0);
+    EXPECT_EQ(item->displayName(), "abc");
+}
+
+//! Repeated changes of the same item's role are collapsed into single update.
+
+TEST_F(ModelUpdateQueueTest, collapseRepeatedChanges)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<SessionItem>();
+    item0->setData(0.0);
+    auto item1 = model.insertItem<SessionItem>();
+    item1->setData(0.0);
+
+    int data_changes{0};
+    model.mapper()->setOnDataChange([&data_changes](auto, auto) { ++data_changes; }, this);
+
+    ModelUpdateQueue queue(&model);
+    queue.setData(item0->identifier(), 1.0);
+    queue.setData(item1->identifier(), 10.0);
+    queue.setData(item0->identifier(), 2.0);
+    queue.setData(item0->identifier(), 3.0);
+    EXPECT_EQ(queue.size(), 2u);
+
+    EXPECT_EQ(queue.processAll(), 2u);
+    EXPECT_EQ(item0->data<double>(), 3.0);
+    EXPECT_EQ(item1->data<double>(), 10.0);
+    EXPECT_EQ(data_changes, 2);
+
+    // change, which follows processed one, is queued again
+    queue.setData(item0->identifier(), 4.0);
+    EXPECT_EQ(queue.size(), 1u);
+    EXPECT_EQ(queue.processAll(), 1u);
+    EXPECT_EQ(item0->data<double>(), 4.0);
+
+    model.mapper()->unsubscribe(this);
+}
+
+//! Updates of items, which were removed before the queue was processed, are discarded.
+
+TEST_F(ModelUpdateQueueTest, updateOfRemovedItem)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    item->setData(0.0);
+    auto identifier = item->identifier();
+
+    ModelUpdateQueue queue(&model);
+    queue.setData(identifier, 42.0);
+    queue.insertItem(Constants::BaseType, identifier);
+    model.removeItem(model.rootItem(), {"", 0});
+
+    EXPECT_EQ(queue.processAll(), 0u);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+}
+
+//! Changes of the same item's role aren't collapsed across the insertion.
+
+TEST_F(ModelUpdateQueueTest, noCollapseAcrossInsertion)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    item->setData(0.0);
+    item->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+
+    ModelUpdateQueue queue(&model);
+    queue.setData(item->identifier(), 1.0);
+    queue.insertItem(Constants::BaseType, item->identifier());
+    queue.setData(item->identifier(), 2.0);
+    queue.setData(item->identifier(), 3.0);
+    EXPECT_EQ(queue.size(), 3u);
+
+    // the change before the insertion is applied alone
+    EXPECT_EQ(queue.process(1), 1u);
+    EXPECT_EQ(item->data<double>(), 1.0);
+    EXPECT_EQ(item->childrenCount(), 0);
+
+    // the change after the insertion still collapses with the following ones
+    queue.setData(item->identifier(), 4.0);
+    EXPECT_EQ(queue.size(), 2u);
+
+    EXPECT_EQ(queue.processAll(), 2u);
+    EXPECT_EQ(item->data<double>(), 4.0);
+    EXPECT_EQ(item->childrenCount(), 1);
+}
+
+//! Invalid updates are discarded, the rest of the batch is applied.
+
+TEST_F(ModelUpdateQueueTest, invalidUpdate)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<SessionItem>();
+    item0->setData(0.0);
+    auto item1 = model.insertItem<SessionItem>();
+    item1->setData(0.0);
+
+    int data_changes{0};
+    model.mapper()->setOnDataChange([&data_changes](auto, auto) { ++data_changes; }, this);
+
+    ModelUpdateQueue queue(&model);
+    queue.setData(item0->identifier(), Variant::fromValue(std::string("abc")));
+    queue.insertItem("undefined", model.rootItem()->identifier());
+    queue.setData(item1->identifier(), 42.0);
+
+    EXPECT_EQ(queue.processAll(), 1u);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(item0->data<double>(), 0.0);
+    EXPECT_EQ(item1->data<double>(), 42.0);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 2);
+    EXPECT_EQ(data_changes, 1);
+
+    model.mapper()->unsubscribe(this);
+}
+
+//! Insertion of the item by type.
+
+TEST_F(ModelUpdateQueueTest, insertItem)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+
+    ModelUpdateQueue queue(&model);
+    queue.insertItem(Constants::BaseType, model.rootItem()->identifier());
+    queue.insertItem(Constants::PropertyType, parent->identifier());
+    queue.insertItem(Constants::BaseType, parent->identifier(), {"tag", 0});
+    EXPECT_EQ(queue.size(), 3u);
+
+    EXPECT_EQ(queue.processAll(), 3u);
+    EXPECT_EQ(model.rootItem()->childrenCount(), 2);
+    ASSERT_EQ(parent->childrenCount(), 2);
+    EXPECT_EQ(parent->children().at(0)->modelType(), Constants::BaseType);
+    EXPECT_EQ(parent->children().at(1)->modelType(), Constants::PropertyType);
+}
+
+//! Array of values is set as DoubleArray.
+
+TEST_F(ModelUpdateQueueTest, setArray)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+    item->setData(DoubleArray());
+
+    ModelUpdateQueue queue(&model);
+    queue.setArray(item->identifier(), {1.0, 2.0});
+    queue.setArray(item->identifier(), {1.0, 2.0, 3.0});
+    EXPECT_EQ(queue.size(), 1u);
+
+    EXPECT_EQ(queue.processAll(), 1u);
+    EXPECT_EQ(item->data<DoubleArray>().values(), std::vector<double>({1.0, 2.0, 3.0}));
+}
+
+//! Processing of the queue in batches of limited size.
+
+TEST_F(ModelUpdateQueueTest, processInBatches)
+{
+    SessionModel model;
+    auto items = model.insertItems<SessionItem>(model.rootItem(), {"", -1}, 5);
+
+    int commits{0};
+    model.mapper()->setOnTransactionCommitted([&commits](auto) { ++commits; }, this);
+
+    ModelUpdateQueue queue(&model);
+    for (size_t i = 0; i < items.size(); ++i)
+        queue.setData(items[i]->identifier(), static_cast<int>(i));
+
+    EXPECT_EQ(queue.process(2), 2u);
+    EXPECT_EQ(queue.size(), 3u);
+    EXPECT_EQ(items[1]->data<int>(), 1);
+    EXPECT_FALSE(items[2]->hasData());
+    EXPECT_EQ(commits, 1);
+
+    EXPECT_EQ(queue.process(2), 2u);
+    EXPECT_EQ(queue.process(2), 1u);
+    EXPECT_EQ(queue.process(2), 0u);
+    EXPECT_EQ(items[4]->data<int>(), 4);
+    EXPECT_EQ(commits, 3);
+
+    model.mapper()->unsubscribe(this);
+}
+
+//! Callback is notified when the first update enters the empty queue.
+
+TEST_F(ModelUpdateQueueTest, onUpdatesPending)
+{
+    SessionModel model;
+    auto item = model.insertItem<SessionItem>();
+
+    int notifications{0};
+    ModelUpdateQueue queue(&model);
+    queue.setOnUpdatesPending([&notifications]() { ++notifications; });
+
+    queue.setData(item->identifier(), 1.0);
+    queue.setData(item->identifier(), 2.0, ItemDataRole::DISPLAY);
+    EXPECT_EQ(notifications, 1);
+
+    queue.processAll();
+    queue.setData(item->identifier(), 3.0);
+    EXPECT_EQ(notifications, 2);
+
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    queue.setData(item->identifier(), 4.0);
+    EXPECT_EQ(notifications, 3);
+    EXPECT_EQ(queue.processAll(), 1u);
+    EXPECT_EQ(item->data<double>(), 4.0);
+}
+
+//! Several worker threads update their own items, while the main thread processes the queue.
+//! Eventually, every item has the last value written by its worker.
+
+TEST_F(ModelUpdateQueueTest, workerThreads)
+{
+    const int nthreads = 4;
+    const int nchanges = 10000;
+
+    SessionModel model;
+    auto items = model.insertItems<SessionItem>(model.rootItem(), {"", -1}, nthreads);
+    std::vector<identifier_type> identifiers;
+    for (auto item : items)
+        identifiers.push_back(item->identifier());
+
+    ModelUpdateQueue queue(&model);
+    std::vector<std::thread> workers;
+    for (int i_thread = 0; i_thread < nthreads; ++i_thread)
+        workers.emplace_back([&queue, &identifiers, i_thread]() {
+            for (int i = 0; i < nchanges; ++i)
+                queue.setData(identifiers[i_thread], i + 1);
+        });
+
+    auto is_done = [&items]() {
+        return std::all_of(items.begin(), items.end(),
+                           [](auto item) { return item->template data<int>() == nchanges; });
+    };
+    while (!is_done())
+        queue.process(100);
+
+    for (auto& worker : workers)
+        worker.join();
+    queue.processAll();
+
+    for (auto item : items)
+        EXPECT_EQ(item->data<int>(), nchanges);
+}
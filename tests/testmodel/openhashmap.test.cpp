@@ -0,0 +1,94 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/utils/openhashmap.h"
+
+#include "google_test.h"
+#include <map>
+
+using namespace ModelView;
+
+//! Tests of OpenHashMap.
+
+class OpenHashMapTest : public ::testing::Test {
+};
+
+TEST_F(OpenHashMapTest, initialState)
+{
+    OpenHashMap<int, int> map;
+    EXPECT_EQ(map.size(), 0u);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(42), nullptr);
+    EXPECT_FALSE(map.contains(42));
+    EXPECT_FALSE(map.erase(42));
+}
+
+TEST_F(OpenHashMapTest, insertAndFind)
+{
+    OpenHashMap<int, double> map;
+    EXPECT_TRUE(map.insert(1, 10.0));
+    EXPECT_TRUE(map.insert(2, 20.0));
+    EXPECT_FALSE(map.insert(1, 30.0)); // existing key
+
+    EXPECT_EQ(map.size(), 2u);
+    ASSERT_NE(map.find(1), nullptr);
+    EXPECT_EQ(*map.find(1), 10.0);
+    ASSERT_NE(map.find(2), nullptr);
+    EXPECT_EQ(*map.find(2), 20.0);
+    EXPECT_EQ(map.find(3), nullptr);
+}
+
+TEST_F(OpenHashMapTest, erase)
+{
+    OpenHashMap<int, int> map;
+    map.insert(1, 10);
+    map.insert(2, 20);
+
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_FALSE(map.erase(1));
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(map.find(1), nullptr);
+    ASSERT_NE(map.find(2), nullptr);
+    EXPECT_EQ(*map.find(2), 20);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(2), nullptr);
+}
+
+//! Pointers as keys, many insertions and removals in comparison with std::map.
+
+TEST_F(OpenHashMapTest, pointerKeys)
+{
+    const int nitems = 10000;
+    std::vector<int> objects(nitems);
+
+    OpenHashMap<const int*, int> map;
+    std::map<const int*, int> expected;
+    for (int i = 0; i < nitems; ++i) {
+        map.insert(&objects[i], i);
+        expected.insert({&objects[i], i});
+    }
+    for (int i = 0; i < nitems; i += 3) {
+        map.erase(&objects[i]);
+        expected.erase(&objects[i]);
+    }
+
+    EXPECT_EQ(map.size(), expected.size());
+    for (int i = 0; i < nitems; ++i) {
+        auto value = map.find(&objects[i]);
+        if (i % 3 == 0) {
+            EXPECT_EQ(value, nullptr);
+        }
+        else {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, i);
+        }
+    }
+}
@@ -15,6 +15,8 @@
 #include "mvvm/model/propertyitem.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/project/project_types.h"
+#include "mvvm/standarditems/axisitems.h"
+#include "mvvm/standarditems/data2ditem.h"
 #include "mvvm/utils/fileutils.h"
 #include <cctype>
 
@@ -130,3 +132,58 @@ TEST_F(ProjectTest, loadModel)
     EXPECT_EQ(project.projectDir(), project_dir);
     EXPECT_FALSE(project.isModified());
 }
+
+//! Testing save and load of the project in binary format.
+
+TEST_F(ProjectTest, saveLoadBinaryFormat)
+{
+    auto context = createContext();
+    context.m_document_format = ModelDocumentFormat::BINARY;
+    Project project(context);
+
+    auto item0 = sample_model->insertItem<PropertyItem>();
+    item0->setData(std::string("sample_model_item"));
+    auto item0_identifier = item0->identifier();
+
+    auto project_dir = createEmptyDir("Untitled3");
+    project.save(project_dir);
+
+    // model files have binary extension
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir, "samplemodel.mvvm")));
+    EXPECT_TRUE(Utils::exists(Utils::join(project_dir, "materialmodel.mvvm")));
+    EXPECT_FALSE(Utils::exists(Utils::join(project_dir, get_json_filename(samplemodel_name))));
+
+    sample_model->clear();
+    project.load(project_dir);
+    ASSERT_EQ(sample_model->rootItem()->childrenCount(), 1);
+    EXPECT_EQ(sample_model->rootItem()->children()[0]->identifier(), item0_identifier);
+    EXPECT_EQ(sample_model->rootItem()->children()[0]->data<std::string>(), "sample_model_item");
+    EXPECT_FALSE(project.isModified());
+}
+
+//! Large arrays of binary project are loaded lazily without marking the project as modified.
+
+TEST_F(ProjectTest, loadBinaryFormatLazily)
+{
+    auto context = createContext();
+    context.m_document_format = ModelDocumentFormat::BINARY;
+    Project project(context);
+
+    const int nbins = 300;
+    auto item = sample_model->insertItem<Data2DItem>();
+    item->setAxes(FixedBinAxisItem::create(nbins, 0.0, 1.0),
+                  FixedBinAxisItem::create(nbins, 0.0, 1.0));
+    std::vector<double> expected(nbins * nbins, 42.0);
+    item->setContent(expected);
+
+    auto project_dir = createEmptyDir("Untitled4");
+    project.save(project_dir);
+    sample_model->clear();
+    project.load(project_dir);
+
+    auto content = sample_model->topItem<Data2DItem>()->content();
+    EXPECT_FALSE(content.isLoaded());
+    EXPECT_EQ(content, expected);
+    EXPECT_TRUE(content.isLoaded());
+    EXPECT_FALSE(project.isModified());
+}
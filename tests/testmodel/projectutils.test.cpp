@@ -47,6 +47,8 @@ TEST_F(ProjectUtilsTest, SuggestFileName)
 {
     SessionModel model("TestModel");
     EXPECT_EQ(std::string("testmodel.json"), ProjectUtils::SuggestFileName(model));
+    EXPECT_EQ(std::string("testmodel.mvvm"),
+              ProjectUtils::SuggestFileName(model, ModelDocumentFormat::BINARY));
 }
 
 TEST_F(ProjectUtilsTest, CreateUntitledProject)
@@ -85,3 +87,16 @@ TEST_F(ProjectUtilsTest, IsPossibleProjectDir)
     project->save(dirname);
     EXPECT_TRUE(ProjectUtils::IsPossibleProjectDir(dirname));
 }
+
+TEST_F(ProjectUtilsTest, IsPossibleBinaryProjectDir)
+{
+    auto context = createContext();
+    context.m_document_format = ModelDocumentFormat::BINARY;
+    auto project = ProjectUtils::CreateUntitledProject(context);
+
+    auto dirname = createEmptyDir("test_IsPossibleBinaryProjectDir");
+    EXPECT_FALSE(ProjectUtils::IsPossibleProjectDir(dirname));
+
+    project->save(dirname);
+    EXPECT_TRUE(ProjectUtils::IsPossibleProjectDir(dirname));
+}
@@ -10,6 +10,7 @@
 #include "mvvm/commands/removeitemcommand.h"
 
 #include "google_test.h"
+#include "mockwidgets.h"
 #include "mvvm/model/compounditem.h"
 #include "mvvm/model/itemutils.h"
 #include "mvvm/model/sessionitem.h"
@@ -17,6 +18,7 @@
 #include "mvvm/model/taginfo.h"
 
 using namespace ModelView;
+using ::testing::_;
 
 class RemoveItemCommandTest : public ::testing::Test {
 };
@@ -171,3 +173,57 @@ TEST_F(RemoveItemCommandTest, attemptToRemoveItem)
     EXPECT_TRUE(command->isObsolete());
     EXPECT_EQ(std::get<bool>(command->result()), false);
 }
+
+//! Removed item is kept by the command and returns to the model on undo.
+
+TEST_F(RemoveItemCommandTest, removedItemIsRestored)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>(model.rootItem());
+    parent->registerTag(TagInfo::universalTag("tag1"), /*set_as_default*/ true);
+    auto child = model.insertItem<SessionItem>(parent);
+
+    auto command = std::make_unique<RemoveItemCommand>(model.rootItem(), TagRow{"", 0});
+    command->execute();
+    EXPECT_EQ(model.findItem(parent->identifier()), nullptr);
+    EXPECT_EQ(model.findItem(child->identifier()), nullptr);
+    EXPECT_EQ(parent->model(), nullptr);
+
+    command->undo();
+    EXPECT_EQ(Utils::ChildAt(model.rootItem(), 0), parent);
+    EXPECT_EQ(model.findItem(parent->identifier()), parent);
+    EXPECT_EQ(model.findItem(child->identifier()), child);
+    EXPECT_EQ(child->model(), &model);
+
+    // repeating the cycle
+    command->execute();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+    command->undo();
+    EXPECT_EQ(Utils::ChildAt(parent, 0), child);
+}
+
+//! Subscribers of the removed item are notified as if the item was destroyed, and don't get
+//! notifications after the undo.
+
+TEST_F(RemoveItemCommandTest, subscribersOfRemovedItem)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>(model.rootItem());
+    parent->registerTag(TagInfo::universalTag("tag1"), /*set_as_default*/ true);
+    auto child = model.insertItem<SessionItem>(parent);
+
+    MockWidgetForItem parent_widget(parent);
+    MockWidgetForItem child_widget(child);
+
+    EXPECT_CALL(parent_widget, onItemDestroy(parent)).Times(1);
+    EXPECT_CALL(child_widget, onItemDestroy(child)).Times(1);
+
+    auto command = std::make_unique<RemoveItemCommand>(model.rootItem(), TagRow{"", 0});
+    command->execute();
+
+    EXPECT_CALL(parent_widget, onDataChange(_, _)).Times(0);
+    EXPECT_CALL(child_widget, onDataChange(_, _)).Times(0);
+
+    command->undo();
+    child->setData(42.0);
+}
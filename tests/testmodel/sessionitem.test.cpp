@@ -10,6 +10,7 @@
 #include "mvvm/model/sessionitem.h"
 
 #include "google_test.h"
+#include "mvvm/model/identifierloadingscope.h"
 #include "mvvm/model/itempool.h"
 #include "mvvm/model/itemutils.h"
 #include "mvvm/model/propertyitem.h"
@@ -46,6 +47,42 @@ TEST_F(SessionItemTest, initialState)
     EXPECT_FALSE(item.identifier().empty());
 }
 
+//! Items constructed within the loading scope get no identifier. Missing identifiers are
+//! generated by the outermost scope.
+
+TEST_F(SessionItemTest, identifierLoadingScope)
+{
+    EXPECT_FALSE(IdentifierLoadingScope::isActive());
+    {
+        IdentifierLoadingScope scope;
+        EXPECT_TRUE(IdentifierLoadingScope::isActive());
+
+        SessionItem item;
+        EXPECT_FALSE(item.hasData(ItemDataRole::IDENTIFIER));
+        EXPECT_EQ(item.itemData()->roles(), std::vector<int>({ItemDataRole::DISPLAY}));
+        item.registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+        auto child = item.insertItem(std::make_unique<SessionItem>(), TagRow::append());
+
+        // identifier of the item comes from the loader
+        item.setData(std::string("abc"), ItemDataRole::IDENTIFIER);
+
+        {
+            IdentifierLoadingScope nested_scope;
+            nested_scope.assignMissing(item);
+            EXPECT_FALSE(child->hasData(ItemDataRole::IDENTIFIER));
+        }
+        EXPECT_TRUE(IdentifierLoadingScope::isActive());
+
+        scope.assignMissing(item);
+        EXPECT_EQ(item.identifier(), "abc");
+        EXPECT_FALSE(child->identifier().empty());
+    }
+    EXPECT_FALSE(IdentifierLoadingScope::isActive());
+
+    SessionItem item;
+    EXPECT_FALSE(item.identifier().empty());
+}
+
 TEST_F(SessionItemTest, modelType)
 {
     SessionItem item2("Layer");
@@ -151,6 +188,20 @@ TEST_F(SessionItemTest, setStringData)
     EXPECT_EQ(item.data<std::string>(), expected);
 }
 
+//! Access to the data without copying.
+
+TEST_F(SessionItemTest, dataRef)
+{
+    SessionItem item;
+    item.setData(std::string("abc"));
+    EXPECT_EQ(item.dataRef<std::string>(), std::string("abc"));
+    EXPECT_EQ(&item.dataRef<std::string>(), &item.dataRef<std::string>());
+
+    // wrong type or missing data
+    EXPECT_THROW(item.dataRef<double>(), std::runtime_error);
+    EXPECT_THROW(item.dataRef<std::string>(ItemDataRole::TOOLTIP), std::runtime_error);
+}
+
 //! Display role.
 
 TEST_F(SessionItemTest, displayName)
@@ -161,3 +161,51 @@ TEST_F(SessionItemDataTest, hasRole)
     data.setData(QVariant(), role);
     EXPECT_FALSE(data.hasData(role));
 }
+
+//! Predefined and custom roles removed in arbitrary order. Lookup and order of remaining roles.
+
+TEST_F(SessionItemDataTest, removeRoles)
+{
+    SessionItemData data;
+    const std::vector<int> all_roles = {ItemDataRole::DISPLAY, 99, ItemDataRole::DATA,
+                                        ItemDataRole::TOOLTIP, -5, ItemDataRole::IDENTIFIER};
+    for (size_t i = 0; i < all_roles.size(); ++i)
+        data.setData(QVariant::fromValue(static_cast<int>(i)), all_roles[i]);
+    EXPECT_EQ(data.roles(), all_roles);
+
+    data.setData(QVariant(), 99);
+    data.setData(QVariant(), ItemDataRole::DATA);
+    std::vector<int> expected = {ItemDataRole::DISPLAY, ItemDataRole::TOOLTIP, -5,
+                                 ItemDataRole::IDENTIFIER};
+    EXPECT_EQ(data.roles(), expected);
+
+    EXPECT_EQ(data.data(ItemDataRole::DISPLAY).value<int>(), 0);
+    EXPECT_EQ(data.data(ItemDataRole::TOOLTIP).value<int>(), 3);
+    EXPECT_EQ(data.data(-5).value<int>(), 4);
+    EXPECT_EQ(data.data(ItemDataRole::IDENTIFIER).value<int>(), 5);
+    EXPECT_FALSE(data.hasData(ItemDataRole::DATA));
+    EXPECT_FALSE(data.hasData(99));
+
+    // role added after removal goes to the end
+    data.setData(QVariant::fromValue(42), ItemDataRole::DATA);
+    expected.push_back(ItemDataRole::DATA);
+    EXPECT_EQ(data.roles(), expected);
+    EXPECT_EQ(data.data(ItemDataRole::DATA).value<int>(), 42);
+    EXPECT_EQ(data.data(ItemDataRole::IDENTIFIER).value<int>(), 5);
+}
+
+//! Returned data refers to the stored variant.
+
+TEST_F(SessionItemDataTest, dataReference)
+{
+    SessionItemData data;
+    data.setData(QVariant::fromValue(std::string("abc")), ItemDataRole::DATA);
+
+    const auto& variant1 = data.data(ItemDataRole::DATA);
+    const auto& variant2 = data.data(ItemDataRole::DATA);
+    EXPECT_EQ(&variant1, &variant2);
+    EXPECT_EQ(&variant1, &data.begin()->m_data);
+
+    // missing role
+    EXPECT_FALSE(data.data(ItemDataRole::TOOLTIP).isValid());
+}
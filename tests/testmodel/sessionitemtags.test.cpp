@@ -11,6 +11,7 @@
 
 #include "google_test.h"
 #include "mvvm/model/sessionitem.h"
+#include "mvvm/model/sessionitemcontainer.h"
 #include "mvvm/model/taginfo.h"
 #include <stdexcept>
 
@@ -175,6 +176,38 @@ TEST_F(SessionItemTagsTest, tagRowOfItem)
     EXPECT_EQ(tag.tagRowOfItem(nullptr).row, -1);
 }
 
+//! Visiting all items with their tags and rows.
+
+TEST_F(SessionItemTagsTest, forEachItem)
+{
+    const std::string tag1 = "tag1";
+    const std::string tag2 = "tag2";
+
+    SessionItemTags tag;
+    tag.registerTag(TagInfo::universalTag(tag1), /*set_as_default*/ true);
+    tag.registerTag(TagInfo::propertyTag(tag2, "Property"));
+
+    auto child_t1_a = new SessionItem;
+    auto child_t1_b = new SessionItem;
+    auto child_t2_a = new SessionItem("Property");
+    tag.insertItem(child_t1_a, TagRow::append());
+    tag.insertItem(child_t1_b, TagRow::append());
+    tag.insertItem(child_t2_a, {tag2, 0});
+
+    std::vector<SessionItem*> items;
+    std::vector<TagRow> tagrows;
+    std::vector<bool> properties;
+    tag.forEachItem([&](auto item, const auto& container, int row) {
+        items.push_back(item);
+        tagrows.push_back({container.tagName(), row});
+        properties.push_back(container.tagInfo().isSinglePropertyTag());
+    });
+
+    EXPECT_EQ(items, std::vector<SessionItem*>({child_t1_a, child_t1_b, child_t2_a}));
+    EXPECT_EQ(tagrows, std::vector<TagRow>({{tag1, 0}, {tag1, 1}, {tag2, 0}}));
+    EXPECT_EQ(properties, std::vector<bool>({false, false, true}));
+}
+
 //! Testing method getItem.
 
 TEST_F(SessionItemTagsTest, getItem)
@@ -256,3 +289,32 @@ TEST_F(SessionItemTagsTest, isSinglePropertyTag)
 
     EXPECT_FALSE(tag.isSinglePropertyTag("unexisting tag"));
 }
+
+//! Lookup of tags when their number is large enough to build the index.
+
+TEST_F(SessionItemTagsTest, manyTags)
+{
+    const int ntags = 20;
+    SessionItemTags tag;
+    for (int i = 0; i < ntags; ++i)
+        tag.registerTag(TagInfo::universalTag("tag" + std::to_string(i)), i == 10);
+    EXPECT_EQ(tag.tagsCount(), ntags);
+    EXPECT_EQ(tag.defaultTag(), "tag10");
+
+    for (int i = 0; i < ntags; ++i) {
+        EXPECT_TRUE(tag.isTag("tag" + std::to_string(i)));
+        EXPECT_EQ(tag.itemCount(TagName("tag" + std::to_string(i))), 0);
+    }
+    EXPECT_FALSE(tag.isTag("tag20"));
+    EXPECT_THROW(tag.registerTag(TagInfo::universalTag("tag15")), std::runtime_error);
+
+    auto child = new SessionItem;
+    EXPECT_TRUE(tag.insertItem(child, {"tag15", 0}));
+    EXPECT_EQ(tag.itemCount("tag15"), 1);
+    EXPECT_EQ(tag.tagRowOfItem(child), TagRow("tag15", 0));
+
+    // default tag
+    auto child2 = new SessionItem;
+    EXPECT_TRUE(tag.insertItem(child2, {}));
+    EXPECT_EQ(tag.tagRowOfItem(child2), TagRow("tag10", 0));
+}
@@ -10,6 +10,7 @@
 #include "mvvm/model/sessionmodel.h"
 
 #include "google_test.h"
+#include "mvvm/interfaces/undostackinterface.h"
 #include "mvvm/model/compounditem.h"
 #include "mvvm/model/itempool.h"
 #include "mvvm/model/itemutils.h"
@@ -188,6 +189,92 @@ TEST_F(SessionModelTest, removeNonExistingItem)
     EXPECT_NO_THROW(model.removeItem(parent, {"", 0}));
 }
 
+//! Bulk insertion of items.
+
+TEST_F(SessionModelTest, insertItems)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto child = model.insertItem<SessionItem>(parent);
+
+    // appending
+    auto appended = model.insertItems<PropertyItem>(parent, {}, 3);
+    ASSERT_EQ(appended.size(), 3u);
+    EXPECT_EQ(parent->getItems("defaultTag"),
+              std::vector<SessionItem*>({child, appended[0], appended[1], appended[2]}));
+
+    // inserting in front
+    auto inserted = model.insertNewItems(Constants::BaseType, parent, {"", 0}, 2);
+    ASSERT_EQ(inserted.size(), 2u);
+    EXPECT_EQ(parent->childrenCount(), 6);
+    EXPECT_EQ(Utils::ChildAt(parent, 0), inserted[0]);
+    EXPECT_EQ(Utils::ChildAt(parent, 1), inserted[1]);
+    EXPECT_EQ(Utils::ChildAt(parent, 2), child);
+
+    EXPECT_TRUE(model.insertItems<SessionItem>(parent, {}, 0).empty());
+}
+
+//! Bulk insertion stops on the first item which can't be inserted.
+
+TEST_F(SessionModelTest, insertItemsWithLimit)
+{
+    SessionModel model;
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo("tag", 0, 2, {}), /*set_as_default*/ true);
+
+    auto inserted = model.insertItems<SessionItem>(parent, {}, 3);
+    EXPECT_EQ(inserted.size(), 2u);
+    EXPECT_EQ(parent->childrenCount(), 2);
+}
+
+//! Bulk removal of items.
+
+TEST_F(SessionModelTest, removeItems)
+{
+    auto pool = std::make_shared<ItemPool>();
+    SessionModel model("Test", pool);
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto children = model.insertItems<SessionItem>(parent, {}, 5);
+    auto key = children[2]->identifier();
+
+    model.removeItems(parent, {"", 1}, 3);
+    EXPECT_EQ(parent->getItems("defaultTag"),
+              std::vector<SessionItem*>({children[0], children[4]}));
+    EXPECT_EQ(pool->item_for_key(key), nullptr);
+
+    // invalid range
+    EXPECT_THROW(model.removeItems(parent, {"", 1}, 2), std::runtime_error);
+    EXPECT_EQ(parent->childrenCount(), 2);
+}
+
+//! Bulk removal is undone as a single step.
+
+TEST_F(SessionModelTest, removeItemsUndo)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+    auto parent = model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("defaultTag"), /*set_as_default*/ true);
+    auto children = model.insertItems<SessionItem>(parent, {}, 4);
+    std::vector<std::string> keys;
+    for (auto child : children)
+        keys.push_back(child->identifier());
+
+    model.removeItems(parent, {"", 0}, 4);
+    EXPECT_EQ(parent->childrenCount(), 0);
+
+    model.undoStack()->undo();
+    ASSERT_EQ(parent->childrenCount(), 4);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(Utils::ChildAt(parent, i)->identifier(), keys[static_cast<size_t>(i)]);
+
+    // undo of bulk insertion
+    model.undoStack()->undo();
+    EXPECT_EQ(parent->childrenCount(), 0);
+}
+
 TEST_F(SessionModelTest, takeRowFromRootItem)
 {
     auto pool = std::make_shared<ItemPool>();
@@ -453,3 +540,20 @@ TEST_F(SessionModelTest, registerItem)
     ASSERT_TRUE(dynamic_cast<TestItem*>(item) != nullptr);
     EXPECT_EQ(item->modelType(), expectedModelType);
 }
+
+//! Failed insertion of several items doesn't leave the undo macro open.
+
+TEST_F(SessionModelTest, insertItemsThrowsWithUndo)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+
+    EXPECT_THROW(model.insertItems<SessionItem>(model.rootItem(), {"undefined", -1}, 2),
+                 std::runtime_error);
+
+    // the next command is recorded as a separate one
+    model.insertItem<SessionItem>();
+    EXPECT_TRUE(model.undoStack()->canUndo());
+    model.undoStack()->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+}
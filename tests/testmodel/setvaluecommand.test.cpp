@@ -70,3 +70,38 @@ TEST_F(SetValueCommandTest, setSameValueCommand)
     // undoing command which is in isObsolete state is not possible
     EXPECT_THROW(command->undo(), std::runtime_error);
 }
+
+//! Command description is generated from the value set at construction.
+
+TEST_F(SetValueCommandTest, description)
+{
+    SessionModel model;
+    const int role = ItemDataRole::DATA;
+    auto item = model.insertItem<SessionItem>();
+
+    auto command = std::make_unique<SetValueCommand>(item, QVariant(42), role);
+    command->execute();
+    EXPECT_EQ(command->description(), "Set value: 42, role:" + std::to_string(role));
+}
+
+//! Command finds its item after insertion of other items in front of it.
+
+TEST_F(SetValueCommandTest, itemShifted)
+{
+    SessionModel model;
+    const int role = ItemDataRole::DATA;
+    auto item = model.insertItem<SessionItem>();
+
+    auto command = std::make_unique<SetValueCommand>(item, QVariant(42.0), role);
+    command->execute();
+    EXPECT_EQ(item->data<double>(), 42.0);
+
+    // item changes its row
+    model.insertItem<SessionItem>(model.rootItem(), {"", 0});
+    EXPECT_EQ(item->tagRow().row, 1);
+
+    command->undo();
+    EXPECT_FALSE(model.data(item, role).isValid());
+    command->execute();
+    EXPECT_EQ(item->data<double>(), 42.0);
+}
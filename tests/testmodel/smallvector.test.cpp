@@ -0,0 +1,100 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/utils/smallvector.h"
+
+#include "google_test.h"
+#include <string>
+#include <vector>
+
+using namespace ModelView;
+
+//! Tests of SmallVector.
+
+class SmallVectorTest : public ::testing::Test {
+public:
+    template <typename T> std::vector<std::string> to_vector(const T& container)
+    {
+        return std::vector<std::string>(container.begin(), container.end());
+    }
+};
+
+TEST_F(SmallVectorTest, initialState)
+{
+    SmallVector<std::string, 2> vec;
+    EXPECT_EQ(vec.size(), 0u);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 2u);
+    EXPECT_TRUE(vec.isInline());
+    EXPECT_EQ(vec.begin(), vec.end());
+}
+
+TEST_F(SmallVectorTest, pushBack)
+{
+    SmallVector<std::string, 2> vec;
+    vec.push_back("a");
+    vec.emplace_back("b");
+    EXPECT_TRUE(vec.isInline());
+    EXPECT_EQ(to_vector(vec), std::vector<std::string>({"a", "b"}));
+
+    // elements go to the heap when inline storage is exhausted
+    vec.push_back(std::string(100, 'c'));
+    EXPECT_FALSE(vec.isInline());
+    EXPECT_EQ(vec.size(), 3u);
+    EXPECT_EQ(vec.capacity(), 4u);
+    EXPECT_EQ(to_vector(vec), std::vector<std::string>({"a", "b", std::string(100, 'c')}));
+    EXPECT_EQ(vec[1], "b");
+}
+
+TEST_F(SmallVectorTest, erase)
+{
+    SmallVector<std::string, 4> vec;
+    for (auto x : {"a", "b", "c", "d"})
+        vec.push_back(x);
+
+    auto it = vec.erase(vec.begin() + 1);
+    EXPECT_EQ(*it, "c");
+    EXPECT_EQ(to_vector(vec), std::vector<std::string>({"a", "c", "d"}));
+
+    it = vec.erase(vec.begin() + 2);
+    EXPECT_EQ(it, vec.end());
+    EXPECT_EQ(to_vector(vec), std::vector<std::string>({"a", "c"}));
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+}
+
+TEST_F(SmallVectorTest, copyAndMove)
+{
+    SmallVector<std::string, 2> inline_vec;
+    inline_vec.push_back("a");
+
+    SmallVector<std::string, 2> heap_vec;
+    for (auto x : {"a", "b", "c"})
+        heap_vec.push_back(x);
+
+    auto copy = heap_vec;
+    EXPECT_EQ(to_vector(copy), to_vector(heap_vec));
+    copy = inline_vec;
+    EXPECT_EQ(to_vector(copy), std::vector<std::string>({"a"}));
+
+    auto moved_inline = std::move(inline_vec);
+    EXPECT_TRUE(moved_inline.isInline());
+    EXPECT_EQ(to_vector(moved_inline), std::vector<std::string>({"a"}));
+    EXPECT_TRUE(inline_vec.empty());
+
+    auto moved_heap = std::move(heap_vec);
+    EXPECT_FALSE(moved_heap.isInline());
+    EXPECT_EQ(to_vector(moved_heap), std::vector<std::string>({"a", "b", "c"}));
+    EXPECT_TRUE(heap_vec.empty());
+    EXPECT_TRUE(heap_vec.isInline());
+
+    moved_inline = std::move(moved_heap);
+    EXPECT_EQ(to_vector(moved_inline), std::vector<std::string>({"a", "b", "c"}));
+}
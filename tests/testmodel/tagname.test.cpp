@@ -0,0 +1,102 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/model/tagname.h"
+
+#include "google_test.h"
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace ModelView;
+
+//! Tests of TagName.
+
+class TagNameTest : public ::testing::Test {
+};
+
+TEST_F(TagNameTest, initialState)
+{
+    TagName tag;
+    EXPECT_TRUE(tag.empty());
+    EXPECT_EQ(tag.id(), 0);
+    EXPECT_EQ(tag.name(), std::string());
+
+    EXPECT_EQ(TagName(""), tag);
+    EXPECT_EQ(TagName(std::string()), tag);
+}
+
+//! Same names are interned into the same identifier.
+
+TEST_F(TagNameTest, interning)
+{
+    TagName tag1("TagNameTest_interning_a");
+    TagName tag2(std::string("TagNameTest_interning_a"));
+    TagName tag3("TagNameTest_interning_b");
+
+    EXPECT_FALSE(tag1.empty());
+    EXPECT_NE(tag1.id(), 0);
+    EXPECT_EQ(tag1.id(), tag2.id());
+    EXPECT_NE(tag1.id(), tag3.id());
+    EXPECT_EQ(&tag1.name(), &tag2.name());
+
+    EXPECT_TRUE(tag1 == tag2);
+    EXPECT_FALSE(tag1 != tag2);
+    EXPECT_FALSE(tag1 == tag3);
+    EXPECT_TRUE(tag1 != tag3);
+}
+
+//! Comparison and concatenation with strings.
+
+TEST_F(TagNameTest, stringCompatibility)
+{
+    TagName tag("abc");
+    const std::string str("abc");
+
+    EXPECT_TRUE(tag == "abc");
+    EXPECT_TRUE("abc" == tag);
+    EXPECT_TRUE(tag == str);
+    EXPECT_TRUE(str == tag);
+    EXPECT_TRUE(tag != "abd");
+    EXPECT_TRUE(std::string("abd") != tag);
+
+    const std::string& ref = tag;
+    EXPECT_EQ(ref, str);
+    EXPECT_EQ("x" + tag + "y", "xabcy");
+
+    std::ostringstream os;
+    os << tag;
+    EXPECT_EQ(os.str(), "abc");
+
+    std::unordered_set<TagName> tags = {"abc", str, "def"};
+    EXPECT_EQ(tags.size(), 2u);
+}
+
+//! Concurrent interning of the same names gives same identifiers in all threads.
+
+TEST_F(TagNameTest, concurrentInterning)
+{
+    const int nthreads = 4;
+    const int nnames = 1000;
+
+    std::vector<std::vector<int>> ids(nthreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nthreads; ++i)
+        threads.emplace_back([i, &ids]() {
+            for (int n = 0; n < nnames; ++n)
+                ids[i].push_back(TagName("TagNameTest_concurrent_" + std::to_string(n)).id());
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int i = 1; i < nthreads; ++i)
+        EXPECT_EQ(ids[i], ids[0]);
+    EXPECT_EQ(std::unordered_set<int>(ids[0].begin(), ids[0].end()).size(), size_t(nnames));
+}
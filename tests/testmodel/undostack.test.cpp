@@ -22,6 +22,10 @@
 #include "mvvm/standarditems/axisitems.h"
 #include "mvvm/standarditems/data1ditem.h"
 #include "mvvm/standarditems/graphitem.h"
+#include "mvvm/standarditems/vectoritem.h"
+#include <QUndoStack>
+#include <chrono>
+#include <thread>
 
 using namespace ModelView;
 
@@ -908,3 +912,138 @@ TEST_F(UndoStackTest, insertDataItemViaMacro)
     EXPECT_EQ(restoredDataItem->binCenters(), expected_centers);
     EXPECT_EQ(restoredDataItem->binValues(), expected_values);
 }
+
+//! Insert compound item and change its property. Undo both, then redo both. Property should be
+//! found by redo of the value change.
+
+TEST_F(UndoStackTest, insertCompoundItemAndSetProperty)
+{
+    SessionModel model;
+    model.setUndoRedoEnabled(true);
+
+    auto item = model.insertItem<VectorItem>();
+    const auto x_identifier = item->getItem(VectorItem::P_X)->identifier();
+    item->setX(42.0);
+    EXPECT_EQ(model.undoStack()->count(), 2);
+
+    model.undoStack()->undo();
+    model.undoStack()->undo();
+    EXPECT_EQ(model.rootItem()->childrenCount(), 0);
+
+    model.undoStack()->redo();
+    model.undoStack()->redo();
+    auto restored_item = model.topItem<VectorItem>();
+    ASSERT_TRUE(restored_item != nullptr);
+    EXPECT_EQ(restored_item->getItem(VectorItem::P_X)->identifier(), x_identifier);
+    EXPECT_EQ(restored_item->x(), 42.0);
+}
+
+//! Consecutive changes of the same value within the merge interval are merged into one command.
+
+TEST_F(UndoStackTest, mergeValueChanges)
+{
+    SessionModel model;
+    auto item = model.insertItem<PropertyItem>();
+    auto other = model.insertItem<PropertyItem>();
+    item->setData(1.0);
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+    stack->setMergeInterval(60000);
+
+    item->setData(2.0);
+    item->setData(3.0);
+    item->setData(4.0);
+    EXPECT_EQ(stack->count(), 1);
+
+    // change of another item or role starts new command
+    other->setData(2.0);
+    item->setData(5.0);
+    item->setDisplayName("abc");
+    EXPECT_EQ(stack->count(), 4);
+
+    // undoing merged changes at once
+    stack->undo();
+    stack->undo();
+    stack->undo();
+    EXPECT_EQ(item->data<double>(), 4.0);
+    stack->undo();
+    EXPECT_EQ(item->data<double>(), 1.0);
+
+    stack->redo();
+    EXPECT_EQ(item->data<double>(), 4.0);
+}
+
+//! Merged command which returns the value back is removed from the stack.
+
+TEST_F(UndoStackTest, mergeValueChangesBack)
+{
+    SessionModel model;
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(1.0);
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+    stack->setMergeInterval(60000);
+
+    item->setData(2.0);
+    item->setData(1.0);
+    EXPECT_EQ(stack->count(), 0);
+    EXPECT_EQ(item->data<double>(), 1.0);
+}
+
+//! Merging is disabled by default, but happens inside the macro when enabled.
+
+TEST_F(UndoStackTest, mergeValueChangesInMacro)
+{
+    SessionModel model;
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(1.0);
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+
+    item->setData(2.0);
+    item->setData(3.0);
+    EXPECT_EQ(stack->count(), 2);
+
+    stack->setMergeInterval(1);
+    stack->beginMacro("macro");
+    item->setData(4.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    item->setData(5.0);
+    stack->endMacro();
+    EXPECT_EQ(stack->count(), 3);
+
+    auto macro = UndoStack::qtUndoStack(stack)->command(2);
+    EXPECT_EQ(macro->childCount(), 1);
+
+    stack->undo();
+    EXPECT_EQ(item->data<double>(), 3.0);
+}
+
+//! Memory usage of the stack, and merging of commands above the memory threshold.
+
+TEST_F(UndoStackTest, mergeMemoryThreshold)
+{
+    SessionModel model;
+    auto item = model.insertItem<PropertyItem>();
+    item->setData(std::string("initial"));
+    model.setUndoRedoEnabled(true);
+    auto stack = model.undoStack();
+    EXPECT_EQ(stack->memoryUsage(), 0u);
+
+    item->setData(std::string(1000, 'a'));
+    item->setData(std::string(1000, 'b'));
+    EXPECT_EQ(stack->count(), 2);
+    const size_t usage = stack->memoryUsage();
+    EXPECT_GT(usage, 1000u);
+
+    // above the threshold all changes are merged into the last command
+    stack->setMergeMemoryThreshold(usage / 2);
+    item->setData(std::string("c"));
+    item->setData(std::string("d"));
+    EXPECT_EQ(stack->count(), 2);
+    stack->undo();
+    EXPECT_EQ(item->data<std::string>(), std::string(1000, 'a'));
+
+    stack->clear();
+    EXPECT_EQ(stack->memoryUsage(), 0u);
+}
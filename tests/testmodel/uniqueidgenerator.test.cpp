@@ -0,0 +1,73 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/core/uniqueidgenerator.h"
+
+#include "google_test.h"
+#include <QUuid>
+#include <future>
+#include <set>
+
+using namespace ModelView;
+
+//! Tests of UniqueIdGenerator.
+
+class UniqueIdGeneratorTest : public ::testing::Test {
+};
+
+//! Generated identifier has the form of UUID version 4.
+
+TEST_F(UniqueIdGeneratorTest, uuidFormat)
+{
+    auto str = UniqueIdGenerator::generate();
+    EXPECT_EQ(str.size(), 38u);
+    EXPECT_EQ(str.front(), '{');
+    EXPECT_EQ(str.back(), '}');
+
+    auto uuid = QUuid::fromString(QString::fromStdString(str));
+    EXPECT_FALSE(uuid.isNull());
+    EXPECT_EQ(uuid.version(), QUuid::Random);
+    EXPECT_EQ(uuid.variant(), QUuid::DCE);
+    EXPECT_EQ(uuid.toString().toStdString(), str);
+
+    auto id = UniqueIdGenerator::generateCompact();
+    EXPECT_EQ(CompactIdentifier::fromString(id.toString()), id);
+    EXPECT_EQ(QUuid::fromString(QString::fromStdString(id.toString())).version(), QUuid::Random);
+}
+
+TEST_F(UniqueIdGeneratorTest, uniqueness)
+{
+    const size_t count = 10000;
+    std::set<identifier_type> ids;
+    for (size_t i = 0; i < count; ++i)
+        ids.insert(UniqueIdGenerator::generate());
+    EXPECT_EQ(ids.size(), count);
+}
+
+//! Identifiers generated in different threads are different.
+
+TEST_F(UniqueIdGeneratorTest, threads)
+{
+    const size_t count = 1000;
+    auto generate = [count]() {
+        std::vector<identifier_type> result;
+        for (size_t i = 0; i < count; ++i)
+            result.push_back(UniqueIdGenerator::generate());
+        return result;
+    };
+
+    auto future1 = std::async(std::launch::async, generate);
+    auto future2 = std::async(std::launch::async, generate);
+    auto ids1 = future1.get();
+    auto ids2 = future2.get();
+
+    std::set<identifier_type> ids(ids1.begin(), ids1.end());
+    ids.insert(ids2.begin(), ids2.end());
+    EXPECT_EQ(ids.size(), 2 * count);
+}
@@ -196,3 +196,36 @@ TEST_F(Data2DPlotControllerTest, dataRange)
     EXPECT_EQ(range.lower, 1.0);
     EXPECT_EQ(range.upper, 6.0);
 }
+
+//! Testing ranges of colormap data (centers of first and last bins) and consecutive updates
+//! of data points.
+
+TEST_F(Data2DPlotControllerTest, keyValueRange)
+{
+    auto custom_plot = std::make_unique<QCustomPlot>();
+    auto color_map = new QCPColorMap(custom_plot->xAxis, custom_plot->yAxis);
+
+    SessionModel model;
+    auto data_item = model.insertItem<Data2DItem>();
+    const int nx = 3, ny = 2;
+    data_item->setAxes(FixedBinAxisItem::create(nx, 0.0, 3.0),
+                       FixedBinAxisItem::create(ny, 0.0, 2.0));
+
+    Data2DPlotController controller(color_map);
+    controller.setItem(data_item);
+
+    EXPECT_EQ(color_map->data()->keyRange(), QCPRange(0.5, 2.5));
+    EXPECT_EQ(color_map->data()->valueRange(), QCPRange(0.5, 1.5));
+
+    data_item->setContent(std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    data_item->setContent(std::vector<double>{-1.0, 2.0, 3.0, 4.0, 5.0, 10.0});
+
+    EXPECT_EQ(color_map->data()->keySize(), nx);
+    EXPECT_EQ(color_map->data()->valueSize(), ny);
+    EXPECT_EQ(color_map->data()->cell(0, 0), -1.0);
+    EXPECT_EQ(color_map->data()->cell(1, 0), 2.0);
+    EXPECT_EQ(color_map->data()->cell(0, 1), 4.0);
+    EXPECT_EQ(color_map->data()->cell(nx - 1, ny - 1), 10.0);
+    EXPECT_EQ(color_map->dataRange().lower, -1.0);
+    EXPECT_EQ(color_map->dataRange().upper, 10.0);
+}
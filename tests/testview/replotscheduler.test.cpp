@@ -0,0 +1,120 @@
+// ************************************************************************** //
+//
+//  Model-view-view-model framework for large GUI applications
+//
+//! @license   GNU General Public License v3 or higher (see COPYING)
+//! @authors   see AUTHORS
+//
+// ************************************************************************** //
+
+#include "mvvm/plotting/replotscheduler.h"
+
+#include "google_test.h"
+#include <qcustomplot.h>
+#include <QElapsedTimer>
+#include <QSignalSpy>
+#include <stdexcept>
+
+using namespace ModelView;
+
+//! Testing ReplotScheduler.
+
+class ReplotSchedulerTest : public ::testing::Test {
+};
+
+TEST_F(ReplotSchedulerTest, initialState)
+{
+    EXPECT_THROW(ReplotScheduler::instance(nullptr), std::runtime_error);
+
+    QCustomPlot custom_plot;
+    auto scheduler = ReplotScheduler::instance(&custom_plot);
+    EXPECT_EQ(scheduler->parent(), &custom_plot);
+    EXPECT_FALSE(scheduler->hasPendingReplot());
+    EXPECT_EQ(scheduler->maxFrameRate(), 0);
+    EXPECT_EQ(scheduler->requestedReplotCount(), 0);
+    EXPECT_EQ(scheduler->performedReplotCount(), 0);
+
+    // same scheduler is returned for the same plot
+    EXPECT_EQ(ReplotScheduler::instance(&custom_plot), scheduler);
+
+    QCustomPlot custom_plot2;
+    EXPECT_NE(ReplotScheduler::instance(&custom_plot2), scheduler);
+}
+
+//! Several requests result in a single replot on next event loop turn.
+
+TEST_F(ReplotSchedulerTest, coalescedReplot)
+{
+    QCustomPlot custom_plot;
+    auto scheduler = ReplotScheduler::instance(&custom_plot);
+    QSignalSpy spy(&custom_plot, &QCustomPlot::afterReplot);
+
+    scheduler->scheduleReplot();
+    scheduler->scheduleReplot();
+    scheduler->scheduleReplot();
+
+    EXPECT_TRUE(scheduler->hasPendingReplot());
+    EXPECT_EQ(spy.count(), 0);
+    EXPECT_EQ(scheduler->requestedReplotCount(), 3);
+    EXPECT_EQ(scheduler->performedReplotCount(), 0);
+
+    EXPECT_TRUE(spy.wait(1000));
+    EXPECT_EQ(spy.count(), 1);
+    EXPECT_FALSE(scheduler->hasPendingReplot());
+    EXPECT_EQ(scheduler->requestedReplotCount(), 3);
+    EXPECT_EQ(scheduler->performedReplotCount(), 1);
+
+    scheduler->resetCounters();
+    EXPECT_EQ(scheduler->requestedReplotCount(), 0);
+    EXPECT_EQ(scheduler->performedReplotCount(), 0);
+}
+
+//! Pending replot can be performed immediately.
+
+TEST_F(ReplotSchedulerTest, flush)
+{
+    QCustomPlot custom_plot;
+    auto scheduler = ReplotScheduler::instance(&custom_plot);
+    QSignalSpy spy(&custom_plot, &QCustomPlot::afterReplot);
+
+    // nothing to flush
+    scheduler->flush();
+    EXPECT_EQ(spy.count(), 0);
+
+    scheduler->scheduleReplot();
+    scheduler->scheduleReplot();
+    scheduler->flush();
+    EXPECT_EQ(spy.count(), 1);
+    EXPECT_FALSE(scheduler->hasPendingReplot());
+    EXPECT_EQ(scheduler->requestedReplotCount(), 2);
+    EXPECT_EQ(scheduler->performedReplotCount(), 1);
+}
+
+//! Replots are delayed according to frame rate limit.
+
+TEST_F(ReplotSchedulerTest, maxFrameRate)
+{
+    QCustomPlot custom_plot;
+    auto scheduler = ReplotScheduler::instance(&custom_plot);
+    scheduler->setMaxFrameRate(10);
+    EXPECT_EQ(scheduler->maxFrameRate(), 10);
+
+    QSignalSpy spy(&custom_plot, &QCustomPlot::afterReplot);
+
+    scheduler->scheduleReplot();
+    EXPECT_TRUE(spy.wait(1000));
+
+    // next replot can't happen earlier than in 100 msec
+    QElapsedTimer timer;
+    timer.start();
+    scheduler->scheduleReplot();
+    scheduler->scheduleReplot();
+    EXPECT_TRUE(spy.wait(1000));
+    EXPECT_GE(timer.elapsed(), 50);
+    EXPECT_EQ(spy.count(), 2);
+    EXPECT_EQ(scheduler->requestedReplotCount(), 3);
+    EXPECT_EQ(scheduler->performedReplotCount(), 2);
+
+    scheduler->setMaxFrameRate(-1);
+    EXPECT_EQ(scheduler->maxFrameRate(), 0);
+}
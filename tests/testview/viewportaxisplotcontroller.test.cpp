@@ -244,7 +244,7 @@ TEST_F(ViewportAxisPlotControllerTest, changeViewportAxisItemMapping)
 
     MockWidgetForItem widget(axisItem);
     EXPECT_CALL(widget, onDataChange(_, _)).Times(0);
-    EXPECT_CALL(widget, onPropertyChange(axisItem, ViewportAxisItem::P_MAX)).Times(1);
+    EXPECT_CALL(widget, onPropertyChange(axisItem, ViewportAxisItem::P_MAX.name())).Times(1);
     EXPECT_CALL(widget, onChildPropertyChange(_, _)).Times(0);
     EXPECT_CALL(widget, onItemInserted(_, _)).Times(0);
     EXPECT_CALL(widget, onAboutToRemoveItem(_, _)).Times(0);
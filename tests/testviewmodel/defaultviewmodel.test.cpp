@@ -206,6 +206,42 @@ TEST_F(DefaultViewModelTest, propertyItemDataChanged)
     EXPECT_EQ(arguments.at(2).value<QVector<int>>(), expectedRoles);
 }
 
+//! Views of rows are constructed when the row is first indexed, or when views of its item are
+//! looked for. Changes of rows, which were never shown, are not reported.
+
+TEST_F(DefaultViewModelTest, rowsConstructedOnDemand)
+{
+    SessionModel model;
+    auto item0 = model.insertItem<PropertyItem>();
+    auto item1 = model.insertItem<PropertyItem>();
+
+    DefaultViewModel viewModel(&model);
+    EXPECT_EQ(viewModel.rowCount(), 2);
+    EXPECT_FALSE(viewModel.rootItem()->isRowConstructed(0));
+    EXPECT_FALSE(viewModel.rootItem()->isRowConstructed(1));
+
+    QSignalSpy spyDataChanged(&viewModel, &DefaultViewModel::dataChanged);
+    item0->setData(42.0);
+    EXPECT_EQ(spyDataChanged.count(), 0);
+
+    auto labelIndex = viewModel.index(0, 0);
+    EXPECT_TRUE(viewModel.rootItem()->isRowConstructed(0));
+    EXPECT_FALSE(viewModel.rootItem()->isRowConstructed(1));
+    EXPECT_EQ(viewModel.itemFromIndex(labelIndex)->item(), item0);
+    EXPECT_EQ(viewModel.data(viewModel.index(0, 1), Qt::DisplayRole).toDouble(), 42.0);
+    item0->setData(43.0);
+    EXPECT_EQ(spyDataChanged.count(), 1);
+
+    EXPECT_EQ(viewModel.findViews(item1).size(), 2u);
+    EXPECT_TRUE(viewModel.rootItem()->isRowConstructed(1));
+
+    // row, which was never shown, is removed without constructing its views
+    model.insertItem<PropertyItem>();
+    model.removeItem(model.rootItem(), {"", 2});
+    EXPECT_EQ(viewModel.rowCount(), 2);
+    EXPECT_EQ(viewModel.sessionItemFromIndex(viewModel.index(1, 0)), item1);
+}
+
 //! Inserting single top level item.
 
 TEST_F(DefaultViewModelTest, insertSingleTopItem)
@@ -307,3 +307,35 @@ TEST_F(StandardChildrenStrategiesTest, PropertyItemsFlatStrategy)
         EXPECT_EQ(children_data(children), expected_children_data);
     }
 }
+
+//! Checking that hasChildren of all strategies agrees with the vector of children.
+
+TEST_F(StandardChildrenStrategiesTest, hasChildren)
+{
+    AllChildrenStrategy all_strategy;
+    TopItemsStrategy top_strategy;
+    PropertyItemsStrategy property_strategy;
+    PropertyItemsFlatStrategy flat_strategy;
+    std::vector<const ChildrenStrategyInterface*> strategies = {&all_strategy, &top_strategy,
+                                                                &property_strategy, &flat_strategy};
+
+    SessionItem empty_item("model_type");
+    VectorItem vector_item;
+    VectorItem hidden_vector_item;
+    for (auto child : hidden_vector_item.children())
+        child->setVisible(false);
+    TestItem test_item;
+    ToyItems::ShapeGroupItem group_item;
+    group_item.setCurrentType(ToyItems::Constants::CylinderItemType);
+    ToyItems::ParticleItem particle_item;
+    SessionModel model;
+    model.insertItem<VectorItem>()->setVisible(false);
+
+    std::vector<const SessionItem*> items = {nullptr,           &empty_item,
+                                             &vector_item,      &hidden_vector_item,
+                                             &test_item,        &group_item,
+                                             &particle_item,    model.rootItem()};
+    for (auto strategy : strategies)
+        for (auto item : items)
+            EXPECT_EQ(strategy->hasChildren(item), !strategy->children(item).empty());
+}
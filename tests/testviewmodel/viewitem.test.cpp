@@ -11,6 +11,7 @@
 
 #include "google_test.h"
 #include "test_utils.h"
+#include "mvvm/model/sessionitem.h"
 #include <stdexcept>
 
 using namespace ModelView;
@@ -190,10 +191,89 @@ TEST_F(ViewItemTest, insertRowsThenRemove)
     EXPECT_EQ(view_item.child(0, 1), expected_row0[1]);
     EXPECT_EQ(view_item.child(1, 0), expected_row1[0]);
     EXPECT_EQ(view_item.child(1, 1), expected_row1[1]);
+
+    // row and column of remaining children
+    EXPECT_EQ(expected_row0[0]->row(), 0);
+    EXPECT_EQ(expected_row0[1]->row(), 0);
+    EXPECT_EQ(expected_row1[0]->row(), 1);
+    EXPECT_EQ(expected_row1[1]->row(), 1);
+    EXPECT_EQ(expected_row1[0]->column(), 0);
+    EXPECT_EQ(expected_row1[1]->column(), 1);
+}
+
+//! Row and column of children after series of insertions at the beginning.
+
+TEST_F(ViewItemTest, prependRows)
+{
+    auto [children_row0, expected_row0] = test_data(/*ncolumns*/ 3);
+    auto [children_row1, expected_row1] = test_data(/*ncolumns*/ 3);
+    auto [children_row2, expected_row2] = test_data(/*ncolumns*/ 3);
+
+    TestItem view_item;
+    view_item.insertRow(0, std::move(children_row0));
+    view_item.insertRow(0, std::move(children_row1));
+    view_item.insertRow(0, std::move(children_row2));
+
+    EXPECT_EQ(expected_row2[2]->row(), 0);
+    EXPECT_EQ(expected_row2[2]->column(), 2);
+    EXPECT_EQ(expected_row1[1]->row(), 1);
+    EXPECT_EQ(expected_row1[1]->column(), 1);
+    EXPECT_EQ(expected_row0[0]->row(), 2);
+    EXPECT_EQ(expected_row0[0]->column(), 0);
+
+    // removing first row
+    view_item.removeRow(0);
+    EXPECT_EQ(expected_row1[1]->row(), 0);
+    EXPECT_EQ(expected_row1[1]->column(), 1);
+    EXPECT_EQ(expected_row0[2]->row(), 1);
+    EXPECT_EQ(expected_row0[2]->column(), 2);
 }
 
 //! Clean item's children.
 
+//! Insert several rows at once, then remove several rows at once.
+
+TEST_F(ViewItemTest, insertRowsRemoveRows)
+{
+    auto [children_row0, expected_row0] = test_data(/*ncolumns*/ 2);
+    auto [children_row1, expected_row1] = test_data(/*ncolumns*/ 2);
+    auto [children_row2, expected_row2] = test_data(/*ncolumns*/ 2);
+    auto [children_row3, expected_row3] = test_data(/*ncolumns*/ 2);
+
+    TestItem view_item;
+    view_item.appendRow(std::move(children_row0));
+    view_item.appendRow(std::move(children_row3));
+
+    std::vector<children_t> rows;
+    rows.push_back(std::move(children_row1));
+    rows.push_back(std::move(children_row2));
+    view_item.insertRows(1, std::move(rows));
+
+    EXPECT_EQ(view_item.rowCount(), 4);
+    EXPECT_EQ(view_item.columnCount(), 2);
+    EXPECT_EQ(view_item.child(1, 0), expected_row1[0]);
+    EXPECT_EQ(view_item.child(2, 1), expected_row2[1]);
+    EXPECT_EQ(view_item.child(3, 1), expected_row3[1]);
+    EXPECT_EQ(expected_row2[1]->parent(), &view_item);
+    EXPECT_EQ(expected_row2[1]->row(), 2);
+    EXPECT_EQ(expected_row2[1]->column(), 1);
+    EXPECT_EQ(expected_row3[0]->row(), 3);
+
+    // wrong number of columns
+    std::vector<children_t> wrong_rows;
+    wrong_rows.push_back(test_data(/*ncolumns*/ 3).first);
+    EXPECT_THROW(view_item.insertRows(0, std::move(wrong_rows)), std::runtime_error);
+
+    // removing two rows in the middle
+    view_item.removeRows(1, 2);
+    EXPECT_EQ(view_item.rowCount(), 2);
+    EXPECT_EQ(view_item.child(0, 0), expected_row0[0]);
+    EXPECT_EQ(view_item.child(1, 1), expected_row3[1]);
+    EXPECT_EQ(expected_row3[1]->row(), 1);
+
+    EXPECT_THROW(view_item.removeRows(1, 2), std::runtime_error);
+}
+
 TEST_F(ViewItemTest, clear)
 {
     auto [children, expected] = test_data(/*ncolumns*/ 1);
@@ -221,3 +301,78 @@ TEST_F(ViewItemTest, children)
 
     EXPECT_EQ(view_item.children(), expected);
 }
+
+//! Removing all rows brings the item back to its initial state.
+
+TEST_F(ViewItemTest, removeAllRows)
+{
+    auto [children_row0, expected_row0] = test_data(/*ncolumns*/ 2);
+    auto [children_row1, expected_row1] = test_data(/*ncolumns*/ 2);
+
+    TestItem view_item;
+    view_item.appendRow(std::move(children_row0));
+    view_item.appendRow(std::move(children_row1));
+    view_item.removeRows(0, 2);
+
+    EXPECT_EQ(view_item.rowCount(), 0);
+    EXPECT_EQ(view_item.columnCount(), 0);
+    EXPECT_TRUE(view_item.children().empty());
+    EXPECT_THROW(view_item.child(0, 0), std::runtime_error);
+
+    auto [children_row2, expected_row2] = test_data(/*ncolumns*/ 3);
+    view_item.appendRow(std::move(children_row2));
+    EXPECT_EQ(view_item.rowCount(), 1);
+    EXPECT_EQ(view_item.columnCount(), 3);
+    EXPECT_EQ(view_item.child(0, 2), expected_row2[2]);
+    EXPECT_EQ(expected_row2[2]->row(), 0);
+    EXPECT_EQ(expected_row2[2]->column(), 2);
+}
+
+//! Views of lazy rows are constructed by the factory on first access.
+
+TEST_F(ViewItemTest, insertLazyRows)
+{
+    int ncalls{0};
+    auto factory = [&ncalls](SessionItem*) {
+        ++ncalls;
+        return TestUtils::create_row<ViewItem, TestItem>(/*ncolumns*/ 2);
+    };
+
+    SessionItem item0;
+    SessionItem item1;
+    TestItem view_item;
+    view_item.insertLazyRows(0, {&item0, &item1}, /*ncolumns*/ 2, factory);
+
+    EXPECT_EQ(view_item.rowCount(), 2);
+    EXPECT_EQ(view_item.columnCount(), 2);
+    EXPECT_EQ(ncalls, 0);
+    EXPECT_FALSE(view_item.isRowConstructed(0));
+    EXPECT_FALSE(view_item.isRowConstructed(1));
+    EXPECT_EQ(view_item.rowItem(1), &item1);
+
+    // views of the row are constructed on first access
+    auto view = view_item.child(1, 1);
+    EXPECT_EQ(ncalls, 1);
+    EXPECT_FALSE(view_item.isRowConstructed(0));
+    EXPECT_TRUE(view_item.isRowConstructed(1));
+    EXPECT_EQ(view->parent(), &view_item);
+    EXPECT_EQ(view->row(), 1);
+    EXPECT_EQ(view->column(), 1);
+    EXPECT_EQ(view_item.child(1, 1), view);
+    EXPECT_EQ(ncalls, 1);
+
+    // constructed views are shifted by the row inserted in front
+    auto [children, expected] = test_data(/*ncolumns*/ 2);
+    view_item.insertRow(0, std::move(children));
+    EXPECT_EQ(view->row(), 2);
+    EXPECT_EQ(view_item.rowItem(0), nullptr);
+    EXPECT_EQ(view_item.rowItem(2), &item1);
+    EXPECT_EQ(view_item.child(0, 1), expected[1]);
+
+    view_item.removeRow(1);
+    EXPECT_EQ(view->row(), 1);
+    EXPECT_EQ(ncalls, 1);
+
+    EXPECT_THROW(view_item.insertLazyRows(0, {&item0}, /*ncolumns*/ 3, factory),
+                 std::runtime_error);
+}
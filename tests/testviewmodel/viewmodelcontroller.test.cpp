@@ -10,12 +10,16 @@
 #include "mvvm/viewmodel/viewmodelcontroller.h"
 
 #include "google_test.h"
+#include "mvvm/factories/viewmodelcontrollerbuilder.h"
+#include "mvvm/model/modeltransaction.h"
 #include "mvvm/model/propertyitem.h"
+#include "mvvm/model/taginfo.h"
 #include "mvvm/model/sessionmodel.h"
 #include "mvvm/standarditems/vectoritem.h"
 #include "mvvm/viewmodel/labeldatarowstrategy.h"
 #include "mvvm/viewmodel/standardchildrenstrategies.h"
 #include "mvvm/viewmodel/standardviewitems.h"
+#include "mvvm/viewmodel/viewmodel.h"
 #include "mvvm/viewmodel/viewmodelbase.h"
 #include <QSignalSpy>
 
@@ -33,6 +37,18 @@ public:
         result->setRootSessionItem(session_model->rootItem());
         return result;
     }
+
+    //! Creates view model, which constructs views on demand.
+    std::unique_ptr<ViewModel> create_lazy_view_model(SessionModel* session_model)
+    {
+        std::unique_ptr<ViewModelController> controller =
+            ViewModelControllerBuilder()
+                .model(session_model)
+                .childrenStrategy(std::make_unique<AllChildrenStrategy>())
+                .rowStrategy(std::make_unique<LabelDataRowStrategy>())
+                .lazyPopulation();
+        return std::make_unique<ViewModel>(std::move(controller));
+    }
 };
 
 //! Initial state of the controller. It is in working state only after setRootItem.
@@ -265,6 +281,151 @@ TEST_F(ViewModelControllerTest, insertChildToParent)
     EXPECT_EQ(view_model.columnCount(view_model.index(0, 0)), 2);
 }
 
+//! Insert three property items within the transaction. View model is notified once.
+
+TEST_F(ViewModelControllerTest, insertPropertiesInTransaction)
+{
+    SessionModel session_model;
+
+    ViewModelBase view_model;
+    QSignalSpy spyInsert(&view_model, &ViewModelBase::rowsInserted);
+
+    auto controller = create_controller(&session_model, &view_model);
+    ModelTransaction transaction(&session_model);
+    auto item0 = session_model.insertItem<PropertyItem>();
+    auto item1 = session_model.insertItem<PropertyItem>();
+    auto item2 = session_model.insertItem<PropertyItem>();
+    EXPECT_EQ(spyInsert.count(), 0);
+    EXPECT_EQ(view_model.rowCount(), 0);
+    transaction.commit();
+
+    // checking signaling
+    EXPECT_EQ(spyInsert.count(), 1);
+    QList<QVariant> arguments = spyInsert.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), QModelIndex());
+    EXPECT_EQ(arguments.at(1).value<int>(), 0);
+    EXPECT_EQ(arguments.at(2).value<int>(), 2);
+
+    // checking model layout
+    EXPECT_EQ(view_model.rowCount(), 3);
+    EXPECT_EQ(view_model.columnCount(), 2);
+
+    EXPECT_EQ(view_model.itemFromIndex(view_model.index(0, 0))->item(), item0);
+    EXPECT_EQ(view_model.itemFromIndex(view_model.index(1, 0))->item(), item1);
+    EXPECT_EQ(view_model.itemFromIndex(view_model.index(2, 0))->item(), item2);
+    EXPECT_EQ(controller->findViews(item1).size(), 2u);
+}
+
+//! Insert parent and its children within the transaction. Children are shown once, as a part of
+//! parent's branch.
+
+TEST_F(ViewModelControllerTest, insertChildToParentInTransaction)
+{
+    SessionModel session_model;
+
+    ViewModelBase view_model;
+    QSignalSpy spyInsert(&view_model, &ViewModelBase::rowsInserted);
+
+    auto controller = create_controller(&session_model, &view_model);
+
+    {
+        ModelTransaction transaction(&session_model);
+        auto parent = session_model.insertItem<CompoundItem>();
+        parent->registerTag(TagInfo::universalTag("children"), /*set_as_default*/ true);
+        session_model.insertItem<SessionItem>(parent);
+        session_model.insertItem<SessionItem>(parent);
+    }
+
+    // checking signaling: parent row, and children rows while building parent's branch
+    EXPECT_EQ(spyInsert.count(), 3);
+
+    // checking model layout: parent and two children
+    EXPECT_EQ(view_model.rowCount(), 1);
+    EXPECT_EQ(view_model.rowCount(view_model.index(0, 0)), 2);
+    EXPECT_EQ(view_model.columnCount(view_model.index(0, 0)), 2);
+}
+
+//! Changing data of several items within the transaction. View model reports a single range.
+
+TEST_F(ViewModelControllerTest, dataChangedInTransaction)
+{
+    SessionModel session_model;
+    auto item0 = session_model.insertItem<PropertyItem>();
+    auto item1 = session_model.insertItem<PropertyItem>();
+    auto item2 = session_model.insertItem<PropertyItem>();
+
+    ViewModelBase view_model;
+    auto controller = create_controller(&session_model, &view_model);
+    // rows are shown, so their views are constructed
+    for (int row = 0; row < 3; ++row)
+        view_model.index(row, 1);
+    QSignalSpy spyData(&view_model, &ViewModelBase::dataChanged);
+
+    {
+        ModelTransaction transaction(&session_model);
+        item2->setData(42.0);
+        item0->setData(43.0);
+        item2->setData(44.0);
+        EXPECT_EQ(spyData.count(), 0);
+    }
+
+    EXPECT_EQ(spyData.count(), 1);
+    QList<QVariant> arguments = spyData.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), view_model.index(0, 1));
+    EXPECT_EQ(arguments.at(1).value<QModelIndex>(), view_model.index(2, 1));
+    EXPECT_EQ(view_model.data(view_model.index(2, 1), Qt::DisplayRole).toDouble(), 44.0);
+}
+
+//! Bulk insertion of items. View model is notified once.
+
+TEST_F(ViewModelControllerTest, insertItems)
+{
+    SessionModel session_model;
+    session_model.insertItem<PropertyItem>();
+
+    ViewModelBase view_model;
+    auto controller = create_controller(&session_model, &view_model);
+    QSignalSpy spyInsert(&view_model, &ViewModelBase::rowsInserted);
+
+    auto items = session_model.insertItems<PropertyItem>(session_model.rootItem(), {"", 0}, 3);
+
+    EXPECT_EQ(spyInsert.count(), 1);
+    QList<QVariant> arguments = spyInsert.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), QModelIndex());
+    EXPECT_EQ(arguments.at(1).value<int>(), 0);
+    EXPECT_EQ(arguments.at(2).value<int>(), 2);
+
+    EXPECT_EQ(view_model.rowCount(), 4);
+    for (int row = 0; row < 3; ++row)
+        EXPECT_EQ(view_model.itemFromIndex(view_model.index(row, 0))->item(),
+                  items[static_cast<size_t>(row)]);
+}
+
+//! Bulk removal of items. View model is notified once.
+
+TEST_F(ViewModelControllerTest, removeItems)
+{
+    SessionModel session_model;
+    auto items = session_model.insertItems<PropertyItem>(session_model.rootItem(), {}, 5);
+
+    ViewModelBase view_model;
+    auto controller = create_controller(&session_model, &view_model);
+    QSignalSpy spyRemove(&view_model, &ViewModelBase::rowsRemoved);
+
+    session_model.removeItems(session_model.rootItem(), {"", 1}, 3);
+
+    EXPECT_EQ(spyRemove.count(), 1);
+    QList<QVariant> arguments = spyRemove.takeFirst();
+    EXPECT_EQ(arguments.at(0).value<QModelIndex>(), QModelIndex());
+    EXPECT_EQ(arguments.at(1).value<int>(), 1);
+    EXPECT_EQ(arguments.at(2).value<int>(), 3);
+
+    EXPECT_EQ(view_model.rowCount(), 2);
+    EXPECT_EQ(view_model.itemFromIndex(view_model.index(0, 0))->item(), items[0]);
+    EXPECT_EQ(view_model.itemFromIndex(view_model.index(1, 0))->item(), items[4]);
+    EXPECT_TRUE(controller->findViews(items[2]).empty());
+}
+
 //! Removing single top level item.
 
 TEST_F(ViewModelControllerTest, removeSingleTopItem)
@@ -472,3 +633,127 @@ TEST_F(ViewModelControllerTest, findViews)
     ASSERT_EQ(views.size(), 1);
     EXPECT_EQ(views.at(0), view_model.rootItem());
 }
+
+//! Views of items should be forgotten on item removal, including views of its children.
+
+TEST_F(ViewModelControllerTest, findViewsAfterRemoval)
+{
+    SessionModel session_model;
+    ViewModelBase view_model;
+    auto controller = create_controller(&session_model, &view_model);
+
+    auto vector0 = session_model.insertItem<VectorItem>();
+    auto vector1 = session_model.insertItem<VectorItem>();
+    auto x_item = vector0->getItem(VectorItem::P_X);
+
+    auto views = controller->findViews(x_item);
+    ASSERT_EQ(views.size(), 2);
+    EXPECT_EQ(views.at(0)->item_role(), ItemDataRole::DISPLAY);
+    EXPECT_EQ(views.at(1)->item_role(), ItemDataRole::DATA);
+
+    session_model.removeItem(session_model.rootItem(), {"", 0});
+    EXPECT_TRUE(controller->findViews(x_item).empty());
+    EXPECT_TRUE(controller->findViews(vector0).empty());
+
+    views = controller->findViews(vector1);
+    ASSERT_EQ(views.size(), 2);
+    EXPECT_EQ(view_model.indexFromItem(views.at(0)), view_model.index(0, 0));
+    EXPECT_EQ(view_model.indexFromItem(views.at(1)), view_model.index(0, 1));
+}
+
+//! In the mode of lazy population views of children are constructed on fetch.
+
+TEST_F(ViewModelControllerTest, lazyPopulation)
+{
+    SessionModel session_model;
+    auto vector_item = session_model.insertItem<VectorItem>();
+    auto x_item = vector_item->getItem(VectorItem::P_X);
+
+    auto view_model = create_lazy_view_model(&session_model);
+
+    // only top level item has views
+    EXPECT_EQ(view_model->rowCount(), 1);
+    EXPECT_EQ(view_model->columnCount(), 2);
+    auto vector_index = view_model->index(0, 0);
+    EXPECT_EQ(view_model->sessionItemFromIndex(vector_index), vector_item);
+    EXPECT_EQ(view_model->rowCount(vector_index), 0);
+    EXPECT_TRUE(view_model->hasChildren(vector_index));
+    EXPECT_TRUE(view_model->canFetchMore(vector_index));
+    EXPECT_TRUE(view_model->findViews(x_item).empty());
+
+    QSignalSpy spyInsert(view_model.get(), &ViewModelBase::rowsInserted);
+    view_model->fetchMore(vector_index);
+    EXPECT_EQ(spyInsert.count(), 1);
+
+    EXPECT_EQ(view_model->rowCount(vector_index), 3);
+    EXPECT_FALSE(view_model->canFetchMore(vector_index));
+    EXPECT_EQ(view_model->findViews(x_item).size(), 2);
+
+    // property has no children
+    auto x_index = view_model->index(0, 0, vector_index);
+    EXPECT_FALSE(view_model->hasChildren(x_index));
+    view_model->fetchMore(x_index);
+    EXPECT_EQ(view_model->rowCount(x_index), 0);
+}
+
+//! Items inserted to the parent, which wasn't fetched yet, get their views on fetch.
+
+TEST_F(ViewModelControllerTest, lazyPopulationInsertItem)
+{
+    SessionModel session_model;
+    auto parent = session_model.insertItem<SessionItem>();
+    parent->registerTag(TagInfo::universalTag("tag"), /*set_as_default*/ true);
+
+    auto view_model = create_lazy_view_model(&session_model);
+    auto parent_index = view_model->index(0, 0);
+    EXPECT_FALSE(view_model->hasChildren(parent_index));
+
+    QSignalSpy spyInsert(view_model.get(), &ViewModelBase::rowsInserted);
+    auto child = session_model.insertItem<PropertyItem>(parent);
+    EXPECT_EQ(spyInsert.count(), 0);
+    EXPECT_TRUE(view_model->hasChildren(parent_index));
+
+    view_model->fetchMore(parent_index);
+    EXPECT_EQ(view_model->rowCount(parent_index), 1);
+    EXPECT_EQ(view_model->sessionItemFromIndex(view_model->index(0, 0, parent_index)), child);
+
+    // inserting to fetched parent creates views right away
+    session_model.insertItem<PropertyItem>(parent);
+    EXPECT_EQ(view_model->rowCount(parent_index), 2);
+
+    // new top level item is waiting for the fetch
+    session_model.insertItem<VectorItem>();
+    EXPECT_EQ(view_model->rowCount(), 2);
+    EXPECT_TRUE(view_model->canFetchMore(view_model->index(1, 0)));
+}
+
+//! Released views are constructed again on the next fetch.
+
+TEST_F(ViewModelControllerTest, lazyPopulationReleaseChildren)
+{
+    SessionModel session_model;
+    auto vector_item = session_model.insertItem<VectorItem>();
+    auto x_item = vector_item->getItem(VectorItem::P_X);
+
+    auto view_model = create_lazy_view_model(&session_model);
+    auto vector_index = view_model->index(0, 0);
+    view_model->fetchMore(vector_index);
+    EXPECT_EQ(view_model->rowCount(vector_index), 3);
+
+    QSignalSpy spyRemove(view_model.get(), &ViewModelBase::rowsRemoved);
+    view_model->releaseChildren(vector_index);
+    EXPECT_EQ(spyRemove.count(), 1);
+    EXPECT_EQ(view_model->rowCount(vector_index), 0);
+    EXPECT_TRUE(view_model->canFetchMore(vector_index));
+    EXPECT_TRUE(view_model->findViews(x_item).empty());
+
+    // data changes of released items are ignored
+    x_item->setData(42.0);
+
+    view_model->fetchMore(vector_index);
+    EXPECT_EQ(view_model->rowCount(vector_index), 3);
+    auto x_views = view_model->findViews(x_item);
+    ASSERT_EQ(x_views.size(), 2);
+    EXPECT_EQ(view_model->data(view_model->indexFromItem(x_views.at(1)), Qt::EditRole).toDouble(),
+              42.0);
+}